@@ -35,7 +35,7 @@ class ChApi ChCollisionInfo {
     ChVector<> vN;             ///< coll.normal, respect to A, in abs coords
     double distance;           ///< distance (negative for penetration)
     double eff_radius;         ///< effective radius of curvature at contact (SMC only)
-    float* reaction_cache;     ///< pointer to some persistent user cache of reactions
+    float* reaction_cache;     ///< pointer to some persistent user cache of reactions (6 floats)
 
     /// Basic default constructor.
     ChCollisionInfo();
@@ -405,6 +405,7 @@ class ChApi ChCollisionModel {
     /// CAPSULE      radius halflength
     /// ROUNDEDBOX   x-halfdim y-halfdim z-halfdim sphere_rad
     /// ROUNDEDCYL   x-radius z-radius halflength sphere_rad
+    /// TRIANGLE     x y z coordinates of the 3 vertices, relative to the model frame
     /// </pre>
     virtual std::vector<double> GetShapeDimensions(int index) const = 0;
 
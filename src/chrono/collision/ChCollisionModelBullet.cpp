@@ -839,6 +839,9 @@ void ChCollisionModelBullet::SyncPosition() {
                         (cbtScalar)rA(1, 1), (cbtScalar)rA(1, 2), (cbtScalar)rA(2, 0), (cbtScalar)rA(2, 1),
                         (cbtScalar)rA(2, 2));
     bt_collision_object->getWorldTransform().setBasis(basisA);
+
+    // Pairs of inactive (sleeping or fixed) objects are skipped by the narrowphase
+    bt_collision_object->forceActivationState(mcontactable->IsContactActive() ? ACTIVE_TAG : ISLAND_SLEEPING);
 }
 
 bool ChCollisionModelBullet::SetSphereRadius(double coll_radius, double out_envelope) {
@@ -910,6 +913,14 @@ std::vector<double> ChCollisionModelBullet::GetShapeDimensions(int index) const
             dims = {hdims.x(), hdims.y()};
             break;
         }
+        case ChCollisionShape::Type::TRIANGLE: {
+            auto bt_tri = static_cast<cbtCEtriangleShape*>(shape->m_bt_shape);
+            const ChVector<>& p1 = *bt_tri->get_p1();
+            const ChVector<>& p2 = *bt_tri->get_p2();
+            const ChVector<>& p3 = *bt_tri->get_p3();
+            dims = {p1.x(), p1.y(), p1.z(), p2.x(), p2.y(), p2.z(), p3.x(), p3.y(), p3.z()};
+            break;
+        }
         default:
             break;
     }
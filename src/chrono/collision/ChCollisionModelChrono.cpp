@@ -410,6 +410,10 @@ std::vector<double> ChCollisionModelChrono::GetShapeDimensions(int index) const
         case ChCollisionShape::Type::ROUNDEDCYL:
             dims = {shape->B.x, shape->B.z, shape->B.y, shape->C.x};
             break;
+        case ChCollisionShape::Type::TRIANGLE:
+            dims = {shape->A.x, shape->A.y, shape->A.z, shape->B.x, shape->B.y,
+                    shape->B.z, shape->C.x, shape->C.y, shape->C.z};
+            break;
         default:
             break;
     }
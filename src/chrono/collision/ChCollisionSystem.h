@@ -15,11 +15,14 @@
 #ifndef CH_COLLISIONSYSTEM_H
 #define CH_COLLISIONSYSTEM_H
 
+#include <vector>
+
 #include "chrono/collision/ChCollisionModel.h"
 #include "chrono/collision/ChCollisionInfo.h"
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChFrame.h"
 #include "chrono/assets/ChColor.h"
+#include "chrono/serialization/ChCheckpoint.h"
 
 namespace chrono {
 
@@ -169,6 +172,22 @@ class ChApi ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const = 0;
 
+    /// Perform ray-hit tests for a batch of rays with the collision models.
+    /// On return, 'results' contains the result of the ray-hit test from 'from[i]' to 'to[i]', for each i.
+    /// Return the number of rays which hit a collision model. This default implementation calls RayHit() for each ray;
+    /// derived classes can override it with a traversal of the collision data shared by coherent rays.
+    virtual int RayHitBatch(const std::vector<ChVector<>>& from,
+                            const std::vector<ChVector<>>& to,
+                            std::vector<ChRayhitResult>& results) const {
+        results.resize(from.size());
+        int num_hits = 0;
+        for (size_t i = 0; i < from.size(); i++) {
+            if (RayHit(from[i], to[i], results[i]))
+                num_hits++;
+        }
+        return num_hits;
+    }
+
     /// Class to be used as a callback interface for user-defined visualization of collision shapes.
     class ChApi VisualizationCallback {
       public:
@@ -201,6 +220,12 @@ class ChApi ChCollisionSystem {
     /// should implement a no-op if a visualization callback was not specified.
     virtual void Visualize(int flags) {}
 
+    /// Write the internal state carried over between collision detection passes (if any) to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const {}
+
+    /// Read the internal state carried over between collision detection passes (if any) from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) {}
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) {
         // version number
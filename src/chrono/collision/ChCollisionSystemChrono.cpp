@@ -17,6 +17,9 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <iterator>
+
 #include "chrono/physics/ChSystem.h"
 #include "chrono/collision/ChCollisionSystemChrono.h"
 #include "chrono/collision/chrono/ChRayTest.h"
@@ -24,7 +27,8 @@
 namespace chrono {
 namespace collision {
 
-ChCollisionSystemChrono::ChCollisionSystemChrono() : use_aabb_active(false) {
+ChCollisionSystemChrono::ChCollisionSystemChrono()
+    : use_aabb_active(false), use_persistence(false), use_incremental(false), m_prev_num_shapes(0) {
     // Create the shared data structure with own state data
     cd_data = chrono_types::make_shared<ChCollisionData>(true);
     cd_data->collision_envelope = ChCollisionModel::GetDefaultSuggestedEnvelope();
@@ -56,6 +60,10 @@ void ChCollisionSystemChrono::SetBroadphaseGridDensity(double density) {
     broadphase.grid_type = ChBroadphase::GridType::FIXED_DENSITY;
 }
 
+void ChCollisionSystemChrono::SetBroadphaseMethod(ChBroadphase::Method method) {
+    broadphase.method = method;
+}
+
 void ChCollisionSystemChrono::SetNarrowphaseAlgorithm(ChNarrowphase::Algorithm algorithm) {
     narrowphase.algorithm = algorithm;
 }
@@ -67,6 +75,26 @@ void ChCollisionSystemChrono::EnableActiveBoundingBox(const ChVector<>& aabb_min
     use_aabb_active = true;
 }
 
+void ChCollisionSystemChrono::EnableContactPersistence(bool val) {
+    use_persistence = val;
+    if (!val)
+        Clear();
+}
+
+void ChCollisionSystemChrono::EnableIncrementalCollision(bool val) {
+    use_incremental = val;
+    broadphase.incremental = val;
+    broadphase.grid_valid = false;
+    m_separated.clear();
+}
+
+void ChCollisionSystemChrono::Clear() {
+    m_persistent.clear();
+    m_persistent_sorted.clear();
+    broadphase.grid_valid = false;
+    m_separated.clear();
+}
+
 void ChCollisionSystemChrono::SetNumThreads(int nthreads) {
 #ifdef _OPENMP
     omp_set_num_threads(nthreads);
@@ -374,10 +402,85 @@ void ChCollisionSystemChrono::Run() {
 
     // Narrowphase
     m_timer_narrow.start();
+    bool filter_pairs = use_incremental && cd_data->num_rigid_shapes > 0;
+    if (filter_pairs)
+        FilterSeparatedPairs();
     narrowphase.Process();
+    if (filter_pairs)
+        UpdateSeparatedPairs();
     m_timer_narrow.stop();
 }
 
+void ChCollisionSystemChrono::FilterSeparatedPairs() {
+    const std::vector<real3>& pos = *cd_data->state_data.pos_rigid;
+    const std::vector<quaternion>& rot = *cd_data->state_data.rot_rigid;
+    const std::vector<uint>& id_rigid = cd_data->shape_data.id_rigid;
+    int nbodies = (int)cd_data->state_data.num_rigid_bodies;
+
+    // Flag the bodies which moved since the previous collision detection (all bodies, if the number of bodies or
+    // shapes changed)
+    m_moved.resize(nbodies);
+    if ((int)m_prev_pos.size() != nbodies || m_prev_num_shapes != cd_data->num_rigid_shapes) {
+        std::fill(m_moved.begin(), m_moved.end(), 1);
+        m_separated.clear();
+    } else {
+#pragma omp parallel for
+        for (int i = 0; i < nbodies; i++) {
+            const real3& p = m_prev_pos[i];
+            const quaternion& q = m_prev_rot[i];
+            m_moved[i] = (p.x != pos[i].x || p.y != pos[i].y || p.z != pos[i].z ||  //
+                          q.w != rot[i].w || q.x != rot[i].x || q.y != rot[i].y || q.z != rot[i].z);
+        }
+    }
+
+    // Keep the full list of candidate pairs and pass to the narrowphase only pairs which must be checked
+    m_pairs.swap(cd_data->pair_shapeIDs);
+    m_pairs.resize(cd_data->num_rigid_contacts);
+
+    std::vector<long long>& pairs = cd_data->pair_shapeIDs;
+    pairs.clear();
+    m_skipped_pairs.clear();
+    for (auto pair : m_pairs) {
+        uint b1 = id_rigid[int(pair >> 32)];
+        uint b2 = id_rigid[int(pair & 0xffffffff)];
+        if (!m_moved[b1] && !m_moved[b2] && std::binary_search(m_separated.begin(), m_separated.end(), pair))
+            m_skipped_pairs.push_back(pair);
+        else
+            pairs.push_back(pair);
+    }
+
+    cd_data->num_rigid_contacts = (uint)pairs.size();
+}
+
+void ChCollisionSystemChrono::UpdateSeparatedPairs() {
+    // Pairs checked by the narrowphase which produced no contacts
+    std::vector<long long>& checked = cd_data->pair_shapeIDs;
+    std::sort(checked.begin(), checked.end());
+
+    std::vector<long long> in_contact(cd_data->contact_shapeIDs.begin(),
+                                      cd_data->contact_shapeIDs.begin() + cd_data->num_rigid_contacts);
+    std::sort(in_contact.begin(), in_contact.end());
+    in_contact.erase(std::unique(in_contact.begin(), in_contact.end()), in_contact.end());
+
+    m_separated.clear();
+    std::set_difference(checked.begin(), checked.end(), in_contact.begin(), in_contact.end(),
+                        std::back_inserter(m_separated));
+
+    // Skipped pairs are still separated
+    std::sort(m_skipped_pairs.begin(), m_skipped_pairs.end());
+    size_t n = m_separated.size();
+    m_separated.insert(m_separated.end(), m_skipped_pairs.begin(), m_skipped_pairs.end());
+    std::inplace_merge(m_separated.begin(), m_separated.begin() + n, m_separated.end());
+
+    // Restore the full list of candidate pairs
+    cd_data->pair_shapeIDs.swap(m_pairs);
+
+    // Record current body states
+    m_prev_pos = *cd_data->state_data.pos_rigid;
+    m_prev_rot = *cd_data->state_data.rot_rigid;
+    m_prev_num_shapes = cd_data->num_rigid_shapes;
+}
+
 // -----------------------------------------------------------------------------
 
 void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
@@ -392,6 +495,10 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
     const auto& sids = cd_data->contact_shapeIDs;          // global IDs of shapes in contact
     const auto& sindex = cd_data->shape_data.local_rigid;  // collision model indexes of shapes in contact
 
+    // Match current contacts with the contacts at the previous step
+    if (use_persistence)
+        UpdatePersistentContacts();
+
     // Loop over all current contacts, create the cinfo structure and add contact to the container.
     // Note that inclusions in the contact container cannot be done in parallel.
     for (uint i = 0; i < cd_data->num_rigid_contacts; i++) {
@@ -412,6 +519,8 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
         cinfo.vpB = ToChVector(cd_data->cptb_rigid_rigid[i]);
         cinfo.distance = cd_data->dpth_rigid_rigid[i];
         cinfo.eff_radius = cd_data->erad_rigid_rigid[i];
+        if (use_persistence)
+            cinfo.reaction_cache = m_persistent[i].reactions;
 
         // Execute user custom callback, if any
         bool add_contact = true;
@@ -425,6 +534,33 @@ void ChCollisionSystemChrono::ReportContacts(ChContactContainer* container) {
     container->EndAddContact();
 }
 
+void ChCollisionSystemChrono::UpdatePersistentContacts() {
+    // The reactions of the previous contacts are final at this point (they were updated by the contacts when
+    // scattering the solution). Sort them for look-up.
+    m_persistent_sorted.swap(m_persistent);
+    std::sort(m_persistent_sorted.begin(), m_persistent_sorted.end());
+
+    // Contacts between the same pair of shapes are always consecutive in the narrowphase output
+    const auto& sids = cd_data->contact_shapeIDs;
+    const int num_contacts = (int)cd_data->num_rigid_contacts;
+    m_persistent.resize(num_contacts);
+    for (int i = 0; i < num_contacts; i++) {
+        m_persistent[i].shape_pair = sids[i];
+        m_persistent[i].index = (i > 0 && sids[i] == sids[i - 1]) ? m_persistent[i - 1].index + 1 : 0;
+    }
+
+    // Initialize reactions from the matching previous contacts, if any
+#pragma omp parallel for
+    for (int i = 0; i < num_contacts; i++) {
+        auto& contact = m_persistent[i];
+        auto prev = std::lower_bound(m_persistent_sorted.begin(), m_persistent_sorted.end(), contact);
+        if (prev != m_persistent_sorted.end() && prev->shape_pair == contact.shape_pair && prev->index == contact.index)
+            std::copy(prev->reactions, prev->reactions + 6, contact.reactions);
+        else
+            std::fill(contact.reactions, contact.reactions + 6, 0.0f);
+    }
+}
+
 // -----------------------------------------------------------------------------
 
 static void ComputeAABBSphere(const real& radius,
@@ -615,6 +751,19 @@ void ChCollisionSystemChrono::GetOverlappingAABB(std::vector<char>& active_id, r
     }
 }
 
+void ChCollisionSystemChrono::CheckpointOut(ChCheckpointOut& cp) const {
+    cp.WriteArray(m_persistent);
+}
+
+void ChCollisionSystemChrono::CheckpointIn(ChCheckpointIn& cp) {
+    cp.ReadArray(m_persistent);
+    m_persistent_sorted.clear();
+    m_prev_pos.clear();
+    m_separated.clear();
+}
+
+// -----------------------------------------------------------------------------
+
 std::vector<vec2> ChCollisionSystemChrono::GetOverlappingPairs() {
     std::vector<vec2> pairs;
     pairs.resize(cd_data->pair_shapeIDs.size());
@@ -662,6 +811,50 @@ bool ChCollisionSystemChrono::RayHit(const ChVector<>& from,
     return false;
 }
 
+int ChCollisionSystemChrono::RayHitBatch(const std::vector<ChVector<>>& from,
+                                         const std::vector<ChVector<>>& to,
+                                         std::vector<ChRayhitResult>& results) const {
+    assert(from.size() == to.size());
+    size_t num_rays = from.size();
+    results.resize(num_rays);
+    for (auto& result : results)
+        result.hit = false;
+
+    if (cd_data->num_active_bins == 0)
+        return 0;
+
+    std::vector<real3> start(num_rays);
+    std::vector<real3> end(num_rays);
+    for (size_t i = 0; i < num_rays; i++) {
+        start[i] = FromChVector(from[i]);
+        end[i] = FromChVector(to[i]);
+    }
+
+    int nthreads = m_system->GetNumthreadsCollision();
+
+    ChRayTest tester(cd_data);
+    std::vector<ChRayTest::RayHitInfo> info;
+    std::vector<char> hit;
+    int num_hits = tester.CheckBatch(start, end, info, hit, nthreads);
+
+    const auto& bodies = m_system->Get_bodylist();
+    for (size_t i = 0; i < num_rays; i++) {
+        if (!hit[i])
+            continue;
+        auto& result = results[i];
+        result.hit = true;
+        result.abs_hitNormal = ToChVector(info[i].normal);
+        result.abs_hitPoint = ToChVector(info[i].point);
+        result.dist_factor = info[i].t;
+
+        // Collision model of the body carrying the closest hit shape
+        uint bid = cd_data->shape_data.id_rigid[info[i].shapeID];
+        result.hitModel = bodies[bid]->GetCollisionModel().get();
+    }
+
+    return num_hits;
+}
+
 // -----------------------------------------------------------------------------
 
 void DrawHemisphere(ChCollisionSystem::VisualizationCallback* vis,
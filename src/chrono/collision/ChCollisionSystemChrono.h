@@ -67,6 +67,12 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// By default, a fixed number of bins is used (see SetBroadphaseGridResolution).
     void SetBroadphaseGridDensity(double density);
 
+    /// Set the broadphase algorithm (default: ChBroadphase::Method::GRID).
+    /// The BVH broadphase refits a bounding volume hierarchy of the shape AABBs at each step and rebuilds it only when
+    /// its quality degrades. It is better suited than the uniform grid for scenes mixing very large and very small
+    /// collision shapes (e.g., a large terrain mesh with small debris). The grid settings are ignored with this method.
+    void SetBroadphaseMethod(ChBroadphase::Method method);
+
     /// Set the narrowphase algorithm (default: ChNarrowphase::Algorithm::HYBRID).
     /// The Chrono collision detection system provides several analytical collision detection algorithms, for particular
     /// pairs of shapes (see ChNarrowphasePRIMS). For general convex shapes, the collision system relies on the
@@ -78,12 +84,29 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// The size of the bounding box is specified by its min and max extents.
     void EnableActiveBoundingBox(const ChVector<>& aabb_min, const ChVector<>& aabb_max);
 
+    /// Enable persistence of contact reactions across steps (default: false).
+    /// If enabled, the reactions computed for each contact (normal and tangential forces, as well as rolling and
+    /// spinning torques) are cached and used to warm start the matching contact at the next step. Contacts are matched
+    /// by the IDs of the pair of collision shapes in contact, so this does not depend on the order in which contacts are
+    /// reported. Multiple contacts between the same pair of shapes are matched in the order produced by the
+    /// narrowphase. Only relevant for NSC contacts, with an iterative solver with warm start enabled.
+    void EnableContactPersistence(bool val);
+
+    /// Enable incremental broadphase and narrowphase collision detection (default: false).
+    /// If enabled, the broadphase grid is kept from step to step (it is rebuilt only if the number of collision shapes
+    /// changes or if a shape leaves the grid) and only shapes whose AABB moved to a different set of grid bins are
+    /// re-binned. In addition, candidate pairs of shapes which were found to be separated at the previous step are not
+    /// passed to the narrowphase if the bodies owning both shapes did not move since. This is beneficial for scenes
+    /// with many static or sleeping bodies. With this option, the grid resolution is only re-evaluated when the grid
+    /// is rebuilt.
+    void EnableIncrementalCollision(bool val);
+
     /// Get the dimensions of the "active" box.
     /// The return value indicates whether or not the active box feature is enabled.
     bool GetActiveBoundingBox(ChVector<>& aabb_min, ChVector<>& aabb_max) const;
 
     /// Clear all data instanced by this algorithm if any (like persistent contact manifolds).
-    virtual void Clear(void) override {}
+    virtual void Clear(void) override;
 
     /// Add a collision model to the collision engine.
     virtual void Add(ChCollisionModel* model) override;
@@ -136,6 +159,15 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
                         ChCollisionModel* model,
                         ChRayhitResult& result) const override;
 
+    /// Perform ray-hit tests for a batch of rays with all collision models.
+    /// Consecutive rays are grouped in packets which traverse the broadphase together (see ChRayTest::CheckBatch) and
+    /// packets are processed in parallel, using the number of collision threads of the associated system. Packet
+    /// traversal is most efficient if consecutive rays are coherent (e.g., nearly parallel rays cast from neighboring
+    /// points). The results are identical to those obtained by calling RayHit() for each ray.
+    virtual int RayHitBatch(const std::vector<ChVector<>>& from,
+                            const std::vector<ChVector<>>& to,
+                            std::vector<ChRayhitResult>& results) const override;
+
     /// Method to trigger debug visualization of collision shapes.
     /// The 'flags' argument can be any of the VisualizationModes enums, or a combination thereof (using bit-wise
     /// operators). The calling program must invoke this function from within the simulation loop. No-op if a
@@ -145,6 +177,13 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
     /// Return the pairs of IDs for overlapping contact shapes.
     virtual std::vector<vec2> GetOverlappingPairs();
 
+    /// Write the cached contact reactions (used for warm starting) to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const override;
+
+    /// Read the cached contact reactions (used for warm starting) from a binary checkpoint.
+    /// The incremental collision detection cache is invalidated.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
   protected:
     /// Mark bodies whose AABB is contained within the specified box.
     virtual void GetOverlappingAABB(std::vector<char>& active_id, real3 Amin, real3 Amax);
@@ -174,6 +213,40 @@ class ChApi ChCollisionSystemChrono : public ChCollisionSystem {
 
     ChTimer m_timer_broad;
     ChTimer m_timer_narrow;
+
+    /// Persistent reactions for one contact between a pair of collision shapes.
+    struct PersistentContact {
+        long long shape_pair;  ///< IDs of the two shapes in contact (encoded as in ChCollisionData::contact_shapeIDs)
+        int index;             ///< index of this contact among all contacts between the same two shapes
+        float reactions[6];    ///< N,U,V reactions and rolling/spinning reactions
+
+        bool operator<(const PersistentContact& other) const {
+            return shape_pair < other.shape_pair || (shape_pair == other.shape_pair && index < other.index);
+        }
+    };
+
+    /// Set the reaction cache pointers for all current contacts, initialized from the matching previous contacts.
+    void UpdatePersistentContacts();
+
+    bool use_persistence;                                ///< carry over contact reactions from step to step
+    std::vector<PersistentContact> m_persistent;         ///< reactions of current contacts (in contact order)
+    std::vector<PersistentContact> m_persistent_sorted;  ///< reactions of previous contacts (sorted by key)
+
+    /// Remove from the list of candidate pairs those pairs which were separated at the previous step and for which
+    /// neither body moved since.
+    void FilterSeparatedPairs();
+
+    /// Record the candidate pairs which did not produce any contact, as well as the current body states.
+    void UpdateSeparatedPairs();
+
+    bool use_incremental;                    ///< incremental broadphase and narrowphase
+    std::vector<long long> m_pairs;          ///< all candidate pairs from the broadphase
+    std::vector<long long> m_skipped_pairs;  ///< separated pairs not passed to the narrowphase
+    std::vector<long long> m_separated;      ///< pairs without contacts at the previous step (sorted)
+    std::vector<real3> m_prev_pos;           ///< body positions at previous collision detection
+    std::vector<quaternion> m_prev_rot;      ///< body rotations at previous collision detection
+    uint m_prev_num_shapes;                  ///< number of shapes at previous collision detection
+    std::vector<char> m_moved;               ///< flags for bodies that moved since previous collision detection
 };
 
 /// @} collision_mc
@@ -35,10 +35,17 @@ namespace collision {
 using namespace chrono::collision::ch_utils;
 
 ChBroadphase::ChBroadphase()
-    : grid_type(GridType::FIXED_RESOLUTION),
+    : method(Method::GRID),
+      grid_type(GridType::FIXED_RESOLUTION),
       grid_resolution(vec3(10, 10, 10)),
       bin_size(real3(1, 1, 1)),
       grid_density(5),
+      incremental(false),
+      grid_valid(false),
+      num_rebuilds(0),
+      num_rebinned(0),
+      bvh_rebuild_ratio(2),
+      bvh_build_cost(0),
       cd_data(nullptr) {}
 
 // -----------------------------------------------------------------------------
@@ -211,6 +218,22 @@ void ChBroadphase::ComputeTopLevelResolution() {
 
 // Use spatial subdivision to detect the list of POSSIBLE collisions
 void ChBroadphase::Process() {
+    // The rigid-fluid narrowphase relies on the broadphase grid
+    if (method == Method::BVH && cd_data->state_data.num_fluid_bodies == 0) {
+        ProcessBVH();
+        return;
+    }
+
+    cd_data->use_bvh = false;
+
+    if (incremental) {
+        ProcessIncremental();
+        return;
+    }
+
+    num_rebuilds++;
+    num_rebinned = cd_data->num_rigid_shapes;
+
     // Compute overall AABB and then offset all AABBs
     DetermineBoundingBox();
     OffsetAABB();
@@ -227,30 +250,19 @@ void ChBroadphase::Process() {
 
 void ChBroadphase::OneLevelBroadphase() {
     const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
-    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
-
-    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
-    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
 
     const std::vector<real3>& aabb_min = cd_data->aabb_min;
     const std::vector<real3>& aabb_max = cd_data->aabb_max;
-    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
     std::vector<uint>& bin_intersections = cd_data->bin_intersections;
     std::vector<uint>& bin_number = cd_data->bin_number;
     std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
-    std::vector<uint>& bin_active = cd_data->bin_active;
-    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
-    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
-    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
 
     const int num_shapes = cd_data->num_rigid_shapes;
 
     const vec3& bins_per_axis = cd_data->bins_per_axis;
     const real3& inv_bin_size = cd_data->inv_bin_size;
     uint& num_bins = cd_data->num_bins;
-    uint& num_active_bins = cd_data->num_active_bins;
     uint& num_bin_aabb_intersections = cd_data->num_bin_aabb_intersections;
-    uint& num_possible_collisions = cd_data->num_possible_collisions;
 
     num_bins = bins_per_axis.x * bins_per_axis.y * bins_per_axis.z;
 
@@ -273,8 +285,6 @@ void ChBroadphase::OneLevelBroadphase() {
 
     bin_number.resize(num_bin_aabb_intersections);
     bin_aabb_number.resize(num_bin_aabb_intersections);
-    bin_active.resize(num_bin_aabb_intersections);       // will be resized after calculation of num_active_bins
-    bin_start_index.resize(num_bin_aabb_intersections);  // will be resized after calculation of num_active_bins
 
     // For each shape, store the bin index and the shape ID for intersections with this shape 
 #pragma omp parallel for
@@ -285,8 +295,40 @@ void ChBroadphase::OneLevelBroadphase() {
                                       bin_aabb_number);
     }
 
-    // Find the number of active bins (i.e. with at least one shape AABB intersection)
+    // Sort the bin - shape AABB intersections by bin index
     Thrust_Sort_By_Key(bin_number, bin_aabb_number);
+
+    FindCandidatePairs();
+}
+
+void ChBroadphase::FindCandidatePairs() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    std::vector<uint>& bin_active = cd_data->bin_active;
+    std::vector<uint>& bin_start_index = cd_data->bin_start_index;
+    std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+    std::vector<uint>& bin_num_contact = cd_data->bin_num_contact;
+
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const real3& inv_bin_size = cd_data->inv_bin_size;
+    const uint num_bins = cd_data->num_bins;
+    uint& num_active_bins = cd_data->num_active_bins;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    // Input: list of bin - shape AABB intersections, sorted by bin index
+    bin_active.resize(bin_number.size());       // will be resized after calculation of num_active_bins
+    bin_start_index.resize(bin_number.size());  // will be resized after calculation of num_active_bins
+
+    // Find the number of active bins (i.e. with at least one shape AABB intersection)
     num_active_bins = (int)(Run_Length_Encode(bin_number, bin_active, bin_start_index));
 
     if (num_active_bins <= 0) {
@@ -344,5 +386,465 @@ void ChBroadphase::OneLevelBroadphase() {
     }
 }
 
+// -----------------------------------------------------------------------------
+// Incremental broadphase.
+// The grid (origin, resolution, and bin size) is kept from step to step and the sorted list of bin - shape AABB
+// intersections is only updated for shapes whose AABB moved to a different range of bins. The grid is rebuilt from
+// scratch if the number of shapes changes or if a shape AABB leaves the grid.
+
+// Compute the range of bins intersected by the AABB of each shape, relative to the specified grid origin.
+// Shapes which cannot collide (inactive shapes and shapes of non-colliding bodies) are assigned an empty range.
+// Return the number of shapes whose AABB is not contained in the grid.
+static int ComputeBinRanges(const ChCollisionData& cd,
+                            const real3& origin,
+                            std::vector<vec3>& bin_min,
+                            std::vector<vec3>& bin_max) {
+    const std::vector<uint>& obj_data_id = cd.shape_data.id_rigid;
+    const std::vector<char>& obj_collide = *cd.state_data.collide_rigid;
+    const std::vector<real3>& aabb_min = cd.aabb_min;
+    const std::vector<real3>& aabb_max = cd.aabb_max;
+    const vec3& bins_per_axis = cd.bins_per_axis;
+    const real3& inv_bin_size = cd.inv_bin_size;
+    const int num_shapes = cd.num_rigid_shapes;
+
+    bin_min.resize(num_shapes);
+    bin_max.resize(num_shapes);
+
+    int num_outside = 0;
+
+#pragma omp parallel for reduction(+ : num_outside)
+    for (int i = 0; i < num_shapes; i++) {
+        uint id = obj_data_id[i];
+        if (id == UINT_MAX || obj_collide[id] == 0) {
+            bin_min[i] = vec3(0, 0, 0);
+            bin_max[i] = vec3(-1, -1, -1);
+            continue;
+        }
+        vec3 gmin = HashMin(aabb_min[i] - origin, inv_bin_size);
+        vec3 gmax = HashMax(aabb_max[i] - origin, inv_bin_size);
+        if (gmin.x < 0 || gmin.y < 0 || gmin.z < 0 ||                                        //
+            gmax.x >= bins_per_axis.x || gmax.y >= bins_per_axis.y || gmax.z >= bins_per_axis.z) {
+            num_outside++;
+        }
+        bin_min[i] = gmin;
+        bin_max[i] = gmax;
+    }
+
+    return num_outside;
+}
+
+// Number of bins in the given bin range.
+static inline uint NumBins(const vec3& gmin, const vec3& gmax) {
+    return (gmax.x - gmin.x + 1) * (gmax.y - gmin.y + 1) * (gmax.z - gmin.z + 1);
+}
+
+// Check whether two bin coordinates are identical.
+static inline bool SameBin(const vec3& a, const vec3& b) {
+    return a.x == b.x && a.y == b.y && a.z == b.z;
+}
+
+void ChBroadphase::ProcessIncremental() {
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    if (num_shapes == 0) {
+        grid_valid = false;
+        DetermineBoundingBox();
+        ComputeTopLevelResolution();
+        return;
+    }
+
+    // Check whether the persistent grid can be used (all shape AABBs within the grid)
+    bool rebuild = !grid_valid || (int)shape_bin_min.size() != num_shapes;
+    if (!rebuild)
+        rebuild = ComputeBinRanges(*cd_data, cd_data->global_origin, new_bin_min, new_bin_max) > 0;
+
+    if (rebuild) {
+        // Set up a new grid and bin all shapes
+        DetermineBoundingBox();
+        ComputeTopLevelResolution();
+        cd_data->num_bins = cd_data->bins_per_axis.x * cd_data->bins_per_axis.y * cd_data->bins_per_axis.z;
+        ComputeBinRanges(*cd_data, cd_data->global_origin, shape_bin_min, shape_bin_max);
+        OffsetAABB();
+        RebuildBins();
+        grid_valid = true;
+        num_rebuilds++;
+        num_rebinned = num_shapes;
+    } else {
+        // Re-bin only the shapes which moved to a different range of bins
+        OffsetAABB();
+        rebinned.clear();
+        for (int i = 0; i < num_shapes; i++) {
+            if (!SameBin(new_bin_min[i], shape_bin_min[i]) || !SameBin(new_bin_max[i], shape_bin_max[i]))
+                rebinned.push_back(i);
+        }
+        if (!rebinned.empty())
+            UpdateBins();
+        num_rebinned = (int)rebinned.size();
+    }
+
+    FindCandidatePairs();
+    cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
+}
+
+void ChBroadphase::RebuildBins() {
+    std::vector<uint>& bin_intersections = cd_data->bin_intersections;
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    bin_intersections.resize(num_shapes + 1);
+    bin_intersections[num_shapes] = 0;
+
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        bin_intersections[i] = NumBins(shape_bin_min[i], shape_bin_max[i]);
+    }
+
+    Thrust_Exclusive_Scan(bin_intersections);
+    cd_data->num_bin_aabb_intersections = bin_intersections.back();
+
+    bin_number.resize(cd_data->num_bin_aabb_intersections);
+    bin_aabb_number.resize(cd_data->num_bin_aabb_intersections);
+
+#pragma omp parallel for
+    for (int index = 0; index < num_shapes; index++) {
+        const vec3& gmin = shape_bin_min[index];
+        const vec3& gmax = shape_bin_max[index];
+        uint count = bin_intersections[index];
+        for (int i = gmin.x; i <= gmax.x; i++) {
+            for (int j = gmin.y; j <= gmax.y; j++) {
+                for (int k = gmin.z; k <= gmax.z; k++) {
+                    bin_number[count] = Hash_Index(vec3(i, j, k), bins_per_axis);
+                    bin_aabb_number[count] = index;
+                    count++;
+                }
+            }
+        }
+    }
+
+    Thrust_Sort_By_Key(bin_number, bin_aabb_number);
+}
+
+void ChBroadphase::UpdateBins() {
+    std::vector<uint>& bin_number = cd_data->bin_number;
+    std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    std::vector<char> flag(num_shapes, 0);
+    for (auto i : rebinned)
+        flag[i] = 1;
+
+    // Bin - shape AABB intersections for the re-binned shapes, sorted by bin index
+    std::vector<uint> new_number;
+    std::vector<uint> new_aabb_number;
+    for (auto index : rebinned) {
+        shape_bin_min[index] = new_bin_min[index];
+        shape_bin_max[index] = new_bin_max[index];
+        const vec3& gmin = shape_bin_min[index];
+        const vec3& gmax = shape_bin_max[index];
+        for (int i = gmin.x; i <= gmax.x; i++) {
+            for (int j = gmin.y; j <= gmax.y; j++) {
+                for (int k = gmin.z; k <= gmax.z; k++) {
+                    new_number.push_back(Hash_Index(vec3(i, j, k), bins_per_axis));
+                    new_aabb_number.push_back(index);
+                }
+            }
+        }
+    }
+    Thrust_Sort_By_Key(new_number, new_aabb_number);
+
+    // Merge the new intersections with the (still sorted) intersections of all other shapes
+    std::vector<uint> merged_number;
+    std::vector<uint> merged_aabb_number;
+    merged_number.reserve(bin_number.size() + new_number.size());
+    merged_aabb_number.reserve(bin_number.size() + new_number.size());
+
+    size_t i_old = 0;
+    size_t i_new = 0;
+    while (i_old < bin_number.size() || i_new < new_number.size()) {
+        if (i_old < bin_number.size() && flag[bin_aabb_number[i_old]]) {
+            i_old++;
+            continue;
+        }
+        if (i_new == new_number.size() || (i_old < bin_number.size() && bin_number[i_old] <= new_number[i_new])) {
+            merged_number.push_back(bin_number[i_old]);
+            merged_aabb_number.push_back(bin_aabb_number[i_old]);
+            i_old++;
+        } else {
+            merged_number.push_back(new_number[i_new]);
+            merged_aabb_number.push_back(new_aabb_number[i_new]);
+            i_new++;
+        }
+    }
+
+    bin_number.swap(merged_number);
+    bin_aabb_number.swap(merged_aabb_number);
+    cd_data->num_bin_aabb_intersections = (uint)bin_number.size();
+}
+
+// -----------------------------------------------------------------------------
+// BVH broadphase.
+// A binary tree of shape AABBs is built by recursive median splits along the longest axis of the shape centroids.
+// At each call, the node AABBs are refit bottom-up to the current shape AABBs and the tree is rebuilt only if the set
+// of colliding shapes changed or if the tree quality degraded (sum of internal node surface areas grew by more than
+// 'bvh_rebuild_ratio' since the last build). Unlike the grid, the BVH adapts to scenes mixing very large and very
+// small shapes.
+
+// Maximum number of shapes in a BVH leaf.
+static const int BVH_LEAF_SIZE = 4;
+
+// Maximum depth of a BVH traversal stack (median splits guarantee a depth of at most log2(num_rigid_shapes) + 1).
+static const int BVH_STACK_SIZE = 64;
+
+// Surface area of the specified AABB.
+static inline real SurfaceArea(const real3& bmin, const real3& bmax) {
+    real3 d = bmax - bmin;
+    return 2 * (d.x * d.y + d.y * d.z + d.z * d.x);
+}
+
+// Traverse the BVH and invoke the specified operation for all shapes with a larger ID than 'shapeA' and with an AABB
+// overlapping the AABB of 'shapeA'.
+template <typename Op>
+static void TraverseBVH(const ChCollisionData& cd, uint shapeA, Op op) {
+    const std::vector<real3>& aabb_min = cd.aabb_min;
+    const std::vector<real3>& aabb_max = cd.aabb_max;
+    const real3& Amin = aabb_min[shapeA];
+    const real3& Amax = aabb_max[shapeA];
+
+    int stack[BVH_STACK_SIZE];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        int n = stack[--top];
+        if (!overlap(Amin, Amax, cd.bvh_min[n], cd.bvh_max[n]))
+            continue;
+        const vec2& node = cd.bvh_node[n];
+        if (node.y == 0) {
+            stack[top++] = node.x;
+            stack[top++] = node.x + 1;
+            continue;
+        }
+        for (int i = node.x; i < node.x + node.y; i++) {
+            uint shapeB = cd.bvh_shapes[i];
+            if (shapeB > shapeA && overlap(Amin, Amax, aabb_min[shapeB], aabb_max[shapeB]))
+                op(shapeB);
+        }
+    }
+}
+
+void ChBroadphase::ProcessBVH() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<char>& obj_collide = *cd_data->state_data.collide_rigid;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    cd_data->use_bvh = true;
+    cd_data->num_active_bins = 0;
+    grid_valid = false;
+
+    // Compute overall AABB and then offset all AABBs
+    DetermineBoundingBox();
+    OffsetAABB();
+
+    if (num_shapes == 0) {
+        cd_data->bvh_node.clear();
+        cd_data->num_possible_collisions = 0;
+        return;
+    }
+
+    // Flag the shapes which can collide (active shapes on colliding bodies)
+    std::vector<char> included(num_shapes);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        uint id = obj_data_id[i];
+        included[i] = (id != UINT_MAX && obj_collide[id] != 0);
+    }
+
+    // Refit the current BVH, unless the set of shapes changed
+    bool rebuild = cd_data->bvh_node.empty() || included != bvh_included;
+    if (!rebuild) {
+        RefitBVH();
+        rebuild = CostBVH() > bvh_rebuild_ratio * bvh_build_cost;
+    }
+
+    if (rebuild) {
+        bvh_included.swap(included);
+        BuildBVH();
+        RefitBVH();
+        bvh_build_cost = CostBVH();
+        num_rebuilds++;
+    }
+
+    FindCandidatePairsBVH();
+    cd_data->num_rigid_contacts = cd_data->num_possible_collisions;
+}
+
+void ChBroadphase::BuildBVH() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    std::vector<vec2>& bvh_node = cd_data->bvh_node;
+    std::vector<uint>& bvh_shapes = cd_data->bvh_shapes;
+    const int num_shapes = cd_data->num_rigid_shapes;
+
+    bvh_shapes.clear();
+    for (int i = 0; i < num_shapes; i++) {
+        if (bvh_included[i])
+            bvh_shapes.push_back(i);
+    }
+
+    bvh_node.clear();
+    if (bvh_shapes.empty())
+        return;
+
+    std::vector<real3> centroid(num_shapes);
+#pragma omp parallel for
+    for (int i = 0; i < num_shapes; i++) {
+        centroid[i] = 0.5 * (aabb_min[i] + aabb_max[i]);
+    }
+
+    // Top-down construction. Children of an internal node are stored consecutively, after their parent.
+    struct Range {
+        int node;
+        int start;
+        int end;
+    };
+    std::vector<Range> ranges;
+    bvh_node.push_back(vec2(0, 0));
+    ranges.push_back({0, 0, (int)bvh_shapes.size()});
+
+    while (!ranges.empty()) {
+        Range r = ranges.back();
+        ranges.pop_back();
+
+        if (r.end - r.start <= BVH_LEAF_SIZE) {
+            bvh_node[r.node] = vec2(r.start, r.end - r.start);
+            continue;
+        }
+
+        // Split at the median along the longest axis of the centroid bounds
+        real3 cmin(+C_REAL_MAX);
+        real3 cmax(-C_REAL_MAX);
+        for (int i = r.start; i < r.end; i++) {
+            cmin = Min(cmin, centroid[bvh_shapes[i]]);
+            cmax = Max(cmax, centroid[bvh_shapes[i]]);
+        }
+        real3 extent = cmax - cmin;
+        int axis = (extent.x > extent.y) ? (extent.x > extent.z ? 0 : 2) : (extent.y > extent.z ? 1 : 2);
+
+        int mid = (r.start + r.end) / 2;
+        std::nth_element(bvh_shapes.begin() + r.start, bvh_shapes.begin() + mid, bvh_shapes.begin() + r.end,
+                         [&centroid, axis](uint a, uint b) { return centroid[a][axis] < centroid[b][axis]; });
+
+        int child = (int)bvh_node.size();
+        bvh_node[r.node] = vec2(child, 0);
+        bvh_node.push_back(vec2(0, 0));
+        bvh_node.push_back(vec2(0, 0));
+        ranges.push_back({child, r.start, mid});
+        ranges.push_back({child + 1, mid, r.end});
+    }
+
+    cd_data->bvh_min.resize(bvh_node.size());
+    cd_data->bvh_max.resize(bvh_node.size());
+}
+
+void ChBroadphase::RefitBVH() {
+    const std::vector<real3>& aabb_min = cd_data->aabb_min;
+    const std::vector<real3>& aabb_max = cd_data->aabb_max;
+    const std::vector<vec2>& bvh_node = cd_data->bvh_node;
+    const std::vector<uint>& bvh_shapes = cd_data->bvh_shapes;
+    std::vector<real3>& bvh_min = cd_data->bvh_min;
+    std::vector<real3>& bvh_max = cd_data->bvh_max;
+    const int num_nodes = (int)bvh_node.size();
+
+    // Leaves
+#pragma omp parallel for
+    for (int n = 0; n < num_nodes; n++) {
+        const vec2& node = bvh_node[n];
+        if (node.y == 0)
+            continue;
+        real3 bmin(+C_REAL_MAX);
+        real3 bmax(-C_REAL_MAX);
+        for (int i = node.x; i < node.x + node.y; i++) {
+            bmin = Min(bmin, aabb_min[bvh_shapes[i]]);
+            bmax = Max(bmax, aabb_max[bvh_shapes[i]]);
+        }
+        bvh_min[n] = bmin;
+        bvh_max[n] = bmax;
+    }
+
+    // Internal nodes, bottom-up (children always follow their parent)
+    for (int n = num_nodes - 1; n >= 0; n--) {
+        const vec2& node = bvh_node[n];
+        if (node.y != 0)
+            continue;
+        bvh_min[n] = Min(bvh_min[node.x], bvh_min[node.x + 1]);
+        bvh_max[n] = Max(bvh_max[node.x], bvh_max[node.x + 1]);
+    }
+}
+
+real ChBroadphase::CostBVH() const {
+    const std::vector<vec2>& bvh_node = cd_data->bvh_node;
+    real cost = 0;
+    for (size_t n = 0; n < bvh_node.size(); n++) {
+        if (bvh_node[n].y == 0)
+            cost += SurfaceArea(cd_data->bvh_min[n], cd_data->bvh_max[n]);
+    }
+    return cost;
+}
+
+void ChBroadphase::FindCandidatePairsBVH() {
+    const std::vector<uint>& obj_data_id = cd_data->shape_data.id_rigid;
+    const std::vector<short2>& fam_data = cd_data->shape_data.fam_rigid;
+    const std::vector<char>& obj_active = *cd_data->state_data.active_rigid;
+    const std::vector<uint>& bvh_shapes = cd_data->bvh_shapes;
+    std::vector<long long>& pair_shapeIDs = cd_data->pair_shapeIDs;
+    std::vector<uint>& num_contact = cd_data->bin_num_contact;
+    uint& num_possible_collisions = cd_data->num_possible_collisions;
+
+    const int num_items = (int)bvh_shapes.size();
+    if (cd_data->bvh_node.empty()) {
+        num_possible_collisions = 0;
+        return;
+    }
+
+    // Filter a candidate shape pair (same criteria as for the grid broadphase)
+    auto accept = [&](uint shapeA, uint shapeB) {
+        uint bodyA = obj_data_id[shapeA];
+        uint bodyB = obj_data_id[shapeB];
+        return bodyA != bodyB && (obj_active[bodyA] || obj_active[bodyB]) && collide(fam_data[shapeA], fam_data[shapeB]);
+    };
+
+    // Count the number of candidate pairs for each shape in the BVH
+    num_contact.resize(num_items + 1);
+    num_contact[num_items] = 0;
+
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int i = 0; i < num_items; i++) {
+        uint shapeA = bvh_shapes[i];
+        uint count = 0;
+        TraverseBVH(*cd_data, shapeA, [&](uint shapeB) {
+            if (accept(shapeA, shapeB))
+                count++;
+        });
+        num_contact[i] = count;
+    }
+
+    Thrust_Exclusive_Scan(num_contact);
+    num_possible_collisions = num_contact.back();
+    pair_shapeIDs.resize(num_possible_collisions);
+
+    // Store the list of shape pairs in potential collision (shape IDs in increasing order)
+#pragma omp parallel for schedule(dynamic, 64)
+    for (int i = 0; i < num_items; i++) {
+        uint shapeA = bvh_shapes[i];
+        uint offset = num_contact[i];
+        TraverseBVH(*cd_data, shapeA, [&](uint shapeB) {
+            if (accept(shapeA, shapeB))
+                pair_shapeIDs[offset++] = ((long long)shapeA << 32 | (long long)shapeB);
+        });
+    }
+}
+
 }  // end namespace collision
 }  // end namespace chrono
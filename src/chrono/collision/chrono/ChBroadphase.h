@@ -37,14 +37,36 @@ class ChApi ChBroadphase {
         FIXED_DENSITY      ///< user-specified density of shapes per bin
     };
 
+    /// Broadphase algorithm
+    enum class Method {
+        GRID,  ///< uniform grid (see GridType)
+        BVH    ///< bounding volume hierarchy of shape AABBs, refit at each call and rebuilt as needed
+    };
+
     ChBroadphase();
 
     /// Perform broadphase collision detection.
     /// Collision detection results are loaded in the shared data object (see ChCollisionData).
     void Process();
 
+    /// Return the number of times the broadphase grid (or BVH) was rebuilt from scratch.
+    /// In non-incremental grid mode, the grid is rebuilt at each call to Process.
+    int GetNumRebuilds() const { return num_rebuilds; }
+
+    /// Return the number of shapes which were re-binned at the last call to Process.
+    int GetNumRebinned() const { return num_rebinned; }
+
   private:
     void OneLevelBroadphase();
+    void FindCandidatePairs();
+    void ProcessIncremental();
+    void RebuildBins();
+    void UpdateBins();
+    void ProcessBVH();
+    void BuildBVH();
+    void RefitBVH();
+    real CostBVH() const;
+    void FindCandidatePairsBVH();
     void DetermineBoundingBox();
     void OffsetAABB();
     void ComputeTopLevelResolution();
@@ -53,11 +75,26 @@ class ChApi ChBroadphase {
 
     std::shared_ptr<ChCollisionData> cd_data;
 
+    Method method;         ///< (input) broadphase algorithm
     GridType grid_type;    ///< (input) method for setting grid resolution
     vec3 grid_resolution;  ///< (input) number of bins (used for GridType::FIXED_RESOLUTION)
     real3 bin_size;        ///< (input) desired bin dimensions (used for GridType::FIXED_BIN_SIZE)
     real grid_density;     ///< (input) collision grid density (used for GridType::FIXED_DENSITY)
 
+    bool incremental;                 ///< (input) use a persistent grid, updated incrementally
+    bool grid_valid;                  ///< persistent grid was set up
+    std::vector<vec3> shape_bin_min;  ///< [num_rigid_shapes] lower corner of bin range of each shape
+    std::vector<vec3> shape_bin_max;  ///< [num_rigid_shapes] upper corner of bin range of each shape
+    std::vector<vec3> new_bin_min;    ///< [num_rigid_shapes] lower corner of current bin range of each shape
+    std::vector<vec3> new_bin_max;    ///< [num_rigid_shapes] upper corner of current bin range of each shape
+    std::vector<uint> rebinned;       ///< list of shapes with a modified bin range
+    int num_rebuilds;                 ///< number of grid rebuilds
+    int num_rebinned;                 ///< number of shapes re-binned at last call
+
+    real bvh_rebuild_ratio;          ///< (input) rebuild BVH when its cost grows by this factor since last build
+    real bvh_build_cost;             ///< BVH cost (sum of internal node surface areas) after last build
+    std::vector<char> bvh_included;  ///< [num_rigid_shapes] flags for shapes included in the BVH
+
     friend class ChCollisionSystemChrono;
     friend class ChCollisionSystemChronoMulticore;
 };
@@ -109,6 +109,8 @@ class ChApi ChCollisionData {
           num_active_bins(0),
           num_possible_collisions(0),
           //
+          use_bvh(false),
+          //
           rigid_min_bounding_point(real3(0)),
           rigid_max_bounding_point(real3(0)),
           //
@@ -213,6 +215,13 @@ class ChApi ChCollisionData {
     std::vector<uint> bin_start_index_ext;  ///< [num_bins+1]
     std::vector<uint> bin_num_contact;      ///< [num_active_bins+1]
 
+    // BVH broadphase data (only used if the broadphase method is ChBroadphase::Method::BVH)
+    bool use_bvh;                    ///< candidate pairs were found with the BVH (otherwise, with the grid)
+    std::vector<real3> bvh_min;      ///< [num_bvh_nodes] node AABB minimum point (relative to global origin)
+    std::vector<real3> bvh_max;      ///< [num_bvh_nodes] node AABB maximum point (relative to global origin)
+    std::vector<vec2> bvh_node;      ///< [num_bvh_nodes] (first child, 0) for internal nodes, (start, count) for leaves
+    std::vector<uint> bvh_shapes;    ///< shape IDs of all shapes in the BVH, in leaf order
+
     // Indexing variables
     // ------------------
 
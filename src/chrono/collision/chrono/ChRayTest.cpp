@@ -12,6 +12,8 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <cassert>
+
 #include "chrono/collision/chrono/ChRayTest.h"
 #include "chrono/collision/chrono/ChCollisionUtils.h"
 
@@ -375,17 +377,24 @@ bool triangle_ray(const real3& A,
 
 // =============================================================================
 
-// Use a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems", 1986)
-// to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
-bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
+// State of a ray traversing the broadphase grid.
+struct GridRay {
+    vec3 bin;      // current bin
+    real3 t_next;  // ray parameter at next crossing, in each direction
+    real3 delta;   // increment in ray parameter at each crossing
+    vec3 step;     // increment in bin index at each crossing
+    vec3 exit;     // termination criteria (grid exit condition)
+};
+
+// Initialize the traversal of the broadphase grid by the ray from 'start' to 'end'.
+// Return false if the ray does not intersect the overall AABB.
+static bool grid_ray_init(const ChCollisionData& cd, const real3& start, const real3& end, GridRay& gr) {
     // Readability replacements
-    const vec3& bins_per_axis = cd_data->bins_per_axis;
-    const real3& bin_size = cd_data->bin_size;
-    const real3& inv_bin_size = cd_data->inv_bin_size;
-    const real3& lbr = cd_data->min_bounding_point;
-    const real3& rtf = cd_data->max_bounding_point;
-    const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
-    const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+    const vec3& bins_per_axis = cd.bins_per_axis;
+    const real3& bin_size = cd.bin_size;
+    const real3& inv_bin_size = cd.inv_bin_size;
+    const real3& lbr = cd.min_bounding_point;
+    const real3& rtf = cd.max_bounding_point;
 
     // Calculate ray parameter at intersection of overall AABB. Return now if no intersection
     real3 center = 0.5 * (rtf + lbr), loc, normal;
@@ -397,33 +406,66 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     real3 ray = end - start;
 
     // Find entry bin
-    auto bin = Clamp(HashMin(start - lbr, inv_bin_size), vec3(0, 0, 0), bins_per_axis - vec3(1, 1, 1));
+    gr.bin = Clamp(HashMin(start - lbr, inv_bin_size), vec3(0, 0, 0), bins_per_axis - vec3(1, 1, 1));
 
     // Depending on ray sign in each direction:
     // - Initialize next crossing
     // - Set increment in ray parameter at each crossing
     // - Set increment in bin index at each crossing
     // - Set termination criteria (grid exit condition)
-    real3 t_next(C_REAL_MAX);
-    real3 delta(0);
-    vec3 step;
-    vec3 exit;
+    gr.t_next = real3(C_REAL_MAX);
+    gr.delta = real3(0);
     for (int i = 0; i < 3; i++) {
         real start0 = (start[i] - lbr[i]) + t_min * ray[i];  // ray start point relative to grid LRB
         if (ray[i] < 0) {
-            t_next[i] = t_min + (bin[i] * bin_size[i] - start0) / ray[i];
-            delta[i] = -bin_size[i] / ray[i];
-            step[i] = -1;
-            exit[i] = -1;
+            gr.t_next[i] = t_min + (gr.bin[i] * bin_size[i] - start0) / ray[i];
+            gr.delta[i] = -bin_size[i] / ray[i];
+            gr.step[i] = -1;
+            gr.exit[i] = -1;
         }
         if (ray[i] > 0) {
-            t_next[i] = t_min + ((bin[i] + 1) * bin_size[i] - start0) / ray[i];
-            delta[i] = bin_size[i] / ray[i];
-            step[i] = +1;
-            exit[i] = bins_per_axis[i];
+            gr.t_next[i] = t_min + ((gr.bin[i] + 1) * bin_size[i] - start0) / ray[i];
+            gr.delta[i] = bin_size[i] / ray[i];
+            gr.step[i] = +1;
+            gr.exit[i] = bins_per_axis[i];
         }
     }
 
+    return true;
+}
+
+// Move to the next bin along the ray (the one with lowest t_next). Return false if the ray exits the grid.
+static bool grid_ray_advance(GridRay& gr) {
+    static const int map[8] = {2, 1, 2, 1, 2, 2, 0, 0};
+    int k = ((gr.t_next[0] < gr.t_next[1]) << 2) + ((gr.t_next[0] < gr.t_next[2]) << 1) +
+            ((gr.t_next[1] < gr.t_next[2]));
+    int axis = map[k];
+    gr.bin[axis] += gr.step[axis];
+    if (gr.bin[axis] == gr.exit[axis])
+        return false;
+    gr.t_next[axis] += gr.delta[axis];
+    return true;
+}
+
+// Use a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems", 1986)
+// to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
+bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
+    if (cd_data->use_bvh)
+        return CheckBVH(start, end, info);
+
+    // Readability replacements
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+    const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+
+    // Find entry bin and initialize grid traversal. Return now if no intersection with the overall AABB
+    GridRay gr;
+    if (!grid_ray_init(*cd_data, start, end, gr))
+        return false;
+
+    // Ray direction
+    real3 ray = end - start;
+
     // Walk through each bin intersected by the ray (DDA).
     ConvexShape shape(-1, &cd_data->shape_data);
     real mindist2 = C_REAL_MAX;
@@ -433,11 +475,11 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
     ////std::cout << "Ray end:   [" << end.x << "," << end.y << "," << end.z << "]" << std::endl;
 
     while (true) {
-        ////std::cout << "  Test BIN:  [" << bin.x << "," << bin.y << "," << bin.z << "]" << std::endl;
+        ////std::cout << "  Test BIN:  [" << gr.bin.x << "," << gr.bin.y << "," << gr.bin.z << "]" << std::endl;
         num_bin_tests++;
 
         // Test ray against all shapes in current bin.
-        auto bin_index = Hash_Index(bin, bins_per_axis);
+        auto bin_index = Hash_Index(gr.bin, bins_per_axis);
         auto start_index = bin_start_index_ext[bin_index];
         auto end_index = bin_start_index_ext[bin_index + 1];
 
@@ -445,32 +487,373 @@ bool ChRayTest::Check(const real3& start, const real3& end, RayHitInfo& info) {
             num_shape_tests++;
             shape.index = bin_aabb_number[j];
             ////std::cout << "    Test SHAPE: " << shape.index << std::endl;
-            if (CheckShape(shape, start, end, info.normal, mindist2))
+            if (CheckShape(shape, start, end, info.normal, mindist2)) {
                 hit = true;
+                info.shapeID = shape.index;  // Identifier of closest hit shape
+            }
         }
 
         // If a shape in the current bin was hit, stop.
         if (hit) {
-            info.shapeID = shape.index;         // Identifier of closest hit shape
             info.dist = Sqrt(mindist2);         // Distance from ray origin
             info.t = info.dist / Length(ray);   // Ray parameter at intersection with closest shape
             info.point = start + info.t * ray;  // Intersection point
             break;
         }
 
-        // Move to the next cell (the one with lowest t_next)
-        static const int map[8] = {2, 1, 2, 1, 2, 2, 0, 0};
-        int k = ((t_next[0] < t_next[1]) << 2) + ((t_next[0] < t_next[2]) << 1) + ((t_next[1] < t_next[2]));
-        int axis = map[k];
-        bin[axis] += step[axis];
-        if (bin[axis] == exit[axis])
+        // Move to the next cell
+        if (!grid_ray_advance(gr))
             break;
-        t_next[axis] += delta[axis];
     }
 
     return hit;
 }
 
+// Test for intersection between the line segment from 'start' to 'start + ray' and the specified AABB, with the ray
+// parameter in [0, t_max]. 'inv_ray' contains the reciprocals of the ray components (C_REAL_MAX for zero components).
+static bool segment_aabb(const real3& bmin,
+                         const real3& bmax,
+                         const real3& start,
+                         const real3& inv_ray,
+                         real t_max) {
+    real t0 = 0;
+    real t1 = t_max;
+    for (int i = 0; i < 3; i++) {
+        if (inv_ray[i] == C_REAL_MAX) {
+            // Ray parallel to slab
+            if (start[i] < bmin[i] || start[i] > bmax[i])
+                return false;
+            continue;
+        }
+        real ta = (bmin[i] - start[i]) * inv_ray[i];
+        real tb = (bmax[i] - start[i]) * inv_ray[i];
+        if (ta > tb) {
+            real tmp = ta;
+            ta = tb;
+            tb = tmp;
+        }
+        t0 = Max(t0, ta);
+        t1 = Min(t1, tb);
+        if (t0 > t1)
+            return false;
+    }
+    return true;
+}
+
+// Traverse the BVH broadphase, testing the ray against all shapes in leaves whose AABB is intersected by the ray.
+// Nodes beyond the closest hit found so far are culled.
+bool ChRayTest::CheckBVH(const real3& start, const real3& end, RayHitInfo& info) {
+    const std::vector<real3>& bvh_min = cd_data->bvh_min;
+    const std::vector<real3>& bvh_max = cd_data->bvh_max;
+    const std::vector<vec2>& bvh_node = cd_data->bvh_node;
+    const std::vector<uint>& bvh_shapes = cd_data->bvh_shapes;
+
+    if (bvh_node.empty())
+        return false;
+
+    // BVH node AABBs are expressed relative to the global origin
+    real3 ray = end - start;
+    real length = Length(ray);
+    real3 start_G = start - cd_data->global_origin;
+    real3 inv_ray;
+    for (int i = 0; i < 3; i++)
+        inv_ray[i] = (ray[i] == 0) ? C_REAL_MAX : 1 / ray[i];
+
+    ConvexShape shape(-1, &cd_data->shape_data);
+    real mindist2 = C_REAL_MAX;
+    bool hit = false;
+
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        int n = stack[--top];
+        num_bin_tests++;
+        real t_max = hit ? Sqrt(mindist2) / length : 1;
+        if (!segment_aabb(bvh_min[n], bvh_max[n], start_G, inv_ray, t_max))
+            continue;
+        const vec2& node = bvh_node[n];
+        if (node.y == 0) {
+            stack[top++] = node.x;
+            stack[top++] = node.x + 1;
+            continue;
+        }
+        for (int j = node.x; j < node.x + node.y; j++) {
+            num_shape_tests++;
+            shape.index = bvh_shapes[j];
+            if (CheckShape(shape, start, end, info.normal, mindist2)) {
+                hit = true;
+                info.shapeID = shape.index;
+            }
+        }
+    }
+
+    if (hit) {
+        info.dist = Sqrt(mindist2);         // Distance from ray origin
+        info.t = info.dist / length;        // Ray parameter at intersection with closest shape
+        info.point = start + info.t * ray;  // Intersection point
+    }
+
+    return hit;
+}
+
+// =============================================================================
+
+// Data for a packet of rays tested together.
+struct ChRayTest::RayPacket {
+    int size;                    // number of rays in packet
+    real3 start[packet_size];    // ray start points
+    real3 end[packet_size];      // ray end points
+    real3 normal[packet_size];   // normal to closest hit shape
+    real mindist2[packet_size];  // squared distance from ray origin to closest hit
+    int shapeID[packet_size];    // identifier of closest hit shape
+    bool hit[packet_size];       // true if the ray hit a shape
+};
+
+int ChRayTest::CheckBatch(const std::vector<real3>& start,
+                          const std::vector<real3>& end,
+                          std::vector<RayHitInfo>& info,
+                          std::vector<char>& hit,
+                          int nthreads) {
+    assert(start.size() == end.size());
+
+    int num_rays = (int)start.size();
+    int num_packets = (num_rays + packet_size - 1) / packet_size;
+    info.resize(num_rays);
+    hit.assign(num_rays, 0);
+
+    uint nbins = 0;
+    uint nshapes = 0;
+    int nhits = 0;
+
+#pragma omp parallel for schedule(dynamic) num_threads(nthreads) reduction(+ : nbins, nshapes, nhits)
+    for (int p = 0; p < num_packets; p++) {
+        int first = p * packet_size;
+
+        RayPacket packet;
+        packet.size = (num_rays - first < packet_size) ? num_rays - first : packet_size;
+        for (int r = 0; r < packet.size; r++) {
+            packet.start[r] = start[first + r];
+            packet.end[r] = end[first + r];
+            packet.mindist2[r] = C_REAL_MAX;
+            packet.shapeID[r] = -1;
+            packet.hit[r] = false;
+        }
+
+        if (cd_data->use_bvh)
+            CheckPacketBVH(packet, nbins, nshapes);
+        else
+            CheckPacketGrid(packet, nbins, nshapes);
+
+        for (int r = 0; r < packet.size; r++) {
+            if (!packet.hit[r])
+                continue;
+            real3 ray = packet.end[r] - packet.start[r];
+            RayHitInfo& ri = info[first + r];
+            ri.shapeID = packet.shapeID[r];
+            ri.normal = packet.normal[r];
+            ri.dist = Sqrt(packet.mindist2[r]);
+            ri.t = ri.dist / Length(ray);
+            ri.point = packet.start[r] + ri.t * ray;
+            hit[first + r] = 1;
+            nhits++;
+        }
+    }
+
+    num_bin_tests = nbins;
+    num_shape_tests = nshapes;
+
+    return nhits;
+}
+
+// Walk all rays of the packet through the broadphase grid in lockstep. At each step, the active rays are grouped by
+// their current bin and the shapes in each visited bin are tested against the rays of the corresponding group. As in
+// Check(), a ray stops at the first bin in which it hits a shape.
+void ChRayTest::CheckPacketGrid(RayPacket& packet, uint& nbins, uint& nshapes) const {
+    // Readability replacements
+    const vec3& bins_per_axis = cd_data->bins_per_axis;
+    const std::vector<uint>& bin_start_index_ext = cd_data->bin_start_index_ext;
+    const std::vector<uint>& bin_aabb_number = cd_data->bin_aabb_number;
+
+    // Initialize grid traversal for all rays which intersect the overall AABB
+    GridRay gr[packet_size];
+    int active[packet_size];
+    int num_active = 0;
+    for (int r = 0; r < packet.size; r++) {
+        if (grid_ray_init(*cd_data, packet.start[r], packet.end[r], gr[r]))
+            active[num_active++] = r;
+    }
+
+    ConvexShape shape(-1, &cd_data->shape_data);
+    uint bin_index[packet_size];
+    bool grouped[packet_size];
+    int group[packet_size];
+
+    while (num_active > 0) {
+        for (int k = 0; k < num_active; k++) {
+            bin_index[k] = Hash_Index(gr[active[k]].bin, bins_per_axis);
+            grouped[k] = false;
+        }
+
+        // Visit each distinct bin once, testing its shapes against all rays currently in that bin
+        for (int k = 0; k < num_active; k++) {
+            if (grouped[k])
+                continue;
+            int group_size = 0;
+            for (int l = k; l < num_active; l++) {
+                if (bin_index[l] == bin_index[k]) {
+                    group[group_size++] = active[l];
+                    grouped[l] = true;
+                }
+            }
+
+            nbins++;
+            auto start_index = bin_start_index_ext[bin_index[k]];
+            auto end_index = bin_start_index_ext[bin_index[k] + 1];
+            for (uint j = start_index; j < end_index; j++) {
+                nshapes++;
+                shape.index = bin_aabb_number[j];
+                CheckShapePacket(shape, packet, group, group_size);
+            }
+        }
+
+        // Rays which hit a shape in their current bin stop; all others move to the next bin
+        int num_remaining = 0;
+        for (int k = 0; k < num_active; k++) {
+            int r = active[k];
+            if (!packet.hit[r] && grid_ray_advance(gr[r]))
+                active[num_remaining++] = r;
+        }
+        num_active = num_remaining;
+    }
+}
+
+// Traverse the BVH once for all rays of the packet. Each stack entry carries the mask of rays which intersect all
+// ancestors of the node; at each node, only these rays are tested (with culling beyond their closest hit so far).
+void ChRayTest::CheckPacketBVH(RayPacket& packet, uint& nbins, uint& nshapes) const {
+    const std::vector<real3>& bvh_min = cd_data->bvh_min;
+    const std::vector<real3>& bvh_max = cd_data->bvh_max;
+    const std::vector<vec2>& bvh_node = cd_data->bvh_node;
+    const std::vector<uint>& bvh_shapes = cd_data->bvh_shapes;
+
+    if (bvh_node.empty())
+        return;
+
+    // BVH node AABBs are expressed relative to the global origin
+    real3 start_G[packet_size];
+    real3 inv_ray[packet_size];
+    real length[packet_size];
+    for (int r = 0; r < packet.size; r++) {
+        real3 ray = packet.end[r] - packet.start[r];
+        length[r] = Length(ray);
+        start_G[r] = packet.start[r] - cd_data->global_origin;
+        for (int i = 0; i < 3; i++)
+            inv_ray[r][i] = (ray[i] == 0) ? C_REAL_MAX : 1 / ray[i];
+    }
+
+    ConvexShape shape(-1, &cd_data->shape_data);
+    int group[packet_size];
+
+    int stack[64];
+    uint stack_mask[64];
+    int top = 0;
+    stack[top] = 0;
+    stack_mask[top] = (1u << packet.size) - 1;
+    top++;
+    while (top > 0) {
+        top--;
+        int n = stack[top];
+        uint mask = stack_mask[top];
+        nbins++;
+
+        int group_size = 0;
+        uint node_mask = 0;
+        for (int r = 0; r < packet.size; r++) {
+            if (!(mask & (1u << r)))
+                continue;
+            real t_max = packet.hit[r] ? Sqrt(packet.mindist2[r]) / length[r] : 1;
+            if (segment_aabb(bvh_min[n], bvh_max[n], start_G[r], inv_ray[r], t_max)) {
+                group[group_size++] = r;
+                node_mask |= (1u << r);
+            }
+        }
+        if (group_size == 0)
+            continue;
+
+        const vec2& node = bvh_node[n];
+        if (node.y == 0) {
+            stack[top] = node.x;
+            stack_mask[top] = node_mask;
+            top++;
+            stack[top] = node.x + 1;
+            stack_mask[top] = node_mask;
+            top++;
+            continue;
+        }
+        for (int j = node.x; j < node.x + node.y; j++) {
+            nshapes++;
+            shape.index = bvh_shapes[j];
+            CheckShapePacket(shape, packet, group, group_size);
+        }
+    }
+}
+
+// Test the specified shape against a group of rays in a packet. The shape data is loaded once for all rays; for
+// spheres, boxes, and triangles, the loop over rays is done with the shape parameters hoisted out of the loop.
+void ChRayTest::CheckShapePacket(const ConvexShape& shape, RayPacket& packet, const int* rays, int nrays) {
+    switch (shape.Type()) {
+        case ChCollisionShape::Type::SPHERE: {
+            real3 pos = shape.A();
+            real radius = shape.Radius();
+            for (int k = 0; k < nrays; k++) {
+                int r = rays[k];
+                if (sphere_ray(pos, radius, packet.start[r], packet.end[r], packet.normal[r], packet.mindist2[r])) {
+                    packet.hit[r] = true;
+                    packet.shapeID[r] = shape.index;
+                }
+            }
+            break;
+        }
+        case ChCollisionShape::Type::BOX: {
+            real3 pos = shape.A();
+            quaternion rot = shape.R();
+            real3 hdims = shape.Box();
+            for (int k = 0; k < nrays; k++) {
+                int r = rays[k];
+                if (box_ray(pos, rot, hdims, packet.start[r], packet.end[r], packet.normal[r], packet.mindist2[r])) {
+                    packet.hit[r] = true;
+                    packet.shapeID[r] = shape.index;
+                }
+            }
+            break;
+        }
+        case ChCollisionShape::Type::TRIANGLE: {
+            const real3* tri = shape.Triangles();
+            real3 A = tri[0];
+            real3 B = tri[1];
+            real3 C = tri[2];
+            for (int k = 0; k < nrays; k++) {
+                int r = rays[k];
+                if (triangle_ray(A, B, C, packet.start[r], packet.end[r], packet.normal[r], packet.mindist2[r])) {
+                    packet.hit[r] = true;
+                    packet.shapeID[r] = shape.index;
+                }
+            }
+            break;
+        }
+        default: {
+            for (int k = 0; k < nrays; k++) {
+                int r = rays[k];
+                if (CheckShape(shape, packet.start[r], packet.end[r], packet.normal[r], packet.mindist2[r])) {
+                    packet.hit[r] = true;
+                    packet.shapeID[r] = shape.index;
+                }
+            }
+            break;
+        }
+    }
+}
+
 // Narrowphase dispatcher for ray intersection test.  It uses analytical formulaes for known primitive shapes with
 // fallback on a generic ray-convex intersection test.
 bool ChRayTest::CheckShape(const ConvexBase& shape,
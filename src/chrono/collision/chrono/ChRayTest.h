@@ -18,6 +18,8 @@
 
 #pragma once
 
+#include <vector>
+
 #include "chrono/collision/chrono/ChCollisionData.h"
 #include "chrono/collision/chrono/ChConvexShape.h"
 
@@ -43,27 +45,64 @@ class ChApi ChRayTest {
 
     /// Check for intersection of the given ray with all collision shapes in the system.
     /// Uses a variant of the 3D Digital Differential Analyser (Akira Fujimoto, "ARTS: Accelerated Ray Tracing Systems",
-    /// 1986) to efficiently traverse the broadphase grid and analytical shape-ray intersection tests.
+    /// 1986) to efficiently traverse the broadphase grid and analytical shape-ray intersection tests. If the BVH
+    /// broadphase is used, the BVH is traversed instead.
     bool Check(const real3& start,  ///< ray start point
                const real3& end,    ///< ray end point
                RayHitInfo& info     ///< [output] test result info
     );
 
-    /// Return the number of bins visited by the DDA algorithm during the last ray test.
+    /// Check for intersection of a batch of rays with all collision shapes in the system.
+    /// Consecutive rays are grouped in packets of up to 'packet_size' rays which traverse the broadphase together: with
+    /// the grid broadphase, the rays of a packet walk through the grid in lockstep and the shapes in a bin are loaded
+    /// once and tested against all rays of the packet currently in that bin; with the BVH broadphase, each node is
+    /// visited once for all rays of the packet which reach it. Packets are processed in parallel. The results are
+    /// identical to those obtained by calling Check() for each ray, but traversal is most efficient if consecutive rays
+    /// are coherent (e.g., nearly parallel rays cast from neighboring points). Returns the number of rays with a hit.
+    int CheckBatch(const std::vector<real3>& start,  ///< ray start points
+                   const std::vector<real3>& end,    ///< ray end points
+                   std::vector<RayHitInfo>& info,    ///< [output] test result info (for each ray)
+                   std::vector<char>& hit,           ///< [output] test result (for each ray)
+                   int nthreads = 1                  ///< number of OpenMP threads
+    );
+
+    /// Maximum number of rays in a packet (see CheckBatch).
+    static const int packet_size = 16;
+
+    /// Return the number of bins (or BVH nodes) visited during the last ray test.
     uint GetNumBinTests() const { return num_bin_tests; }
 
     /// Return the number of ray-shape checks required by the last ray test.
+    /// For a batch of rays, a shape tested against several rays of a packet is counted once.
     uint GetNumShapeTests() const { return num_shape_tests; }
 
   private:
+    /// Ray intersection test using the BVH broadphase.
+    bool CheckBVH(const real3& start, const real3& end, RayHitInfo& info);
+
+    struct RayPacket;
+
+    /// Ray intersection test for a packet of rays using the broadphase grid.
+    void CheckPacketGrid(RayPacket& packet, uint& nbins, uint& nshapes) const;
+
+    /// Ray intersection test for a packet of rays using the BVH broadphase.
+    void CheckPacketBVH(RayPacket& packet, uint& nbins, uint& nshapes) const;
+
     /// Dispatcher for analytic functions for ray intersection with primitive shapes.
-    bool CheckShape(const ConvexBase& shape,  ///< candidate shape
+    static bool CheckShape(const ConvexBase& shape,  ///< candidate shape
                     const real3& start,       ///< ray start point
                     const real3& end,         ///< ray end point
                     real3& normal,            ///< [output] normal to shape at intersectin point
                     real& mindist2            ///< [output] smallest squared distance to ray origin
     );
 
+    /// Dispatcher for ray intersection of a group of rays in a packet with a primitive shape.
+    static void CheckShapePacket(const ConvexShape& shape,  ///< candidate shape
+                                 RayPacket& packet,         ///< ray packet
+                                 const int* rays,           ///< indices of rays to test in packet
+                                 int nrays                  ///< number of rays to test
+    );
+
     std::shared_ptr<ChCollisionData> cd_data;  ///< shared collision detection data
     uint num_bin_tests;                        ///< number of bins visited during last ray test
     uint num_shape_tests;                      ///< number of shape checked during last ray test
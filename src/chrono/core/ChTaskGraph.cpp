@@ -0,0 +1,98 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <cassert>
+#include <exception>
+
+#include "chrono/core/ChTaskGraph.h"
+
+namespace chrono {
+
+int ChTaskGraph::AddTask(const std::string& name, std::function<void()> func, const std::vector<int>& dependencies) {
+    Task task;
+    task.name = name;
+    task.func = func;
+    task.wave = 0;
+    for (auto dep : dependencies) {
+        assert(dep >= 0 && dep < (int)m_tasks.size());
+        task.wave = std::max(task.wave, m_tasks[dep].wave + 1);
+    }
+    m_tasks.push_back(task);
+    return (int)m_tasks.size() - 1;
+}
+
+int ChTaskGraph::GetNumWaves() const {
+    int nwaves = 0;
+    for (const auto& task : m_tasks)
+        nwaves = std::max(nwaves, task.wave + 1);
+    return nwaves;
+}
+
+double ChTaskGraph::GetTaskTime(const std::string& name) const {
+    for (const auto& task : m_tasks) {
+        if (task.name == name)
+            return task.timer();
+    }
+    return 0;
+}
+
+void ChTaskGraph::Run(int nthreads) {
+    for (auto& task : m_tasks)
+        task.timer.reset();
+
+    // Serial execution, in the order in which tasks were added
+    if (nthreads <= 1) {
+        for (auto& task : m_tasks) {
+            task.timer.start();
+            task.func();
+            task.timer.stop();
+        }
+        return;
+    }
+
+    // Concurrent execution of the tasks in each wave
+    std::vector<int> wave_tasks;
+    std::vector<std::exception_ptr> errors;
+    int nwaves = GetNumWaves();
+    for (int wave = 0; wave < nwaves; wave++) {
+        wave_tasks.clear();
+        for (int i = 0; i < (int)m_tasks.size(); i++) {
+            if (m_tasks[i].wave == wave)
+                wave_tasks.push_back(i);
+        }
+        int ntasks = (int)wave_tasks.size();
+        errors.assign(ntasks, nullptr);
+
+        // Static round-robin schedule: the first task of the wave is executed by the calling (master) thread
+#pragma omp parallel for schedule(static, 1) num_threads(std::min(nthreads, ntasks))
+        for (int k = 0; k < ntasks; k++) {
+            auto& task = m_tasks[wave_tasks[k]];
+            task.timer.start();
+            try {
+                task.func();
+            } catch (...) {
+                errors[k] = std::current_exception();
+            }
+            task.timer.stop();
+        }
+
+        for (const auto& error : errors) {
+            if (error)
+                std::rethrow_exception(error);
+        }
+    }
+}
+
+}  // end namespace chrono
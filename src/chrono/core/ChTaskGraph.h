@@ -0,0 +1,80 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_TASK_GRAPH_H
+#define CH_TASK_GRAPH_H
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChTimer.h"
+
+namespace chrono {
+
+/// Simple scheduler for a graph of dependent tasks.
+/// Tasks are added in an order consistent with their dependencies (a task can only depend on tasks added before it).
+/// When executed, tasks are grouped in successive waves: each wave contains the tasks whose dependencies were all
+/// completed in previous waves. The tasks in a wave are executed concurrently (on up to the specified number of
+/// threads), with the first task of each wave always executed on the calling thread. The time spent in each task is
+/// recorded, so that the task graph also provides a per-stage timing of the executed work.
+class ChApi ChTaskGraph {
+  public:
+    ChTaskGraph() {}
+
+    /// Remove all tasks.
+    void Clear() { m_tasks.clear(); }
+
+    /// Add a task with the given name, work function, and dependencies (indices of previously added tasks).
+    /// Return the index of the new task.
+    int AddTask(const std::string& name, std::function<void()> func, const std::vector<int>& dependencies = {});
+
+    /// Execute all tasks.
+    /// If nthreads > 1, independent tasks are executed concurrently. Otherwise, tasks are executed in the order in
+    /// which they were added. Exceptions thrown by a task are propagated to the caller after completion of its wave.
+    void Run(int nthreads);
+
+    /// Return the number of tasks.
+    int GetNumTasks() const { return (int)m_tasks.size(); }
+
+    /// Return the number of waves (tasks executed concurrently are in the same wave).
+    int GetNumWaves() const;
+
+    /// Return the name of the specified task.
+    const std::string& GetTaskName(int task) const { return m_tasks[task].name; }
+
+    /// Return the wave of the specified task.
+    int GetTaskWave(int task) const { return m_tasks[task].wave; }
+
+    /// Return the time (in seconds) spent in the specified task at the last execution.
+    double GetTaskTime(int task) const { return m_tasks[task].timer(); }
+
+    /// Return the time (in seconds) spent in the task with given name at the last execution (0 if no such task).
+    double GetTaskTime(const std::string& name) const;
+
+  private:
+    struct Task {
+        std::string name;
+        std::function<void()> func;
+        int wave;
+        ChTimer timer;
+    };
+
+    std::vector<Task> m_tasks;
+};
+
+}  // end namespace chrono
+
+#endif
@@ -89,12 +89,31 @@ class ChApi ChElementBase {
     /// Set values in the provided Fi vector (of size equal to the number of dof of element).
     virtual void ComputeGravityForces(ChVectorDynamic<>& Fi, const ChVector<>& G_acc) = 0;
 
+    /// Check if the internal forces of this element and of the specified element can be computed in the same batch
+    /// (see ComputeInternalForcesBatch). Batch-compatible elements are of the same type and share all data used in
+    /// the internal force calculation, other than their nodal states.
+    /// The default implementation returns false (no batched evaluation).
+    virtual bool IsBatchCompatible(ChElementBase* other) { return false; }
+
+    /// Compute the internal forces of a batch of elements, starting with this one.
+    /// All elements in the batch are batch-compatible with this element. On return, Fi[k] contains the internal forces
+    /// of the k-th element in the batch. Derived classes can override this function with a kernel that evaluates all
+    /// elements at once. The default implementation calls ComputeInternalForces for each element.
+    virtual void ComputeInternalForcesBatch(const std::vector<ChElementBase*>& batch,
+                                            std::vector<ChVectorDynamic<>>& Fi) {
+        for (size_t k = 0; k < batch.size(); k++) {
+            Fi[k].resize(batch[k]->GetNdofs());
+            batch[k]->ComputeInternalForces(Fi[k]);
+        }
+    }
+
     /// Update, called at least at each time step.
     /// If the element has to keep updated some auxiliary data, such as the rotation matrices for corotational approach,
     /// this should be implemented in this function.
     virtual void Update() {}
 
-    // Functions for interfacing to the state bookkeeping
+    // Functions for interfacing to the state bookkeeping.
+    // The EleIntLoadResidual_* functions are called concurrently by ChMesh for elements that share no nodes.
 
     /// This is optionally implemented if there is some internal state that requires integration.
     virtual void EleDoIntegration() {}
@@ -117,6 +136,20 @@ class ChApi ChElementBase {
     /// and not even the g vector, for instance if using lumped masses.
     virtual void EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector<>& G_acc, const double c) = 0;
 
+    /// Add a vector of element nodal forces F (pasted at global nodes offsets) into a global vector R, multiplied by
+    /// a scaling factor c, as
+    ///   R += F * c
+    void EleIntLoadResidual_Forces(ChVectorDynamic<>& R, const ChVectorDynamic<>& F, const double c) {
+        int stride = 0;
+        for (int in = 0; in < GetNnodes(); in++) {
+            auto node = GetNodeN(in);
+            int node_dofs = GetNodeNdofs_active(in);
+            if (!node->IsFixed())
+                R.segment(node->NodeGetOffsetW(), node_dofs) += c * F.segment(stride, node_dofs);
+            stride += GetNodeNdofs(in);
+        }
+    }
+
     // Functions for interfacing to the solver
 
     /// Indicate that there are item(s) of type ChKblock in this object (for further passing it to a solver)
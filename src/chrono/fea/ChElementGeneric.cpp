@@ -22,21 +22,12 @@ namespace fea {
 void ChElementGeneric::EleIntLoadResidual_F(ChVectorDynamic<>& R, const double c) {
     ChVectorDynamic<> Fi(GetNdofs());
     ComputeInternalForces(Fi);
-    Fi *= c;
 
     //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    //// ChMesh only runs concurrently elements that share no nodes (see ChMesh::ColorElements),
+    //// so the global vector R can be updated without atomic operations.
 
-    int stride = 0;
-    for (int in = 0; in < GetNnodes(); in++) {
-        int node_dofs = GetNodeNdofs_active(in);
-        if (!GetNodeN(in)->IsFixed()) {
-            for (int j = 0; j < node_dofs; j++)
-#pragma omp atomic
-                R(GetNodeN(in)->NodeGetOffsetW() + j) += Fi(stride + j);
-        }
-        stride += GetNodeNdofs(in);
-    }
+    EleIntLoadResidual_Forces(R, Fi, c);
     // GetLog() << "EleIntLoadResidual_F , R=" << R << "\n";
 }
 
@@ -69,21 +60,12 @@ void ChElementGeneric::EleIntLoadResidual_Mv(ChVectorDynamic<>& R, const ChVecto
 void ChElementGeneric::EleIntLoadResidual_F_gravity(ChVectorDynamic<>& R, const ChVector<>& G_acc, const double c) {
     ChVectorDynamic<> Fg(GetNdofs());
     ComputeGravityForces(Fg, G_acc);
-    Fg *= c;
 
     //// Attention: this is called from within a parallel OMP for loop.
-    //// Must use atomic increment when updating the global vector R.
+    //// ChMesh only runs concurrently elements that share no nodes (see ChMesh::ColorElements),
+    //// so the global vector R can be updated without atomic operations.
 
-    int stride = 0;
-    for (int in = 0; in < GetNnodes(); in++) {
-        int node_dofs = GetNodeNdofs_active(in);
-        if (!GetNodeN(in)->IsFixed()) {
-            for (int j = 0; j < node_dofs; j++)
-#pragma omp atomic
-                R(GetNodeN(in)->NodeGetOffsetW() + j) += Fg(stride + j);
-        }
-        stride += GetNodeNdofs(in);
-    }
+    EleIntLoadResidual_Forces(R, Fg, c);
 }
 
 // A default fall-back implementation of the ComputeGravityForces that will work for all elements inherited from
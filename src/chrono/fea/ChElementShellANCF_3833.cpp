@@ -511,6 +511,122 @@ void ChElementShellANCF_3833::ComputeInternalForces(ChVectorDynamic<>& Fi) {
     }
 }
 
+// Check if the internal forces of this element and of the other element can be computed in the same batch.
+
+bool ChElementShellANCF_3833::IsBatchCompatible(ChElementBase* other) {
+    auto elem = dynamic_cast<ChElementShellANCF_3833*>(other);
+    if (!elem || m_method != IntFrcMethod::ContInt || elem->m_method != IntFrcMethod::ContInt)
+        return false;
+    if (m_damping_enabled != elem->m_damping_enabled || (m_damping_enabled && m_Alpha != elem->m_Alpha))
+        return false;
+    if (m_numLayers != elem->m_numLayers)
+        return false;
+    for (int kl = 0; kl < m_numLayers; kl++) {
+        if (m_layers[kl].GetMaterial() != elem->m_layers[kl].GetMaterial() ||
+            m_layers[kl].Get_theta() != elem->m_layers[kl].Get_theta())
+            return false;
+    }
+    // Elements with the same reference shape, up to a rigid translation, have the same precomputed matrices (up to
+    // roundoff errors)
+    return m_SD.isApprox(elem->m_SD, 1e-12) && m_kGQ.isApprox(elem->m_kGQ, 1e-12);
+}
+
+// Compute the generalized internal force vectors of a batch of compatible elements, using the "Continuous Integration"
+// style method. This follows ComputeInternalForcesContIntDamping and ComputeInternalForcesContIntNoDamping, with the
+// nodal coordinates of all elements in the batch collected side by side. The deformation gradients of all elements
+// are obtained with a single matrix product, and all Gauss point quantities are stored as (NIP x batch size) arrays so
+// that the strain and stress calculations vectorize across the elements.
+
+void ChElementShellANCF_3833::ComputeInternalForcesBatch(const std::vector<ChElementBase*>& batch,
+                                                         std::vector<ChVectorDynamic<>>& Fi) {
+    using ArrayMap = Eigen::Map<Eigen::ArrayXXd, 0, Eigen::OuterStride<>>;
+
+    const int n = (int)batch.size();
+    const int nc = m_damping_enabled ? 6 : 3;  // columns per element (nodal coordinates and their time derivatives)
+
+    // Collect the nodal coordinates (and their time derivatives) of all elements
+    ChMatrixDynamic_col<> ebar;
+    ebar.resize(NSF, nc * n);
+    for (int k = 0; k < n; k++) {
+        auto elem = static_cast<ChElementShellANCF_3833*>(batch[k]);
+        if (m_damping_enabled) {
+            MatrixNx6 ebar_ebardot;
+            elem->CalcCombinedCoordMatrix(ebar_ebardot);
+            ebar.block<NSF, 6>(0, 6 * k) = ebar_ebardot;
+        } else {
+            Matrix3xN e_bar;
+            elem->CalcCoordMatrix(e_bar);
+            ebar.block<NSF, 3>(0, 3 * k) = e_bar.transpose();
+        }
+    }
+
+    ChMatrixDynamic_col<> QiCompact = ChMatrixDynamic_col<>::Zero(NSF, 3 * n);
+    ChMatrixDynamic_col<> FC(3 * NIP, nc * n);
+    ChMatrixDynamic_col<> P_Block(3 * NIP, 3 * n);
+
+    // Component (a,j) of the deformation gradient of all elements (j >= 3 for its time derivative), as a NIP x n
+    // array. As in the single element calculation, the indices of the components are in transposed order.
+    auto F = [&FC, n, nc](int a, int j) {
+        return ArrayMap(FC.data() + j * 3 * NIP + a * NIP, NIP, n, Eigen::OuterStride<>(nc * 3 * NIP));
+    };
+    auto P = [&P_Block, n](int a, int j) {
+        return ArrayMap(P_Block.data() + j * 3 * NIP + a * NIP, NIP, n, Eigen::OuterStride<>(3 * 3 * NIP));
+    };
+
+    // Loop over all of the layers summing the contribution to the generalized internal force vectors from each layer
+    for (int kl = 0; kl < m_numLayers; kl++) {
+        // Deformation gradients (and their time derivatives) at all Gauss quadrature points, for all elements
+        FC.noalias() = m_SD.block<NSF, 3 * NIP>(0, 3 * NIP * kl).transpose() * ebar;
+
+        ChVectorN<double, NIP> kGQ = m_kGQ.block<NIP, 1>(kl * NIP, 0);
+
+        // Green-Lagrange strains, combined with their scaled time derivatives and scaled by kGQ.
+        // Results are written in Voigt notation: epsilon = [E11,E22,E33,2*E23,2*E13,2*E12]
+        auto strain_normal = [&](int a) {
+            Eigen::ArrayXXd E = 0.5 * (F(a, 0).square() + F(a, 1).square() + F(a, 2).square() - 1);
+            if (m_damping_enabled)
+                E += m_Alpha * (F(a, 0) * F(a, 3) + F(a, 1) * F(a, 4) + F(a, 2) * F(a, 5));
+            E.colwise() *= kGQ.array();
+            return E;
+        };
+        auto strain_shear = [&](int a, int b) {
+            Eigen::ArrayXXd E = F(a, 0) * F(b, 0) + F(a, 1) * F(b, 1) + F(a, 2) * F(b, 2);
+            if (m_damping_enabled)
+                E += m_Alpha * (F(b, 0) * F(a, 3) + F(b, 1) * F(a, 4) + F(b, 2) * F(a, 5) +  //
+                                F(a, 0) * F(b, 3) + F(a, 1) * F(b, 4) + F(a, 2) * F(b, 5));
+            E.colwise() *= kGQ.array();
+            return E;
+        };
+        Eigen::ArrayXXd E[6] = {strain_normal(0),   strain_normal(1),   strain_normal(2),
+                                strain_shear(1, 2), strain_shear(0, 2), strain_shear(0, 1)};
+
+        // Scaled 2nd Piola-Kirchoff stresses in Voigt notation
+        ChMatrixNM<double, 6, 6> D = m_layers[kl].GetMaterial()->Get_E_eps();
+        RotateReorderStiffnessMatrix(D, m_layers[kl].Get_theta());
+
+        Eigen::ArrayXXd SPK2[6];
+        for (int i = 0; i < 6; i++) {
+            SPK2[i] = D(i, 0) * E[0] + D(i, 1) * E[1] + D(i, 2) * E[2] + D(i, 3) * E[3] + D(i, 4) * E[4] +
+                      D(i, 5) * E[5];
+        }
+
+        // Scaled transpose of the 1st Piola-Kirchoff stresses
+        for (int j = 0; j < 3; j++) {
+            P(0, j) = F(0, j) * SPK2[0] + F(1, j) * SPK2[5] + F(2, j) * SPK2[4];
+            P(1, j) = F(0, j) * SPK2[5] + F(1, j) * SPK2[1] + F(2, j) * SPK2[3];
+            P(2, j) = F(0, j) * SPK2[4] + F(1, j) * SPK2[3] + F(2, j) * SPK2[2];
+        }
+
+        QiCompact.noalias() += m_SD.block<NSF, 3 * NIP>(0, 3 * kl * NIP) * P_Block;
+    }
+
+    // Reshape the compact matrix form of each generalized internal force vector into its column vector format
+    for (int k = 0; k < n; k++) {
+        MatrixNx3 Qi = QiCompact.block<NSF, 3>(0, 3 * k);
+        Fi[k] = Eigen::Map<Vector3N>(Qi.data(), Qi.size());
+    }
+}
+
 // Calculate the global matrix H as a linear combination of K, R, and M:
 //   H = Mfactor * [M] + Kfactor * [K] + Rfactor * [R]
 
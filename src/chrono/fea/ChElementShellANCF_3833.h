@@ -258,6 +258,18 @@ class ChApi ChElementShellANCF_3833 : public ChElementANCF,
     /// vector.
     virtual void ComputeInternalForces(ChVectorDynamic<>& Fi) override;
 
+    /// Check if this element can be batched with the specified element for the internal force calculation.
+    /// Batching is supported for the "Continuous Integration" style method, for elements with identical reference
+    /// configuration shape up to a translation (hence identical precomputed shape function derivatives), layers, and
+    /// damping.
+    virtual bool IsBatchCompatible(ChElementBase* other) override;
+
+    /// Compute the generalized internal force vectors of a batch of elements at once.
+    /// The per-element fixed-size matrix products are replaced with products over all elements in the batch, and the
+    /// strain and stress calculations are vectorized across both the Gauss quadrature points and the elements.
+    virtual void ComputeInternalForcesBatch(const std::vector<ChElementBase*>& batch,
+                                            std::vector<ChVectorDynamic<>>& Fi) override;
+
     /// Set H as a linear combination of M, K, and R.
     ///   H = Mfactor * [M] + Kfactor * [K] + Rfactor * [R],
     /// where [M] is the mass matrix, [K] is the stiffness matrix, and [R] is the damping matrix.
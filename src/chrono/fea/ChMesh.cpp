@@ -13,11 +13,13 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
@@ -27,6 +29,7 @@
 #include "chrono/fea/ChElementTetraCorot_4.h"
 #include "chrono/fea/ChMesh.h"
 #include "chrono/fea/ChNodeFEAxyz.h"
+#include "chrono/fea/ChNodeFEAxyzD.h"
 #include "chrono/fea/ChNodeFEAxyzrot.h"
 
 namespace chrono {
@@ -35,6 +38,7 @@ namespace fea {
 ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
     vnodes = other.vnodes;
     velements = other.velements;
+    slots_num_nodes = 0;
 
     n_dofs = other.n_dofs;
     n_dofs_w = other.n_dofs_w;
@@ -44,9 +48,16 @@ ChMesh::ChMesh(const ChMesh& other) : ChIndexedNodes(other) {
 
     automatic_gravity_load = other.automatic_gravity_load;
     num_points_gravity = other.num_points_gravity;
+    batch_size = other.batch_size;
 
     ncalls_internal_forces = 0;
     ncalls_KRMload = 0;
+    nskips_KRMload = 0;
+
+    jacobian_tolerance = other.jacobian_tolerance;
+    jacobian_factors[0] = 0;
+    jacobian_factors[1] = 0;
+    jacobian_factors[2] = 0;
 }
 
 void ChMesh::SetupInitial() {
@@ -67,6 +78,103 @@ void ChMesh::SetupInitial() {
         // precompute matrices, such as the [Kl] local stiffness of each element, if needed, etc.
         velements[i]->SetupInitial(GetSystem());
     }
+
+    ColorElements();
+
+    // Discard the cached states for lazy Jacobian updates
+    jacobian_states.clear();
+}
+
+void ChMesh::ColorElements() {
+    // Index all nodes referenced by the elements
+    std::unordered_map<ChNodeFEAbase*, unsigned int> node_index;
+    for (unsigned int i = 0; i < vnodes.size(); i++)
+        node_index.emplace(vnodes[i].get(), i);
+
+    // Greedy coloring, using a bitmask of the colors already used by the elements connected to each node
+    std::vector<uint64_t> masks(vnodes.size(), 0);
+    std::vector<int> colors(velements.size());
+    std::vector<unsigned int> count(65, 0);
+    int num_colors = 0;
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        auto& elem = velements[ie];
+        uint64_t used = 0;
+        for (int in = 0; in < elem->GetNnodes(); in++) {
+            auto res = node_index.emplace(elem->GetNodeN(in).get(), (unsigned int)masks.size());
+            if (res.second)
+                masks.push_back(0);
+            used |= masks[res.first->second];
+        }
+        int color = 0;
+        while (color < 64 && (used & (uint64_t(1) << color)))
+            color++;
+        if (color < 64) {
+            for (int in = 0; in < elem->GetNnodes(); in++)
+                masks[node_index[elem->GetNodeN(in).get()]] |= uint64_t(1) << color;
+            num_colors = std::max(num_colors, color + 1);
+        }
+        colors[ie] = color;  // color 64 collects the serial elements
+        count[color]++;
+    }
+
+    // Sort the elements by color (counting sort, preserving the element order within each color)
+    elem_color_start.assign(num_colors + 2, 0);
+    for (int c = 0; c < num_colors; c++)
+        elem_color_start[c + 1] = elem_color_start[c] + count[c];
+    elem_color_start[num_colors + 1] = elem_color_start[num_colors] + count[64];
+    elem_order.resize(velements.size());
+    std::vector<unsigned int> fill(elem_color_start.begin(), elem_color_start.end() - 1);
+    for (unsigned int ie = 0; ie < velements.size(); ie++) {
+        int c = colors[ie] < 64 ? colors[ie] : num_colors;
+        elem_order[fill[c]++] = ie;
+    }
+    elem_color_start.pop_back();
+
+    // Batches must be rebuilt for the new coloring
+    elem_batch_start.clear();
+}
+
+void ChMesh::BatchElements() {
+    elem_batch_start.clear();
+    color_batch_start.clear();
+    if (batch_size <= 0)
+        return;
+
+    // Process all element colors, plus the serial elements
+    unsigned int num_colors = GetNumElementColors();
+    for (unsigned int c = 0; c <= num_colors; c++) {
+        color_batch_start.push_back((unsigned int)elem_batch_start.size());
+        unsigned int start = elem_color_start[c];
+        unsigned int end = (c < num_colors) ? elem_color_start[c + 1] : (unsigned int)elem_order.size();
+        unsigned int leader = start;
+        for (unsigned int k = start; k < end; k++) {
+            if (k == start || k - leader >= (unsigned int)batch_size ||
+                !velements[elem_order[leader]]->IsBatchCompatible(velements[elem_order[k]].get())) {
+                elem_batch_start.push_back(k);
+                leader = k;
+            }
+        }
+    }
+    color_batch_start.push_back((unsigned int)elem_batch_start.size());
+    elem_batch_start.push_back((unsigned int)elem_order.size());
+}
+
+template <typename Function>
+void ChMesh::ForEachElementColored(int nthreads, Function func) {
+    if (elem_order.size() != velements.size())
+        ColorElements();
+
+    unsigned int num_colors = GetNumElementColors();
+    for (unsigned int c = 0; c < num_colors; c++) {
+        int start = (int)elem_color_start[c];
+        int end = (int)elem_color_start[c + 1];
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
+        for (int k = start; k < end; k++)
+            func(velements[elem_order[k]].get());
+    }
+
+    for (size_t k = elem_color_start.back(); k < elem_order.size(); k++)
+        func(velements[elem_order[k]].get());
 }
 
 void ChMesh::Relax() {
@@ -107,6 +215,7 @@ void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
 void ChMesh::ClearElements() {
     velements.clear();
     vcontactsurfaces.clear();
+    element_pools.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -118,6 +227,8 @@ void ChMesh::ClearNodes() {
     velements.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
+    node_pools.clear();
+    element_pools.clear();
 
     // If the mesh is already added to a system, mark the system out-of-date
     if (system) {
@@ -155,6 +266,46 @@ void ChMesh::Setup() {
             n_dofs_w += vnodes[i]->GetNdofW_active();
         }
     }
+
+    BuildNodeSlots();
+}
+
+void ChMesh::BuildNodeSlots() {
+    slots_active.clear();
+    slots_xyz.clear();
+    slots_xyzD.clear();
+    slots_other.clear();
+    slots_gravity.clear();
+    slots_gravity_rot.clear();
+
+    unsigned int local_off_x = 0;
+    unsigned int local_off_w = 0;
+    for (unsigned int i = 0; i < vnodes.size(); i++) {
+        if (vnodes[i]->IsFixed())
+            continue;
+        ChNodeFEAbase* node = vnodes[i].get();
+        NodeSlot slot = {node, local_off_x, local_off_w};
+        local_off_x += node->GetNdofX_active();
+        local_off_w += node->GetNdofW_active();
+
+        slots_active.push_back(slot);
+
+        // Nodes of the most common types are processed without virtual calls in the state gather/scatter loops
+        const std::type_info& type = typeid(*node);
+        if (type == typeid(ChNodeFEAxyz))
+            slots_xyz.push_back(slot);
+        else if (type == typeid(ChNodeFEAxyzD) && !static_cast<ChNodeFEAxyzD*>(node)->IsFixedD())
+            slots_xyzD.push_back(slot);
+        else
+            slots_other.push_back(slot);
+
+        if (dynamic_cast<ChNodeFEAxyz*>(node))
+            slots_gravity.push_back(slot);
+        else if (dynamic_cast<ChNodeFEAxyzrot*>(node))
+            slots_gravity_rot.push_back(slot);
+    }
+
+    slots_num_nodes = vnodes.size();
 }
 
 // Updates all time-dependant variables, if any...
@@ -192,19 +343,40 @@ void ChMesh::RemoveCollisionModelsFromSystem() {
 
 //// STATE BOOKKEEPING FUNCTIONS
 
+// Note: the loops over nodes below write to disjoint segments of the state vectors, so they can run in parallel.
+
 void ChMesh::IntStateGather(const unsigned int off_x,
                             ChState& x,
                             const unsigned int off_v,
                             ChStateDelta& v,
                             double& T) {
-    unsigned int local_off_x = 0;
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntStateGather(off_x + local_off_x, x, off_v + local_off_v, v, T);
-            local_off_x += vnodes[j]->GetNdofX_active();
-            local_off_v += vnodes[j]->GetNdofW_active();
-        }
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < slots_xyz.size(); i++) {
+        const auto& slot = slots_xyz[i];
+        auto node = static_cast<ChNodeFEAxyz*>(slot.node);
+        x.segment(off_x + slot.off_x, 3) = node->GetPos().eigen();
+        v.segment(off_v + slot.off_w, 3) = node->GetPos_dt().eigen();
+    }
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < slots_xyzD.size(); i++) {
+        const auto& slot = slots_xyzD[i];
+        auto node = static_cast<ChNodeFEAxyzD*>(slot.node);
+        x.segment(off_x + slot.off_x, 3) = node->GetPos().eigen();
+        x.segment(off_x + slot.off_x + 3, 3) = node->GetD().eigen();
+        v.segment(off_v + slot.off_w, 3) = node->GetPos_dt().eigen();
+        v.segment(off_v + slot.off_w + 3, 3) = node->GetD_dt().eigen();
+    }
+
+    double T_node;
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads) private(T_node)
+    for (int i = 0; i < slots_other.size(); i++) {
+        const auto& slot = slots_other[i];
+        slot.node->NodeIntStateGather(off_x + slot.off_x, x, off_v + slot.off_w, v, T_node);
     }
 
     T = GetChTime();
@@ -216,36 +388,58 @@ void ChMesh::IntStateScatter(const unsigned int off_x,
                              const ChStateDelta& v,
                              const double T,
                              bool full_update) {
-    unsigned int local_off_x = 0;
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntStateScatter(off_x + local_off_x, x, off_v + local_off_v, v, T);
-            local_off_x += vnodes[j]->GetNdofX_active();
-            local_off_v += vnodes[j]->GetNdofW_active();
-        }
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < slots_xyz.size(); i++) {
+        const auto& slot = slots_xyz[i];
+        auto node = static_cast<ChNodeFEAxyz*>(slot.node);
+        node->SetPos(x.segment(off_x + slot.off_x, 3));
+        node->SetPos_dt(v.segment(off_v + slot.off_w, 3));
+    }
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < slots_xyzD.size(); i++) {
+        const auto& slot = slots_xyzD[i];
+        auto node = static_cast<ChNodeFEAxyzD*>(slot.node);
+        node->SetPos(x.segment(off_x + slot.off_x, 3));
+        node->SetD(x.segment(off_x + slot.off_x + 3, 3));
+        node->SetPos_dt(v.segment(off_v + slot.off_w, 3));
+        node->SetD_dt(v.segment(off_v + slot.off_w + 3, 3));
+    }
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < slots_other.size(); i++) {
+        const auto& slot = slots_other[i];
+        slot.node->NodeIntStateScatter(off_x + slot.off_x, x, off_v + slot.off_w, v, T);
     }
 
     Update(T, full_update);
 }
 
 void ChMesh::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
-    unsigned int local_off_a = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntStateGatherAcceleration(off_a + local_off_a, a);
-            local_off_a += vnodes[j]->GetNdofW_active();
-        }
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < slots_active.size(); i++) {
+        const auto& slot = slots_active[i];
+        slot.node->NodeIntStateGatherAcceleration(off_a + slot.off_w, a);
     }
 }
 
 void ChMesh::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
-    unsigned int local_off_a = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntStateScatterAcceleration(off_a + local_off_a, a);
-            local_off_a += vnodes[j]->GetNdofW_active();
-        }
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < slots_active.size(); i++) {
+        const auto& slot = slots_active[i];
+        slot.node->NodeIntStateScatterAcceleration(off_a + slot.off_w, a);
     }
 }
 
@@ -254,15 +448,16 @@ void ChMesh::IntStateIncrement(const unsigned int off_x,
                                const ChState& x,
                                const unsigned int off_v,
                                const ChStateDelta& Dv) {
-    unsigned int local_off_x = 0;
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntStateIncrement(off_x + local_off_x, x_new, x, off_v + local_off_v, Dv);
-            local_off_x += vnodes[j]->GetNdofX_active();
-            local_off_v += vnodes[j]->GetNdofW_active();
-        }
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < slots_active.size(); i++) {
+        const auto& slot = slots_active[i];
+        slot.node->NodeIntStateIncrement(off_x + slot.off_x, x_new, x, off_v + slot.off_w, Dv);
     }
+
     for (unsigned int ie = 0; ie < velements.size(); ie++) {
         velements[ie]->EleDoIntegration();
     }
@@ -273,66 +468,92 @@ void ChMesh::IntStateGetIncrement(const unsigned int off_x,
                                   const ChState& x,
                                   const unsigned int off_v,
                                   ChStateDelta& Dv) {
-    unsigned int local_off_x = 0;
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntStateGetIncrement(off_x + local_off_x, x_new, x, off_v + local_off_v, Dv);
-            local_off_x += vnodes[j]->GetNdofX_active();
-            local_off_v += vnodes[j]->GetNdofW_active();
-        }
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < slots_active.size(); i++) {
+        const auto& slot = slots_active[i];
+        slot.node->NodeIntStateGetIncrement(off_x + slot.off_x, x_new, x, off_v + slot.off_w, Dv);
     }
 }
 
 void ChMesh::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
     // nodes applied forces
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntLoadResidual_F(off + local_off_v, R, c);
-            local_off_v += vnodes[j]->GetNdofW_active();
-        }
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < slots_active.size(); i++) {
+        const auto& slot = slots_active[i];
+        slot.node->NodeIntLoadResidual_F(off + slot.off_w, R, c);
     }
 
-    int nthreads = GetSystem()->nthreads_chrono;
-
     // elements internal forces
+    // (parallel within each element color, so that there are no race conditions in writing to R)
     timer_internal_forces.start();
-    //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+    if (batch_size > 0) {
+        if (elem_order.size() != velements.size())
+            ColorElements();
+        if (elem_batch_start.empty())
+            BatchElements();
+
+        auto load_batch = [this, &R, c](unsigned int ib) {
+            unsigned int start = elem_batch_start[ib];
+            unsigned int end = elem_batch_start[ib + 1];
+            if (end - start == 1) {
+                velements[elem_order[start]]->EleIntLoadResidual_F(R, c);
+                return;
+            }
+            std::vector<ChElementBase*> batch;
+            for (unsigned int k = start; k < end; k++)
+                batch.push_back(velements[elem_order[k]].get());
+            std::vector<ChVectorDynamic<>> Fi(batch.size());
+            batch[0]->ComputeInternalForcesBatch(batch, Fi);
+            for (size_t k = 0; k < batch.size(); k++)
+                batch[k]->EleIntLoadResidual_Forces(R, Fi[k], c);
+        };
+
+        unsigned int num_colors = GetNumElementColors();
+        for (unsigned int ic = 0; ic < num_colors; ic++) {
+            int start = (int)color_batch_start[ic];
+            int end = (int)color_batch_start[ic + 1];
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads)
+            for (int ib = start; ib < end; ib++)
+                load_batch(ib);
+        }
+        for (unsigned int ib = color_batch_start[num_colors]; ib < color_batch_start[num_colors + 1]; ib++)
+            load_batch(ib);
+    } else {
+        ForEachElementColored(nthreads, [&R, c](ChElementBase* elem) { elem->EleIntLoadResidual_F(R, c); });
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
 
     // elements gravity forces
     if (automatic_gravity_load) {
-        //***PARALLEL FOR***, must use omp atomic to avoid race condition in writing to R
-#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        for (int ie = 0; ie < velements.size(); ie++) {
-            velements[ie]->EleIntLoadResidual_F_gravity(R, GetSystem()->Get_G_acc(), c);
-        }
+        ChVector<> G_acc = GetSystem()->Get_G_acc();
+        ForEachElementColored(nthreads,
+                              [&R, &G_acc, c](ChElementBase* elem) { elem->EleIntLoadResidual_F_gravity(R, G_acc, c); });
     }
 
     // nodes gravity forces
-    local_off_v = 0;
+    // (each node writes to its own entries of R, so there is no race condition)
     if (automatic_gravity_load && system) {
-        //#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads)
-        //***PARALLEL FOR***, (no need here to use omp atomic to avoid race condition in writing to R)
-        for (int in = 0; in < vnodes.size(); in++) {
-            if (!vnodes[in]->IsFixed()) {
-                if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyz>(vnodes[in])) {
-                    ChVector<> fg = c * mnode->GetMass() * system->Get_G_acc();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
-                }
-                // ChNodeFEAxyzrot is not inherited from ChNodeFEAxyz, so must deal with it too
-                if (auto mnode = std::dynamic_pointer_cast<ChNodeFEAxyzrot>(vnodes[in])) {
-                    ChVector<> fg = c * mnode->GetMass() * system->Get_G_acc();
-                    R.segment(off + local_off_v, 3) += fg.eigen();
-                }
-                local_off_v += vnodes[in]->GetNdofW_active();
-            }
+        ChVector<> fg_acc = c * system->Get_G_acc();
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+        for (int i = 0; i < slots_gravity.size(); i++) {
+            const auto& slot = slots_gravity[i];
+            ChVector<> fg = static_cast<ChNodeFEAxyz*>(slot.node)->GetMass() * fg_acc;
+            R.segment(off + slot.off_w, 3) += fg.eigen();
+        }
+        // ChNodeFEAxyzrot is not inherited from ChNodeFEAxyz, so must deal with it too
+        for (int i = 0; i < slots_gravity_rot.size(); i++) {
+            const auto& slot = slots_gravity_rot[i];
+            ChVector<> fg = static_cast<ChNodeFEAxyzrot*>(slot.node)->GetMass() * fg_acc;
+            R.segment(off + slot.off_w, 3) += fg.eigen();
         }
     }
 }
@@ -364,19 +585,20 @@ void ChMesh::IntLoadResidual_Mv(const unsigned int off,      ///< offset in R re
                                 const ChVectorDynamic<>& w,  ///< the w vector
                                 const double c               ///< a scaling factor
 ) {
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
     // nodal masses
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntLoadResidual_Mv(off + local_off_v, R, w, c);
-            local_off_v += vnodes[j]->GetNdofW_active();
-        }
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < slots_active.size(); i++) {
+        const auto& slot = slots_active[i];
+        slot.node->NodeIntLoadResidual_Mv(off + slot.off_w, R, w, c);
     }
 
     // internal masses
-    for (unsigned int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_Mv(R, w, c);
-    }
+    // (parallel within each element color, so that there are no race conditions in writing to R)
+    ForEachElementColored(nthreads, [&R, &w, c](ChElementBase* elem) { elem->EleIntLoadResidual_Mv(R, w, c); });
 }
 
 void ChMesh::IntToDescriptor(const unsigned int off_v,
@@ -385,12 +607,14 @@ void ChMesh::IntToDescriptor(const unsigned int off_v,
                              const unsigned int off_L,
                              const ChVectorDynamic<>& L,
                              const ChVectorDynamic<>& Qc) {
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntToDescriptor(off_v + local_off_v, v, R);
-            local_off_v += vnodes[j]->GetNdofW_active();
-        }
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < slots_active.size(); i++) {
+        const auto& slot = slots_active[i];
+        slot.node->NodeIntToDescriptor(off_v + slot.off_w, v, R);
     }
 }
 
@@ -398,12 +622,14 @@ void ChMesh::IntFromDescriptor(const unsigned int off_v,
                                ChStateDelta& v,
                                const unsigned int off_L,
                                ChVectorDynamic<>& L) {
-    unsigned int local_off_v = 0;
-    for (unsigned int j = 0; j < vnodes.size(); j++) {
-        if (!vnodes[j]->IsFixed()) {
-            vnodes[j]->NodeIntFromDescriptor(off_v + local_off_v, v);
-            local_off_v += vnodes[j]->GetNdofW_active();
-        }
+    if (slots_num_nodes != vnodes.size())
+        BuildNodeSlots();
+    int nthreads = GetSystem()->nthreads_chrono;
+
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < slots_active.size(); i++) {
+        const auto& slot = slots_active[i];
+        slot.node->NodeIntFromDescriptor(off_v + slot.off_w, v);
     }
 }
 
@@ -414,13 +640,70 @@ void ChMesh::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
         velements[ie]->InjectKRMmatrices(mdescriptor);
 }
 
+bool ChMesh::NeedsJacobianUpdate(unsigned int ie,
+                                 double Kfactor,
+                                 double Rfactor,
+                                 double Mfactor,
+                                 ChVectorDynamic<>& state) {
+    // Gather the positions and velocities of all nodes of the element
+    auto& elem = velements[ie];
+    int size = 0;
+    for (int in = 0; in < elem->GetNnodes(); in++) {
+        auto node = elem->GetNodeN(in);
+        size += node->GetNdofX() + node->GetNdofW();
+    }
+    ChState x(size, nullptr);
+    ChStateDelta v(size, nullptr);
+    state.resize(size);
+    int off = 0;
+    double T;
+    for (int in = 0; in < elem->GetNnodes(); in++) {
+        auto node = elem->GetNodeN(in);
+        int nx = node->GetNdofX();
+        int nw = node->GetNdofW();
+        node->NodeIntStateGather(0, x, 0, v, T);
+        state.segment(off, nx) = x.segment(0, nx);
+        state.segment(off + nx, nw) = v.segment(0, nw);
+        off += nx + nw;
+    }
+
+    if (Kfactor != jacobian_factors[0] || Rfactor != jacobian_factors[1] || Mfactor != jacobian_factors[2])
+        return true;
+
+    const auto& old_state = jacobian_states[ie];
+    return old_state.size() != size || (state - old_state).lpNorm<Eigen::Infinity>() > jacobian_tolerance;
+}
+
 void ChMesh::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
     int nthreads = GetSystem()->nthreads_chrono;
 
     timer_KRMload.start();
+    if (jacobian_tolerance <= 0) {
 #pragma omp parallel for num_threads(nthreads)
-    for (int ie = 0; ie < velements.size(); ie++)
-        velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+        for (int ie = 0; ie < velements.size(); ie++)
+            velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+    } else {
+        // Lazy Jacobian update: recompute only the element Jacobians whose nodal states changed
+        if (jacobian_states.size() != velements.size()) {
+            jacobian_states.clear();
+            jacobian_states.resize(velements.size());
+        }
+        int nskips = 0;
+#pragma omp parallel for schedule(dynamic, 4) num_threads(nthreads) reduction(+ : nskips)
+        for (int ie = 0; ie < velements.size(); ie++) {
+            ChVectorDynamic<> state;
+            if (NeedsJacobianUpdate(ie, Kfactor, Rfactor, Mfactor, state)) {
+                velements[ie]->KRMmatricesLoad(Kfactor, Rfactor, Mfactor);
+                jacobian_states[ie] = state;
+            } else {
+                nskips++;
+            }
+        }
+        nskips_KRMload += nskips;
+        jacobian_factors[0] = Kfactor;
+        jacobian_factors[1] = Rfactor;
+        jacobian_factors[2] = Mfactor;
+    }
     timer_KRMload.stop();
     ncalls_KRMload++;
 }
@@ -15,14 +15,18 @@
 #ifndef CHMESH_H
 #define CHMESH_H
 
+#include <algorithm>
 #include <cstdlib>
 #include <cmath>
+#include <typeindex>
+#include <unordered_map>
 
 #include "chrono/core/ChTimer.h"
 #include "chrono/physics/ChIndexedNodes.h"
 #include "chrono/fea/ChContinuumMaterial.h"
 #include "chrono/fea/ChContactSurface.h"
 #include "chrono/fea/ChElementBase.h"
+#include "chrono/fea/ChMeshPool.h"
 #include "chrono/fea/ChMeshSurface.h"
 #include "chrono/fea/ChNodeFEAbase.h"
 
@@ -43,6 +47,24 @@ class ChApi ChMesh : public ChIndexedNodes {
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
 
+    /// Active node and offsets of its states, relative to the mesh offsets.
+    struct NodeSlot {
+        ChNodeFEAbase* node;
+        unsigned int off_x;
+        unsigned int off_w;
+    };
+
+    std::unordered_map<std::type_index, std::shared_ptr<ChMeshPoolBase>> node_pools;     ///< node arenas, per type
+    std::unordered_map<std::type_index, std::shared_ptr<ChMeshPoolBase>> element_pools;  ///< element arenas, per type
+
+    size_t slots_num_nodes;                   ///< number of mesh nodes when the node slots were built
+    std::vector<NodeSlot> slots_active;       ///< all active nodes
+    std::vector<NodeSlot> slots_xyz;          ///< active nodes of type ChNodeFEAxyz
+    std::vector<NodeSlot> slots_xyzD;         ///< active nodes of type ChNodeFEAxyzD, with active D
+    std::vector<NodeSlot> slots_other;        ///< all other active nodes
+    std::vector<NodeSlot> slots_gravity;      ///< active nodes derived from ChNodeFEAxyz
+    std::vector<NodeSlot> slots_gravity_rot;  ///< active nodes derived from ChNodeFEAxyzrot
+
     unsigned int n_dofs;    ///< total degrees of freedom
     unsigned int n_dofs_w;  ///< total degrees of freedom, derivative (Lie algebra)
 
@@ -52,19 +74,36 @@ class ChApi ChMesh : public ChIndexedNodes {
     bool automatic_gravity_load;
     int num_points_gravity;
 
+    std::vector<unsigned int> elem_order;        ///< element indices, sorted by color
+    std::vector<unsigned int> elem_color_start;  ///< start of each color in elem_order (plus start of serial elements)
+
+    int batch_size;                              ///< maximum number of elements in a batch (0: no batched evaluation)
+    std::vector<unsigned int> elem_batch_start;  ///< start of each element batch in elem_order (plus end)
+    std::vector<unsigned int> color_batch_start; ///< first batch of each color (plus serial batches, plus end)
+
     ChTimer timer_internal_forces;
     ChTimer timer_KRMload;
     int ncalls_internal_forces;
     int ncalls_KRMload;
+    int nskips_KRMload;
+
+    double jacobian_tolerance;                             ///< tolerance for lazy Jacobian updates (0: disabled)
+    double jacobian_factors[3];                            ///< K, R, M factors of last Jacobian load
+    std::vector<ChVectorDynamic<>> jacobian_states;        ///< element nodal states at last Jacobian evaluation
 
   public:
     ChMesh()
-        : n_dofs(0),
+        : slots_num_nodes(0),
+          n_dofs(0),
           n_dofs_w(0),
           automatic_gravity_load(true),
           num_points_gravity(1),
+          batch_size(0),
           ncalls_internal_forces(0),
-          ncalls_KRMload(0) {}
+          ncalls_KRMload(0),
+          nskips_KRMload(0),
+          jacobian_tolerance(0),
+          jacobian_factors{0, 0, 0} {}
     ChMesh(const ChMesh& other);
     ~ChMesh() {}
 
@@ -73,6 +112,26 @@ class ChApi ChMesh : public ChIndexedNodes {
 
     void AddNode(std::shared_ptr<ChNodeFEAbase> m_node);
     void AddElement(std::shared_ptr<ChElementBase> m_elem);
+
+    /// Construct a node of type T in pooled storage and add it to the mesh.
+    /// Nodes created this way are stored contiguously, per type, which improves the memory locality of the state
+    /// gather/scatter and residual loops over large meshes. The returned handle can be used as any other node
+    /// handle; note however that the memory of a pooled node is released only together with its whole pool chunk.
+    template <class T, typename... Args>
+    std::shared_ptr<T> CreateNode(Args&&... args) {
+        auto node = GetPool<T>(node_pools).Create(std::forward<Args>(args)...);
+        AddNode(node);
+        return node;
+    }
+
+    /// Construct an element of type T in pooled storage and add it to the mesh.
+    /// See CreateNode.
+    template <class T, typename... Args>
+    std::shared_ptr<T> CreateElement(Args&&... args) {
+        auto elem = GetPool<T>(element_pools).Create(std::forward<Args>(args)...);
+        AddElement(elem);
+        return elem;
+    }
     void ClearNodes();
     void ClearElements();
 
@@ -104,11 +163,27 @@ class ChApi ChMesh : public ChIndexedNodes {
     void ResetCounters() {
         ncalls_internal_forces = 0;
         ncalls_KRMload = 0;
+        nskips_KRMload = 0;
     }
     /// Get cumulative number of calls to internal forces evaluation.
     int GetNumCallsInternalForces() { return ncalls_internal_forces; }
     /// Get cumulative number of calls to load Jacobian information.
     int GetNumCallsJacobianLoad() { return ncalls_KRMload; }
+    /// Get cumulative number of element Jacobian evaluations skipped by lazy Jacobian updates.
+    int GetNumSkippedElementJacobians() { return nskips_KRMload; }
+
+    /// Enable lazy updates of the element Jacobians (default: 0, disabled).
+    /// If the tolerance is positive, the K, R, M matrices of an element are not recomputed in KRMmatricesLoad when
+    /// none of the element nodal positions and velocities changed by more than the given tolerance (in the infinity
+    /// norm) since the last evaluation of that element Jacobian, and the K, R, M factors did not change.
+    /// This can save many element Jacobian evaluations in Newton iterations, at the price of using slightly outdated
+    /// Jacobians. The cached Jacobians are discarded at system initialization.
+    void SetJacobianUpdateTolerance(double tol) {
+        jacobian_tolerance = tol;
+        jacobian_states.clear();
+    }
+    /// Get the tolerance for lazy updates of the element Jacobians.
+    double GetJacobianUpdateTolerance() const { return jacobian_tolerance; }
 
     /// Reset timers for internal force and Jacobian evaluations.
     void ResetTimers() {
@@ -120,6 +195,28 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// Get cumulative time for Jacobian load calls.
     double GetTimeJacobianLoad() { return timer_KRMload(); }
 
+    /// Get the number of element colors used for the parallel assembly of element loads.
+    /// Elements with the same color share no nodes, so that their contributions to global vectors can be loaded
+    /// concurrently without synchronization. The coloring is updated at system initialization.
+    unsigned int GetNumElementColors() const {
+        return elem_color_start.empty() ? 0 : (unsigned int)elem_color_start.size() - 1;
+    }
+
+    /// Enable batched evaluation of the element internal forces (default: disabled).
+    /// If enabled, consecutive elements with the same color that are batch-compatible (see
+    /// ChElementBase::IsBatchCompatible) are grouped in batches of up to the specified size and their internal forces
+    /// are computed together with ChElementBase::ComputeInternalForcesBatch. Element types that support batching can
+    /// then evaluate many elements at once with data layouts that vectorize across elements.
+    void SetBatchedInternalForces(bool val, int max_batch_size = 8) {
+        batch_size = val ? std::max(max_batch_size, 1) : 0;
+        elem_batch_start.clear();
+    }
+
+    /// Get the number of element batches used for the evaluation of internal forces (0 if batching is disabled).
+    unsigned int GetNumElementBatches() const {
+        return elem_batch_start.empty() ? 0 : (unsigned int)elem_batch_start.size() - 1;
+    }
+
     /// Add a contact surface.
     void AddContactSurface(std::shared_ptr<ChContactSurface> m_surf);
 
@@ -285,6 +382,33 @@ class ChApi ChMesh : public ChIndexedNodes {
     /// </pre>
     virtual void SetupInitial() override;
 
+    /// Return the pool for items of type T, creating it if needed.
+    template <class T>
+    static ChMeshPool<T>& GetPool(std::unordered_map<std::type_index, std::shared_ptr<ChMeshPoolBase>>& pools) {
+        auto& pool = pools[std::type_index(typeid(T))];
+        if (!pool)
+            pool = std::make_shared<ChMeshPool<T>>();
+        return static_cast<ChMeshPool<T>&>(*pool);
+    }
+
+    /// Collect the active nodes and their state offsets, sorted by node type, for the state and residual loops.
+    void BuildNodeSlots();
+
+    /// Partition the elements into colors, such that elements with the same color share no nodes.
+    /// Elements that cannot be assigned one of the maximum 64 colors are processed serially, after all colors.
+    void ColorElements();
+
+    /// Return true if the Jacobian of the specified element must be recomputed with the given factors.
+    /// The element nodal states are gathered in the provided scratch vectors.
+    bool NeedsJacobianUpdate(unsigned int ie, double Kfactor, double Rfactor, double Mfactor, ChVectorDynamic<>& state);
+
+    /// Group consecutive batch-compatible elements within each element color.
+    void BatchElements();
+
+    /// Execute the given function for all elements, in parallel within each element color.
+    template <typename Function>
+    void ForEachElementColored(int nthreads, Function func);
+
     friend class chrono::ChSystem;
     friend class chrono::ChAssembly;
     friend class chrono::modal::ChModalAssembly;
@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHMESHPOOL_H
+#define CHMESHPOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace chrono {
+namespace fea {
+
+/// @addtogroup chrono_fea
+/// @{
+
+/// Base class for typed pools of mesh items (see ChMeshPool).
+class ChMeshPoolBase {
+  public:
+    virtual ~ChMeshPoolBase() {}
+
+    /// Return the number of items created in this pool.
+    virtual size_t size() const = 0;
+};
+
+/// Arena storage for FEA nodes or elements of a given type.
+/// Items are constructed in place, one after the other, in contiguous cache-aligned chunks, so that the nodes and
+/// elements of a large mesh are laid out sequentially in memory rather than scattered across the heap. Each item is
+/// handed out as a std::shared_ptr that shares ownership of the chunk containing it: a chunk (and all items in it)
+/// is destroyed only when the pool and all handles to its items have been released.
+template <class T>
+class ChMeshPool : public ChMeshPoolBase {
+  public:
+    ChMeshPool() : m_size(0) {}
+
+    /// Return the number of items created in this pool.
+    virtual size_t size() const override { return m_size; }
+
+    /// Construct a new item with the given arguments and return a handle to it.
+    template <typename... Args>
+    std::shared_ptr<T> Create(Args&&... args) {
+        if (m_chunks.empty() || m_chunks.back()->m_count == CHUNK_SIZE)
+            m_chunks.push_back(std::make_shared<Chunk>());
+        auto& chunk = m_chunks.back();
+        T* item = new (chunk->Slot(chunk->m_count)) T(std::forward<Args>(args)...);
+        chunk->m_count++;
+        m_size++;
+        return std::shared_ptr<T>(chunk, item);
+    }
+
+  private:
+    static const size_t CHUNK_BITS = 8;
+    static const size_t CHUNK_SIZE = size_t(1) << CHUNK_BITS;
+    static const size_t ALIGNMENT = alignof(T) > 64 ? alignof(T) : 64;
+
+    struct Chunk {
+        Chunk() : m_buffer(new unsigned char[CHUNK_SIZE * sizeof(T) + ALIGNMENT]), m_count(0) {
+            auto addr = reinterpret_cast<std::uintptr_t>(m_buffer.get());
+            m_data = m_buffer.get() + (ALIGNMENT - addr % ALIGNMENT) % ALIGNMENT;
+        }
+        ~Chunk() {
+            for (size_t i = m_count; i > 0; i--)
+                reinterpret_cast<T*>(Slot(i - 1))->~T();
+        }
+        void* Slot(size_t i) { return m_data + i * sizeof(T); }
+
+        std::unique_ptr<unsigned char[]> m_buffer;
+        unsigned char* m_data;
+        size_t m_count;
+    };
+
+    std::vector<std::shared_ptr<Chunk>> m_chunks;
+    size_t m_size;
+};
+
+/// @} chrono_fea
+
+}  // end namespace fea
+}  // end namespace chrono
+
+#endif
@@ -25,6 +25,7 @@
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChFilePS.h"
 #include "chrono/core/ChMath.h"
+#include "chrono/serialization/ChCheckpoint.h"
 
 namespace chrono {
 
@@ -152,6 +153,12 @@ class ChApi ChFunction {
     /// If set mode, x and y values are stored. Return false if handle not found.
     virtual bool HandleAccess(int handle_id, double mx, double my, bool set_mode) { return true; }
 
+    /// Write the internal state of the function (if any) to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const {}
+
+    /// Read the internal state of the function (if any) from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) {}
+
     /// Method to allow serialization of transient data to archives
     virtual void ArchiveOUT(ChArchiveOut& marchive);
 
@@ -31,6 +31,24 @@ void ChFunction_Setpoint::SetSetpoint(double setpoint, double x) {
     last_Y_dx = Y_dx;
 }
 
+void ChFunction_Setpoint::CheckpointOut(ChCheckpointOut& cp) const {
+    cp.Write(Y);
+    cp.Write(Y_dx);
+    cp.Write(Y_dxdx);
+    cp.Write(last_x);
+    cp.Write(last_Y);
+    cp.Write(last_Y_dx);
+}
+
+void ChFunction_Setpoint::CheckpointIn(ChCheckpointIn& cp) {
+    cp.Read(Y);
+    cp.Read(Y_dx);
+    cp.Read(Y_dxdx);
+    cp.Read(last_x);
+    cp.Read(last_Y);
+    cp.Read(last_Y_dx);
+}
+
 void ChFunction_Setpoint::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChFunction_Setpoint>();
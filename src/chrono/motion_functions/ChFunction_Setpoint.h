@@ -86,6 +86,12 @@ class ChApi ChFunction_Setpoint : public ChFunction {
     /// Update could be implemented by children classes, ex. to launch callbacks
     virtual void Update(const double x) override {}
 
+    /// Write the current setpoint and its derivatives to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const override;
+
+    /// Read the current setpoint and its derivatives from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -15,6 +15,7 @@
 #include <algorithm>
 #include <cstdlib>
 
+#include "chrono/core/ChException.h"
 #include "chrono/core/ChGlobal.h"
 #include "chrono/core/ChTransform.h"
 #include "chrono/physics/ChAssembly.h"
@@ -47,8 +48,8 @@ ChAssembly::ChAssembly()
       nsysvars_w(0),
       ndof(0),
       ndoc_w_C(0),
-      ndoc_w_D(0)
-       {}
+      ndoc_w_D(0),
+      parallel_threshold(512) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nbodies = other.nbodies;
@@ -66,6 +67,7 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     ndoc_w = other.ndoc_w;
     ndoc_w_C = other.ndoc_w_C;
     ndoc_w_D = other.ndoc_w_D;
+    parallel_threshold = other.parallel_threshold;
     ndof = other.ndof;
     nsysvars = other.nsysvars;
     nsysvars_w = other.nsysvars_w;
@@ -107,6 +109,7 @@ void swap(ChAssembly& first, ChAssembly& second) {
     swap(first.ndoc_w, second.ndoc_w);
     swap(first.ndoc_w_C, second.ndoc_w_C);
     swap(first.ndoc_w_D, second.ndoc_w_D);
+    swap(first.parallel_threshold, second.parallel_threshold);
     swap(first.ndof, second.ndof);
     swap(first.nsysvars, second.nsysvars);
     swap(first.nsysvars_w, second.nsysvars_w);
@@ -635,10 +638,21 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // Updates all forces (automatic, as children of bodies)
 // Updates all markers (automatic, as children of bodies).
 void ChAssembly::Update(bool update_assets) {
-    //// NOTE: do not switch these to range for loops (may want to use OMP for)
+    UpdateItems(update_assets);
+    UpdateMeshes(update_assets);
+}
+
+void ChAssembly::UpdateItems(bool update_assets) {
+    //// NOTE: do not switch these to range for loops (OMP for)
+    // Bodies and shafts only update their own data (and that of their markers and forces).
+    // Links and other physics items are updated serially, as they may also modify connected items.
+    int nthreads = GetNumThreadsForList(bodylist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
     for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
         bodylist[ip]->Update(ChTime, update_assets);
     }
+    nthreads = GetNumThreadsForList(shaftlist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
     for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
         shaftlist[ip]->Update(ChTime, update_assets);
     }
@@ -648,11 +662,20 @@ void ChAssembly::Update(bool update_assets) {
     for (int ip = 0; ip < (int)linklist.size(); ++ip) {
         linklist[ip]->Update(ChTime, update_assets);
     }
+}
+
+void ChAssembly::UpdateMeshes(bool update_assets) {
     for (int ip = 0; ip < (int)meshlist.size(); ++ip) {
         meshlist[ip]->Update(ChTime, update_assets);
     }
 }
 
+int ChAssembly::GetNumThreadsForList(size_t size) const {
+    if (!system || (int)size < parallel_threshold)
+        return 1;
+    return system->GetNumThreadsChrono();
+}
+
 void ChAssembly::SetNoSpeedNoAcceleration() {
     for (auto& body : bodylist) {
         body->SetNoSpeedNoAcceleration();
@@ -679,17 +702,30 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    // Bodies, shafts, and links write to disjoint sections of the state vectors (and the time is set below)
+    int nthreads = GetNumThreadsForList(bodylist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
+        double T_item;
         if (body->IsActive())
-            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T);
+            body->IntStateGather(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T_item);
     }
-    for (auto& shaft : shaftlist) {
+    nthreads = GetNumThreadsForList(shaftlist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+        auto& shaft = shaftlist[ip];
+        double T_item;
         if (shaft->IsActive())
-            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T);
+            shaft->IntStateGather(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T_item);
     }
-    for (auto& link : linklist) {
+    nthreads = GetNumThreadsForList(linklist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        auto& link = linklist[ip];
+        double T_item;
         if (link->IsActive())
-            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T);
+            link->IntStateGather(displ_x + link->GetOffset_x(), x, displ_v + link->GetOffset_w(), v, T_item);
     }
     for (auto& mesh : meshlist) {
         mesh->IntStateGather(displ_x + mesh->GetOffset_x(), x, displ_v + mesh->GetOffset_w(), v, T);
@@ -714,17 +750,26 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     // 2. Order below is *important*
     //    - in particular, bodies and meshes must be processed *before* links, so that links can use
     //      up-to-date body and node information
+    // 3. Bodies and shafts are processed in parallel (see SetParallelThreshold); each one only reads its own section
+    //    of the state vectors and only updates its own data. Links are processed serially, as their update may
+    //    modify the markers of the connected bodies.
 
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    int nthreads = GetNumThreadsForList(bodylist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateScatter(displ_x + body->GetOffset_x(), x, displ_v + body->GetOffset_w(), v, T, full_update);
-        else
+        else if (!body->GetSleeping())  // sleeping bodies do not move; they are updated when woken up
             body->Update(T, full_update);
     }
-    for (auto& shaft : shaftlist) {
+    nthreads = GetNumThreadsForList(shaftlist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateScatter(displ_x + shaft->GetOffset_x(), x, displ_v + shaft->GetOffset_w(), v, T, full_update);
         else
@@ -853,17 +898,27 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (auto& body : bodylist) {
+    // Bodies, shafts, and links write to disjoint sections of the new state vector
+    int nthreads = GetNumThreadsForList(bodylist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntStateIncrement(displ_x + body->GetOffset_x(), x_new, x, displ_v + body->GetOffset_w(), Dv);
     }
 
-    for (auto& shaft : shaftlist) {
+    nthreads = GetNumThreadsForList(shaftlist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntStateIncrement(displ_x + shaft->GetOffset_x(), x_new, x, displ_v + shaft->GetOffset_w(), Dv);
     }
 
-    for (auto& link : linklist) {
+    nthreads = GetNumThreadsForList(linklist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        auto& link = linklist[ip];
         if (link->IsActive())
             link->IntStateIncrement(displ_x + link->GetOffset_x(), x_new, x, displ_v + link->GetOffset_w(), Dv);
     }
@@ -917,11 +972,19 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
-    for (auto& body : bodylist) {
+    // Bodies and shafts load forces in their own section of the residual.
+    // Links, meshes, and other physics items are loaded serially, as they may load forces on connected items.
+    int nthreads = GetNumThreadsForList(bodylist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        auto& body = bodylist[ip];
         if (body->IsActive())
             body->IntLoadResidual_F(displ_v + body->GetOffset_w(), R, c);
     }
-    for (auto& shaft : shaftlist) {
+    nthreads = GetNumThreadsForList(shaftlist.size());
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int ip = 0; ip < (int)shaftlist.size(); ++ip) {
+        auto& shaft = shaftlist[ip];
         if (shaft->IsActive())
             shaft->IntLoadResidual_F(displ_v + shaft->GetOffset_w(), R, c);
     }
@@ -1478,6 +1541,50 @@ void ChAssembly::ShowHierarchy(ChStreamOutAscii& m_file, int level) const {
     m_file << "\n\n";
 }
 
+// -----------------------------------------------------------------------------
+// CHECKPOINTING
+
+template <class T>
+static void CheckpointOutList(ChCheckpointOut& cp, const std::vector<std::shared_ptr<T>>& list) {
+    cp.Write((uint64_t)list.size());
+    for (const auto& item : list) {
+        cp.BeginBlock();
+        item->CheckpointOut(cp);
+        cp.EndBlock();
+    }
+}
+
+template <class T>
+static void CheckpointInList(ChCheckpointIn& cp, const std::vector<std::shared_ptr<T>>& list) {
+    uint64_t size;
+    cp.Read(size);
+    if (size != (uint64_t)list.size())
+        throw ChException("Checkpoint data inconsistent with the system (number of items)");
+    for (const auto& item : list) {
+        cp.BeginBlock();
+        item->CheckpointIn(cp);
+        cp.EndBlock();
+    }
+}
+
+void ChAssembly::CheckpointOut(ChCheckpointOut& cp) {
+    CheckpointOutList(cp, bodylist);
+    CheckpointOutList(cp, shaftlist);
+    CheckpointOutList(cp, linklist);
+    CheckpointOutList(cp, meshlist);
+    CheckpointOutList(cp, otherphysicslist);
+}
+
+void ChAssembly::CheckpointIn(ChCheckpointIn& cp) {
+    CheckpointInList(cp, bodylist);
+    CheckpointInList(cp, shaftlist);
+    CheckpointInList(cp, linklist);
+    CheckpointInList(cp, meshlist);
+    CheckpointInList(cp, otherphysicslist);
+}
+
+// -----------------------------------------------------------------------------
+
 void ChAssembly::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChAssembly>();
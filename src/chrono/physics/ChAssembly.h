@@ -185,6 +185,18 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Get the number of system variables (coordinates plus the constraint multipliers).
     int GetNsysvars_w() const { return nsysvars_w; }
 
+    /// Set the minimum list size for parallel processing of the assembly items (default: 512).
+    /// The lists of bodies, shafts, and links with at least this many items are processed in parallel, in contiguous
+    /// chunks, by the state functions of this assembly (state gather/scatter/increment, residual loading, update),
+    /// using the number of threads of the containing system (see ChSystem::SetNumThreads). Each item only accesses
+    /// its own section of the state vectors (at the offsets computed in Setup), so the results do not depend on the
+    /// number of threads. Items that may load forces on other items (links, meshes, other physics items) are loaded
+    /// serially in the residual. Smaller lists are always processed serially.
+    void SetParallelThreshold(int threshold) { parallel_threshold = threshold; }
+
+    /// Get the minimum list size for parallel processing of the assembly items.
+    int GetParallelThreshold() const { return parallel_threshold; }
+
     //
     // PHYSICS ITEM INTERFACE
     //
@@ -297,6 +309,16 @@ class ChApi ChAssembly : public ChPhysicsItem {
     virtual void ConstraintsFbLoadForces(double factor = 1) override;
     virtual void ConstraintsFetch_react(double factor = 1) override;
 
+    //
+    // CHECKPOINTING
+    //
+
+    /// Write the internal state of all items in this assembly to a binary checkpoint (one block per item).
+    virtual void CheckpointOut(ChCheckpointOut& cp) override;
+
+    /// Read the internal state of all items in this assembly from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     //
     // SERIALIZATION
     //
@@ -321,6 +343,15 @@ class ChApi ChAssembly : public ChPhysicsItem {
   protected:
     virtual void SetupInitial() override;
 
+    /// Return the number of threads for processing a list of the given size.
+    int GetNumThreadsForList(size_t size) const;
+
+    /// Update all items except the meshes (bodies, shafts, other physics items, and links, in this order).
+    void UpdateItems(bool update_assets);
+
+    /// Update the meshes. Mesh updates only access the mesh nodes and elements.
+    void UpdateMeshes(bool update_assets);
+
     std::vector<std::shared_ptr<ChBody>> bodylist;                 ///< list of rigid bodies
     std::vector<std::shared_ptr<ChShaft>> shaftlist;               ///< list of 1-D shafts
     std::vector<std::shared_ptr<ChLinkBase>> linklist;             ///< list of joints (links)
@@ -349,6 +380,8 @@ class ChApi ChAssembly : public ChPhysicsItem {
     int ndoc_w_C;    ///< number of scalar constraints C, when using 3 rot. dof. per body (excluding unilaterals)
     int ndoc_w_D;    ///< number of scalar constraints D, when using 3 rot. dof. per body (only unilaterals)
 
+    int parallel_threshold;  ///< minimum list size for parallel processing
+
     friend class ChSystem;
     friend class ChSystemMulticore;
     friend class ChSystemDistributed;
@@ -1062,6 +1062,47 @@ void ChBody::ComputeNF(
     detJ = 1;  // not needed because not used in quadrature.
 }
 
+// ---------------------------------------------------------------------------
+// CHECKPOINTING
+
+void ChBody::CheckpointOut(ChCheckpointOut& cp) {
+    cp.Write((uint8_t)BFlagGet(BodyFlag::SLEEPING));
+    cp.Write((uint8_t)BFlagGet(BodyFlag::COULDSLEEP));
+    cp.Write(sleep_starttime);
+    cp.Write(Force_acc.x());
+    cp.Write(Force_acc.y());
+    cp.Write(Force_acc.z());
+    cp.Write(Torque_acc.x());
+    cp.Write(Torque_acc.y());
+    cp.Write(Torque_acc.z());
+
+    // Exact rotation derivatives (the angular velocity and acceleration in the state do not reproduce them exactly)
+    for (int i = 0; i < 4; i++) {
+        cp.Write(coord_dt.rot[i]);
+        cp.Write(coord_dtdt.rot[i]);
+    }
+}
+
+void ChBody::CheckpointIn(ChCheckpointIn& cp) {
+    uint8_t sleeping, could_sleep;
+    cp.Read(sleeping);
+    cp.Read(could_sleep);
+    BFlagSet(BodyFlag::SLEEPING, sleeping != 0);
+    BFlagSet(BodyFlag::COULDSLEEP, could_sleep != 0);
+    cp.Read(sleep_starttime);
+    cp.Read(Force_acc.x());
+    cp.Read(Force_acc.y());
+    cp.Read(Force_acc.z());
+    cp.Read(Torque_acc.x());
+    cp.Read(Torque_acc.y());
+    cp.Read(Torque_acc.z());
+
+    for (int i = 0; i < 4; i++) {
+        cp.Read(coord_dt.rot[i]);
+        cp.Read(coord_dtdt.rot[i]);
+    }
+}
+
 // ---------------------------------------------------------------------------
 // FILE I/O
 
@@ -429,6 +429,14 @@ class ChApi ChBody : public ChPhysicsItem, public ChBodyFrame, public ChContacta
     /// This is only for backward compatibility
     virtual ChPhysicsItem* GetPhysicsItem() override { return this; }
 
+    // CHECKPOINTING
+
+    /// Write the sleeping state and the force accumulators to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) override;
+
+    /// Read the sleeping state and the force accumulators from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     // SERIALIZATION
 
     /// Method to allow serialization of transient data to archives.
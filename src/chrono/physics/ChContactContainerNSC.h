@@ -224,8 +224,9 @@ class ChApi ChContactContainerNSC : public ChContactContainer {
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
 
-  private:
-    void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat);
+  protected:
+    /// Create (or reuse) a contact of the appropriate type and store it in this container.
+    virtual void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat);
 };
 
 CH_CLASS_VERSION(ChContactContainerNSC, 0)
@@ -0,0 +1,564 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include "chrono/physics/ChContactContainerPooledNSC.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+using namespace collision;
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChContactContainerPooledNSC)
+
+ChContactContainerPooledNSC::ChContactContainerPooledNSC() {}
+
+ChContactContainerPooledNSC::ChContactContainerPooledNSC(const ChContactContainerPooledNSC& other)
+    : ChContactContainerNSC(other) {}
+
+ChContactContainerPooledNSC::~ChContactContainerPooledNSC() {
+    RemoveAllContacts();
+}
+
+int ChContactContainerPooledNSC::GetNcontacts() const {
+    return (int)(pool_6_6.size() + pool_6_3.size() + pool_3_3.size() + pool_333_3.size() + pool_333_6.size() +
+                 pool_333_333.size() + pool_666_3.size() + pool_666_6.size() + pool_666_333.size() +
+                 pool_666_666.size() + pool_6_6_rolling.size());
+}
+
+int ChContactContainerPooledNSC::GetDOC_d() {
+    return (int)(3 * (pool_6_6.size() + pool_6_3.size() + pool_3_3.size() + pool_333_3.size() + pool_333_6.size() +
+                      pool_333_333.size() + pool_666_3.size() + pool_666_6.size() + pool_666_333.size() +
+                      pool_666_666.size()) +
+                 6 * pool_6_6_rolling.size());
+}
+
+void ChContactContainerPooledNSC::RemoveAllContacts() {
+    pool_6_6.Clear();
+    pool_6_3.Clear();
+    pool_3_3.Clear();
+    pool_333_3.Clear();
+    pool_333_6.Clear();
+    pool_333_333.Clear();
+    pool_666_3.Clear();
+    pool_666_6.Clear();
+    pool_666_333.Clear();
+    pool_666_666.Clear();
+    pool_6_6_rolling.Clear();
+}
+
+void ChContactContainerPooledNSC::BeginAddContact() {
+    pool_6_6.Rewind();
+    pool_6_3.Rewind();
+    pool_3_3.Rewind();
+    pool_333_3.Rewind();
+    pool_333_6.Rewind();
+    pool_333_333.Rewind();
+    pool_666_3.Rewind();
+    pool_666_6.Rewind();
+    pool_666_333.Rewind();
+    pool_666_666.Rewind();
+    pool_6_6_rolling.Rewind();
+}
+
+void ChContactContainerPooledNSC::EndAddContact() {
+    // nothing to do: contacts beyond the last one added are kept in the pools for later reuse
+}
+
+template <class Tcont, class Ta, class Tb>
+void _PooledContactInsert(ChContactPool<Tcont>& pool,               // contact pool
+                          ChContactContainer* container,            // contact container
+                          Ta* objA,                                 // collidable object A
+                          Tb* objB,                                 // collidable object B
+                          const collision::ChCollisionInfo& cinfo,  // collision information
+                          const ChMaterialCompositeNSC& cmat        // composite material
+) {
+    Tcont* mc = pool.Acquire();
+    mc->SetContactContainer(container);
+    mc->Reset(objA, objB, cinfo, cmat);
+}
+
+void ChContactContainerPooledNSC::InsertContact(const collision::ChCollisionInfo& cinfo,
+                                                const ChMaterialCompositeNSC& cmat) {
+    auto contactableA = cinfo.modelA->GetContactable();
+    auto contactableB = cinfo.modelB->GetContactable();
+
+    // See ChContactContainerNSC::InsertContact for the dispatching among the various contact types.
+    switch (contactableA->GetContactableType()) {
+        case ChContactable::CONTACTABLE_3: {
+            auto objA = static_cast<ChContactable_1vars<3>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 3_3
+                _PooledContactInsert(pool_3_3, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 3_6 -> 6_3
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsert(pool_6_3, this, objB, objA, swapped_cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 3_333 -> 333_3
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsert(pool_333_3, this, objB, objA, swapped_cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 3_666 -> 666_3
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsert(pool_666_3, this, objB, objA, swapped_cinfo, cmat);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_6: {
+            auto objA = static_cast<ChContactable_1vars<6>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 6_3
+                _PooledContactInsert(pool_6_3, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 6_6 (with rolling friction, if needed)
+                if (cmat.rolling_friction || cmat.spinning_friction) {
+                    _PooledContactInsert(pool_6_6_rolling, this, objA, objB, cinfo, cmat);
+                } else {
+                    _PooledContactInsert(pool_6_6, this, objA, objB, cinfo, cmat);
+                }
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 6_333 -> 333_6
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsert(pool_333_6, this, objB, objA, swapped_cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 6_666 -> 666_6
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsert(pool_666_6, this, objB, objA, swapped_cinfo, cmat);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_333: {
+            auto objA = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 333_3
+                _PooledContactInsert(pool_333_3, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 333_6
+                _PooledContactInsert(pool_333_6, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 333_333
+                _PooledContactInsert(pool_333_333, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 333_666 -> 666_333
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsert(pool_666_333, this, objB, objA, swapped_cinfo, cmat);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_666: {
+            auto objA = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 666_3
+                _PooledContactInsert(pool_666_3, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 666_6
+                _PooledContactInsert(pool_666_6, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 666_333
+                _PooledContactInsert(pool_666_333, this, objA, objB, cinfo, cmat);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 666_666
+                _PooledContactInsert(pool_666_666, this, objA, objB, cinfo, cmat);
+            }
+        } break;
+
+        default:
+            break;
+    }
+}
+
+void ChContactContainerPooledNSC::ComputeContactForces() {
+    contact_forces.clear();
+    SumAllContactForces(pool_6_6, contact_forces);
+    SumAllContactForces(pool_6_3, contact_forces);
+    SumAllContactForces(pool_3_3, contact_forces);
+    SumAllContactForces(pool_333_3, contact_forces);
+    SumAllContactForces(pool_333_6, contact_forces);
+    SumAllContactForces(pool_333_333, contact_forces);
+    SumAllContactForces(pool_666_3, contact_forces);
+    SumAllContactForces(pool_666_6, contact_forces);
+    SumAllContactForces(pool_666_333, contact_forces);
+    SumAllContactForces(pool_666_666, contact_forces);
+    SumAllContactForces(pool_6_6_rolling, contact_forces);
+}
+
+template <class Tcont>
+ChVector<> _PooledContactTorque(Tcont* contact) {
+    return VNULL;
+}
+
+ChVector<> _PooledContactTorque(ChContactContainerNSC::ChContactNSCrolling_6_6* contact) {
+    return contact->GetContactTorque();
+}
+
+template <class Tcont>
+void _PooledReportAllContacts(ChContactPool<Tcont>& pool, ChContactContainer::ReportContactCallback* mcallback) {
+    for (auto contact : pool) {
+        bool proceed = mcallback->OnReportContact(
+            contact->GetContactP1(), contact->GetContactP2(), contact->GetContactPlane(), contact->GetContactDistance(),
+            contact->GetEffectiveCurvatureRadius(), contact->GetContactForce(),
+            _PooledContactTorque(contact), contact->GetObjA(), contact->GetObjB());
+        if (!proceed)
+            break;
+    }
+}
+
+void ChContactContainerPooledNSC::ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) {
+    _PooledReportAllContacts(pool_6_6, callback.get());
+    _PooledReportAllContacts(pool_6_3, callback.get());
+    _PooledReportAllContacts(pool_3_3, callback.get());
+    _PooledReportAllContacts(pool_333_3, callback.get());
+    _PooledReportAllContacts(pool_333_6, callback.get());
+    _PooledReportAllContacts(pool_333_333, callback.get());
+    _PooledReportAllContacts(pool_666_3, callback.get());
+    _PooledReportAllContacts(pool_666_6, callback.get());
+    _PooledReportAllContacts(pool_666_333, callback.get());
+    _PooledReportAllContacts(pool_666_666, callback.get());
+    _PooledReportAllContacts(pool_6_6_rolling, callback.get());
+}
+
+template <class Tcont>
+void _PooledReportAllContactsNSC(ChContactPool<Tcont>& pool,
+                                 ChContactContainerNSC::ReportContactCallbackNSC* mcallback) {
+    for (auto contact : pool) {
+        bool proceed = mcallback->OnReportContact(
+            contact->GetContactP1(), contact->GetContactP2(), contact->GetContactPlane(), contact->GetContactDistance(),
+            contact->GetEffectiveCurvatureRadius(), contact->GetContactForce(),
+            _PooledContactTorque(contact), contact->GetObjA(), contact->GetObjB(),
+            contact->GetConstraintNx()->GetOffset());
+        if (!proceed)
+            break;
+    }
+}
+
+void ChContactContainerPooledNSC::ReportAllContactsNSC(std::shared_ptr<ReportContactCallbackNSC> callback) {
+    _PooledReportAllContactsNSC(pool_6_6, callback.get());
+    _PooledReportAllContactsNSC(pool_6_3, callback.get());
+    _PooledReportAllContactsNSC(pool_3_3, callback.get());
+    _PooledReportAllContactsNSC(pool_333_3, callback.get());
+    _PooledReportAllContactsNSC(pool_333_6, callback.get());
+    _PooledReportAllContactsNSC(pool_333_333, callback.get());
+    _PooledReportAllContactsNSC(pool_666_3, callback.get());
+    _PooledReportAllContactsNSC(pool_666_6, callback.get());
+    _PooledReportAllContactsNSC(pool_666_333, callback.get());
+    _PooledReportAllContactsNSC(pool_666_666, callback.get());
+    _PooledReportAllContactsNSC(pool_6_6_rolling, callback.get());
+}
+
+////////// STATE INTERFACE ////
+
+template <class Tcont>
+void _PooledIntStateGatherReactions(unsigned int& coffset,
+                                    ChContactPool<Tcont>& pool,
+                                    const unsigned int off_L,
+                                    ChVectorDynamic<>& L,
+                                    const int stride) {
+    for (size_t i = 0; i < pool.size(); i++) {
+        pool[i].ContIntStateGatherReactions(off_L + coffset, L);
+        coffset += stride;
+    }
+}
+
+void ChContactContainerPooledNSC::IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) {
+    unsigned int coffset = 0;
+    _PooledIntStateGatherReactions(coffset, pool_6_6, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_6_3, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_3_3, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_333_3, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_333_6, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_333_333, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_666_3, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_666_6, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_666_333, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_666_666, off_L, L, 3);
+    _PooledIntStateGatherReactions(coffset, pool_6_6_rolling, off_L, L, 6);
+}
+
+template <class Tcont>
+void _PooledIntStateScatterReactions(unsigned int& coffset,
+                                     ChContactPool<Tcont>& pool,
+                                     const unsigned int off_L,
+                                     const ChVectorDynamic<>& L,
+                                     const int stride) {
+    for (size_t i = 0; i < pool.size(); i++) {
+        pool[i].ContIntStateScatterReactions(off_L + coffset, L);
+        coffset += stride;
+    }
+}
+
+void ChContactContainerPooledNSC::IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) {
+    unsigned int coffset = 0;
+    _PooledIntStateScatterReactions(coffset, pool_6_6, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_6_3, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_3_3, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_333_3, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_333_6, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_333_333, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_666_3, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_666_6, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_666_333, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_666_666, off_L, L, 3);
+    _PooledIntStateScatterReactions(coffset, pool_6_6_rolling, off_L, L, 6);
+}
+
+template <class Tcont>
+void _PooledIntLoadResidual_CqL(unsigned int& coffset,       // offset of the contacts
+                                ChContactPool<Tcont>& pool,  // pool of contacts
+                                const unsigned int off_L,    // offset in L multipliers
+                                ChVectorDynamic<>& R,        // result: the R residual, R += c*Cq'*L
+                                const ChVectorDynamic<>& L,  // the L vector
+                                const double c,              // a scaling factor
+                                const int stride             // stride
+) {
+    for (size_t i = 0; i < pool.size(); i++) {
+        pool[i].ContIntLoadResidual_CqL(off_L + coffset, R, L, c);
+        coffset += stride;
+    }
+}
+
+void ChContactContainerPooledNSC::IntLoadResidual_CqL(const unsigned int off_L,
+                                                      ChVectorDynamic<>& R,
+                                                      const ChVectorDynamic<>& L,
+                                                      const double c) {
+    unsigned int coffset = 0;
+    _PooledIntLoadResidual_CqL(coffset, pool_6_6, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_6_3, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_3_3, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_333_3, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_333_6, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_333_333, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_666_3, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_666_6, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_666_333, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_666_666, off_L, R, L, c, 3);
+    _PooledIntLoadResidual_CqL(coffset, pool_6_6_rolling, off_L, R, L, c, 6);
+}
+
+template <class Tcont>
+void _PooledIntLoadConstraint_C(unsigned int& coffset,       // contact offset
+                                ChContactPool<Tcont>& pool,  // pool of contacts
+                                const unsigned int off,      // offset in Qc residual
+                                ChVectorDynamic<>& Qc,       // result: the Qc residual, Qc += c*C
+                                const double c,              // a scaling factor
+                                bool do_clamp,               // apply clamping to c*C?
+                                double recovery_clamp,       // value for min/max clamping of c*C
+                                const int stride             // stride
+) {
+    for (size_t i = 0; i < pool.size(); i++) {
+        pool[i].ContIntLoadConstraint_C(off + coffset, Qc, c, do_clamp, recovery_clamp);
+        coffset += stride;
+    }
+}
+
+void ChContactContainerPooledNSC::IntLoadConstraint_C(const unsigned int off,
+                                                      ChVectorDynamic<>& Qc,
+                                                      const double c,
+                                                      bool do_clamp,
+                                                      double recovery_clamp) {
+    unsigned int coffset = 0;
+    _PooledIntLoadConstraint_C(coffset, pool_6_6, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_6_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_3_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_333_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_333_6, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_333_333, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_666_3, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_666_6, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_666_333, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_666_666, off, Qc, c, do_clamp, recovery_clamp, 3);
+    _PooledIntLoadConstraint_C(coffset, pool_6_6_rolling, off, Qc, c, do_clamp, recovery_clamp, 6);
+}
+
+template <class Tcont>
+void _PooledIntToDescriptor(unsigned int& coffset,
+                            ChContactPool<Tcont>& pool,
+                            const unsigned int off_L,
+                            const ChVectorDynamic<>& L,
+                            const ChVectorDynamic<>& Qc,
+                            const int stride) {
+    for (size_t i = 0; i < pool.size(); i++) {
+        pool[i].ContIntToDescriptor(off_L + coffset, L, Qc);
+        coffset += stride;
+    }
+}
+
+void ChContactContainerPooledNSC::IntToDescriptor(const unsigned int off_v,
+                                                  const ChStateDelta& v,
+                                                  const ChVectorDynamic<>& R,
+                                                  const unsigned int off_L,
+                                                  const ChVectorDynamic<>& L,
+                                                  const ChVectorDynamic<>& Qc) {
+    unsigned int coffset = 0;
+    _PooledIntToDescriptor(coffset, pool_6_6, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_6_3, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_3_3, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_333_3, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_333_6, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_333_333, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_666_3, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_666_6, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_666_333, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_666_666, off_L, L, Qc, 3);
+    _PooledIntToDescriptor(coffset, pool_6_6_rolling, off_L, L, Qc, 6);
+}
+
+template <class Tcont>
+void _PooledIntFromDescriptor(unsigned int& coffset,
+                              ChContactPool<Tcont>& pool,
+                              const unsigned int off_L,
+                              ChVectorDynamic<>& L,
+                              const int stride) {
+    for (size_t i = 0; i < pool.size(); i++) {
+        pool[i].ContIntFromDescriptor(off_L + coffset, L);
+        coffset += stride;
+    }
+}
+
+void ChContactContainerPooledNSC::IntFromDescriptor(const unsigned int off_v,
+                                                    ChStateDelta& v,
+                                                    const unsigned int off_L,
+                                                    ChVectorDynamic<>& L) {
+    unsigned int coffset = 0;
+    _PooledIntFromDescriptor(coffset, pool_6_6, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_6_3, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_3_3, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_333_3, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_333_6, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_333_333, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_666_3, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_666_6, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_666_333, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_666_666, off_L, L, 3);
+    _PooledIntFromDescriptor(coffset, pool_6_6_rolling, off_L, L, 6);
+}
+
+// SOLVER INTERFACES
+
+template <class Tcont>
+void _PooledInjectConstraints(ChContactPool<Tcont>& pool, ChSystemDescriptor& mdescriptor) {
+    for (size_t i = 0; i < pool.size(); i++)
+        pool[i].InjectConstraints(mdescriptor);
+}
+
+void ChContactContainerPooledNSC::InjectConstraints(ChSystemDescriptor& mdescriptor) {
+    _PooledInjectConstraints(pool_6_6, mdescriptor);
+    _PooledInjectConstraints(pool_6_3, mdescriptor);
+    _PooledInjectConstraints(pool_3_3, mdescriptor);
+    _PooledInjectConstraints(pool_333_3, mdescriptor);
+    _PooledInjectConstraints(pool_333_6, mdescriptor);
+    _PooledInjectConstraints(pool_333_333, mdescriptor);
+    _PooledInjectConstraints(pool_666_3, mdescriptor);
+    _PooledInjectConstraints(pool_666_6, mdescriptor);
+    _PooledInjectConstraints(pool_666_333, mdescriptor);
+    _PooledInjectConstraints(pool_666_666, mdescriptor);
+    _PooledInjectConstraints(pool_6_6_rolling, mdescriptor);
+}
+
+template <class Tcont>
+void _PooledConstraintsBiReset(ChContactPool<Tcont>& pool) {
+    for (size_t i = 0; i < pool.size(); i++)
+        pool[i].ConstraintsBiReset();
+}
+
+void ChContactContainerPooledNSC::ConstraintsBiReset() {
+    _PooledConstraintsBiReset(pool_6_6);
+    _PooledConstraintsBiReset(pool_6_3);
+    _PooledConstraintsBiReset(pool_3_3);
+    _PooledConstraintsBiReset(pool_333_3);
+    _PooledConstraintsBiReset(pool_333_6);
+    _PooledConstraintsBiReset(pool_333_333);
+    _PooledConstraintsBiReset(pool_666_3);
+    _PooledConstraintsBiReset(pool_666_6);
+    _PooledConstraintsBiReset(pool_666_333);
+    _PooledConstraintsBiReset(pool_666_666);
+    _PooledConstraintsBiReset(pool_6_6_rolling);
+}
+
+template <class Tcont>
+void _PooledConstraintsBiLoad_C(ChContactPool<Tcont>& pool, double factor, double recovery_clamp, bool do_clamp) {
+    for (size_t i = 0; i < pool.size(); i++)
+        pool[i].ConstraintsBiLoad_C(factor, recovery_clamp, do_clamp);
+}
+
+void ChContactContainerPooledNSC::ConstraintsBiLoad_C(double factor, double recovery_clamp, bool do_clamp) {
+    _PooledConstraintsBiLoad_C(pool_6_6, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_6_3, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_3_3, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_333_3, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_333_6, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_333_333, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_666_3, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_666_6, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_666_333, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_666_666, factor, recovery_clamp, do_clamp);
+    _PooledConstraintsBiLoad_C(pool_6_6_rolling, factor, recovery_clamp, do_clamp);
+}
+
+template <class Tcont>
+void _PooledConstraintsFetch_react(ChContactPool<Tcont>& pool, double factor) {
+    for (size_t i = 0; i < pool.size(); i++)
+        pool[i].ConstraintsFetch_react(factor);
+}
+
+void ChContactContainerPooledNSC::ConstraintsFetch_react(double factor) {
+    _PooledConstraintsFetch_react(pool_6_6, factor);
+    _PooledConstraintsFetch_react(pool_6_3, factor);
+    _PooledConstraintsFetch_react(pool_3_3, factor);
+    _PooledConstraintsFetch_react(pool_333_3, factor);
+    _PooledConstraintsFetch_react(pool_333_6, factor);
+    _PooledConstraintsFetch_react(pool_333_333, factor);
+    _PooledConstraintsFetch_react(pool_666_3, factor);
+    _PooledConstraintsFetch_react(pool_666_6, factor);
+    _PooledConstraintsFetch_react(pool_666_333, factor);
+    _PooledConstraintsFetch_react(pool_666_666, factor);
+    _PooledConstraintsFetch_react(pool_6_6_rolling, factor);
+}
+
+void ChContactContainerPooledNSC::ArchiveOUT(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChContactContainerPooledNSC>();
+    // serialize parent class
+    ChContactContainerNSC::ArchiveOUT(marchive);
+    // serialize all member data:
+    // NO SERIALIZATION of contact pools because assume they are volatile and generated when needed
+}
+
+void ChContactContainerPooledNSC::ArchiveIN(ChArchiveIn& marchive) {
+    // version number
+    /*int version =*/marchive.VersionRead<ChContactContainerPooledNSC>();
+    // deserialize parent class
+    ChContactContainerNSC::ArchiveIN(marchive);
+    // stream in all member data:
+    RemoveAllContacts();
+    // NO SERIALIZATION of contact pools because assume they are volatile and generated when needed
+}
+
+}  // end namespace chrono
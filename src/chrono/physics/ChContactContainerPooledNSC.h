@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONTACTCONTAINER_POOLED_NSC_H
+#define CH_CONTACTCONTAINER_POOLED_NSC_H
+
+#include "chrono/physics/ChContactContainerNSC.h"
+#include "chrono/physics/ChContactPool.h"
+
+namespace chrono {
+
+/// Class representing a container of many non-smooth contacts, using pooled contiguous storage.
+/// This is a drop-in replacement for ChContactContainerNSC (it can be set with ChSystemNSC::SetContactContainer).
+/// Contacts of each type are stored in a ChContactPool, i.e. in contiguous chunks of contact objects which are
+/// recycled from step to step. Compared to the linked lists of individually allocated contacts used by
+/// ChContactContainerNSC, this avoids heap traffic when the number of contacts changes and improves memory locality
+/// in all per-step passes over the contacts (state gather/scatter, constraint loading, descriptor injection).
+/// Contact storage is never released while the simulation runs; use RemoveAllContacts to free it.
+class ChApi ChContactContainerPooledNSC : public ChContactContainerNSC {
+  public:
+    ChContactContainerPooledNSC();
+    ChContactContainerPooledNSC(const ChContactContainerPooledNSC& other);
+    virtual ~ChContactContainerPooledNSC();
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChContactContainerPooledNSC* Clone() const override { return new ChContactContainerPooledNSC(*this); }
+
+    /// Report the number of added contacts.
+    virtual int GetNcontacts() const override;
+
+    /// Remove all contained contact data and release the pooled storage.
+    virtual void RemoveAllContacts() override;
+
+    /// The collision system will call BeginAddContact() before adding all contacts.
+    /// This implementation rewinds all contact pools, so that the contact objects from the previous step are recycled.
+    virtual void BeginAddContact() override;
+
+    /// The collision system will call EndAddContact() after adding all contacts.
+    /// Unused contact objects are kept in the pools for later reuse.
+    virtual void EndAddContact() override;
+
+    /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
+    /// object.
+    virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
+
+    /// Scan all the NSC contacts and for each contact executes the OnReportContact() function of the provided callback
+    /// object.
+    virtual void ReportAllContactsNSC(std::shared_ptr<ReportContactCallbackNSC> callback) override;
+
+    /// Report the number of scalar unilateral constraints.
+    /// Note: friction constraints aren't exactly unilaterals, but they are still counted.
+    virtual int GetDOC_d() override;
+
+    /// Compute contact forces on all contactable objects in this container.
+    /// This function caches contact forces in a map.
+    virtual void ComputeContactForces() override;
+
+    //
+    // STATE FUNCTIONS
+    //
+
+    virtual void IntStateGatherReactions(const unsigned int off_L, ChVectorDynamic<>& L) override;
+    virtual void IntStateScatterReactions(const unsigned int off_L, const ChVectorDynamic<>& L) override;
+    virtual void IntLoadResidual_CqL(const unsigned int off_L,
+                                     ChVectorDynamic<>& R,
+                                     const ChVectorDynamic<>& L,
+                                     const double c) override;
+    virtual void IntLoadConstraint_C(const unsigned int off,
+                                     ChVectorDynamic<>& Qc,
+                                     const double c,
+                                     bool do_clamp,
+                                     double recovery_clamp) override;
+    virtual void IntToDescriptor(const unsigned int off_v,
+                                 const ChStateDelta& v,
+                                 const ChVectorDynamic<>& R,
+                                 const unsigned int off_L,
+                                 const ChVectorDynamic<>& L,
+                                 const ChVectorDynamic<>& Qc) override;
+    virtual void IntFromDescriptor(const unsigned int off_v,
+                                   ChStateDelta& v,
+                                   const unsigned int off_L,
+                                   ChVectorDynamic<>& L) override;
+
+    //
+    // SOLVER INTERFACE
+    //
+
+    virtual void InjectConstraints(ChSystemDescriptor& mdescriptor) override;
+    virtual void ConstraintsBiReset() override;
+    virtual void ConstraintsBiLoad_C(double factor = 1, double recovery_clamp = 0.1, bool do_clamp = false) override;
+    virtual void ConstraintsFetch_react(double factor = 1) override;
+
+    //
+    // SERIALIZATION
+    //
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOUT(ChArchiveOut& marchive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  protected:
+    virtual void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeNSC& cmat) override;
+
+    ChContactPool<ChContactNSC_6_6> pool_6_6;
+    ChContactPool<ChContactNSC_6_3> pool_6_3;
+    ChContactPool<ChContactNSC_3_3> pool_3_3;
+    ChContactPool<ChContactNSC_333_3> pool_333_3;
+    ChContactPool<ChContactNSC_333_6> pool_333_6;
+    ChContactPool<ChContactNSC_333_333> pool_333_333;
+    ChContactPool<ChContactNSC_666_3> pool_666_3;
+    ChContactPool<ChContactNSC_666_6> pool_666_6;
+    ChContactPool<ChContactNSC_666_333> pool_666_333;
+    ChContactPool<ChContactNSC_666_666> pool_666_666;
+
+    ChContactPool<ChContactNSCrolling_6_6> pool_6_6_rolling;
+};
+
+CH_CLASS_VERSION(ChContactContainerPooledNSC, 0)
+
+}  // end namespace chrono
+
+#endif
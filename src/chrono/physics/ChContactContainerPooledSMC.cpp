@@ -0,0 +1,435 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/physics/ChContactContainerPooledSMC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+namespace chrono {
+
+using namespace collision;
+
+// Register into the object factory, to enable run-time dynamic creation and persistence
+CH_FACTORY_REGISTER(ChContactContainerPooledSMC)
+
+ChContactContainerPooledSMC::ChContactContainerPooledSMC() {}
+
+ChContactContainerPooledSMC::ChContactContainerPooledSMC(const ChContactContainerPooledSMC& other)
+    : ChContactContainerSMC(other) {}
+
+ChContactContainerPooledSMC::~ChContactContainerPooledSMC() {
+    RemoveAllContacts();
+}
+
+int ChContactContainerPooledSMC::GetNcontacts() const {
+    return (int)(set_3_3.contacts.size() + set_6_3.contacts.size() + set_6_6.contacts.size() +
+                 set_333_3.contacts.size() + set_333_6.contacts.size() + set_333_333.contacts.size() +
+                 set_666_3.contacts.size() + set_666_6.contacts.size() + set_666_333.contacts.size() +
+                 set_666_666.contacts.size());
+}
+
+void ChContactContainerPooledSMC::RemoveAllContacts() {
+    set_3_3.contacts.Clear();
+    set_3_3.materials.clear();
+    set_6_3.contacts.Clear();
+    set_6_3.materials.clear();
+    set_6_6.contacts.Clear();
+    set_6_6.materials.clear();
+    set_333_3.contacts.Clear();
+    set_333_3.materials.clear();
+    set_333_6.contacts.Clear();
+    set_333_6.materials.clear();
+    set_333_333.contacts.Clear();
+    set_333_333.materials.clear();
+    set_666_3.contacts.Clear();
+    set_666_3.materials.clear();
+    set_666_6.contacts.Clear();
+    set_666_6.materials.clear();
+    set_666_333.contacts.Clear();
+    set_666_333.materials.clear();
+    set_666_666.contacts.Clear();
+    set_666_666.materials.clear();
+
+    force_entries.clear();
+    force_segments.clear();
+    force_entries_serial.clear();
+}
+
+void ChContactContainerPooledSMC::BeginAddContact() {
+    set_3_3.contacts.Rewind();
+    set_3_3.materials.clear();
+    set_6_3.contacts.Rewind();
+    set_6_3.materials.clear();
+    set_6_6.contacts.Rewind();
+    set_6_6.materials.clear();
+    set_333_3.contacts.Rewind();
+    set_333_3.materials.clear();
+    set_333_6.contacts.Rewind();
+    set_333_6.materials.clear();
+    set_333_333.contacts.Rewind();
+    set_333_333.materials.clear();
+    set_666_3.contacts.Rewind();
+    set_666_3.materials.clear();
+    set_666_6.contacts.Rewind();
+    set_666_6.materials.clear();
+    set_666_333.contacts.Rewind();
+    set_666_333.materials.clear();
+    set_666_666.contacts.Rewind();
+    set_666_666.materials.clear();
+
+    force_entries.clear();
+    force_segments.clear();
+    force_entries_serial.clear();
+
+    BeginContactHistory();
+}
+
+// Evaluate the forces of all contacts in the given set.
+// Each contact only writes to its own data, so contacts are evaluated in parallel.
+template <class Tcont>
+void ChContactContainerPooledSMC::EvaluateContacts(ContactSet<Tcont>& set, int nthreads) {
+    int ncontacts = (int)set.contacts.size();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < ncontacts; i++) {
+        set.contacts[i].Evaluate(set.materials[i]);
+    }
+}
+
+// Key for sorting the contact forces acting on an object: the object variables, if the object has a single set of
+// variables (so that all forces acting on the same variables are loaded by the same thread), or null otherwise.
+template <int T1>
+ChVariables* _PooledForceKeySMC(ChContactable_1vars<T1>* obj) {
+    return obj->GetVariables1();
+}
+
+template <int T1, int T2, int T3>
+ChVariables* _PooledForceKeySMC(ChContactable_3vars<T1, T2, T3>* obj) {
+    return nullptr;
+}
+
+template <class Tcont>
+void ChContactContainerPooledSMC::CollectForces(ContactSet<Tcont>& set) {
+    for (auto contact : set.contacts) {
+        const ChVector<>& force = contact->GetContactForceAbs();
+        auto objA = contact->GetObjA();
+        auto objB = contact->GetObjB();
+
+        ForceEntry entryA = {_PooledForceKeySMC(objA), objA, -force, contact->GetContactP1()};
+        ForceEntry entryB = {_PooledForceKeySMC(objB), objB, force, contact->GetContactP2()};
+        (entryA.key ? force_entries : force_entries_serial).push_back(entryA);
+        (entryB.key ? force_entries : force_entries_serial).push_back(entryB);
+    }
+}
+
+void ChContactContainerPooledSMC::EndAddContact() {
+    // Contacts beyond the last one added are kept in the pools for later reuse.
+
+    // Evaluate all contact forces
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+    EvaluateContacts(set_3_3, nthreads);
+    EvaluateContacts(set_6_3, nthreads);
+    EvaluateContacts(set_6_6, nthreads);
+    EvaluateContacts(set_333_3, nthreads);
+    EvaluateContacts(set_333_6, nthreads);
+    EvaluateContacts(set_333_333, nthreads);
+    EvaluateContacts(set_666_3, nthreads);
+    EvaluateContacts(set_666_6, nthreads);
+    EvaluateContacts(set_666_333, nthreads);
+    EvaluateContacts(set_666_666, nthreads);
+
+    // Collect the forces acting on each object and sort them by object variables.
+    // The sort is stable, so that the forces on each object are loaded in the order of the contacts.
+    CollectForces(set_3_3);
+    CollectForces(set_6_3);
+    CollectForces(set_6_6);
+    CollectForces(set_333_3);
+    CollectForces(set_333_6);
+    CollectForces(set_333_333);
+    CollectForces(set_666_3);
+    CollectForces(set_666_6);
+    CollectForces(set_666_333);
+    CollectForces(set_666_666);
+
+    std::stable_sort(force_entries.begin(), force_entries.end(),
+                     [](const ForceEntry& a, const ForceEntry& b) { return a.key < b.key; });
+
+    force_segments.clear();
+    for (size_t i = 0; i < force_entries.size(); i++) {
+        if (i == 0 || force_entries[i].key != force_entries[i - 1].key)
+            force_segments.push_back(i);
+    }
+    force_segments.push_back(force_entries.size());
+
+    EndContactHistory();
+}
+
+template <class Tcont, class Ta, class Tb>
+void _PooledContactInsertSMC(ChContactPool<Tcont>& pool,                     // contact pool
+                             std::vector<ChMaterialCompositeSMC>& materials,  // composite materials
+                             ChContactContainer* container,                   // contact container
+                             Ta* objA,                                        // collidable object A
+                             Tb* objB,                                        // collidable object B
+                             const collision::ChCollisionInfo& cinfo,         // collision information
+                             const ChMaterialCompositeSMC& cmat,              // composite material
+                             ChContactHistorySMC* history                     // contact history (may be null)
+) {
+    // Only set the contact geometry here; the contact force is calculated in EndAddContact
+    Tcont* mc = pool.Acquire();
+    mc->SetContactContainer(container);
+    mc->Reset_cinfo(objA, objB, cinfo);
+    mc->SetHistory(history, cinfo);
+    materials.push_back(cmat);
+}
+
+void ChContactContainerPooledSMC::InsertContact(const collision::ChCollisionInfo& cinfo,
+                                                const ChMaterialCompositeSMC& cmat) {
+    auto contactableA = cinfo.modelA->GetContactable();
+    auto contactableB = cinfo.modelB->GetContactable();
+
+    ChContactHistorySMC* history = FindContactHistory(cinfo);
+
+    // See ChContactContainerSMC::InsertContact for the dispatching among the various contact types.
+    switch (contactableA->GetContactableType()) {
+        case ChContactable::CONTACTABLE_3: {
+            auto objA = static_cast<ChContactable_1vars<3>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 3_3
+                _PooledContactInsertSMC(set_3_3.contacts, set_3_3.materials, this, objA, objB, cinfo, cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 3_6 -> 6_3
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsertSMC(set_6_3.contacts, set_6_3.materials, this, objB, objA, swapped_cinfo,
+                                        cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 3_333 -> 333_3
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsertSMC(set_333_3.contacts, set_333_3.materials, this, objB, objA, swapped_cinfo,
+                                        cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 3_666 -> 666_3
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsertSMC(set_666_3.contacts, set_666_3.materials, this, objB, objA, swapped_cinfo,
+                                        cmat, history);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_6: {
+            auto objA = static_cast<ChContactable_1vars<6>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 6_3
+                _PooledContactInsertSMC(set_6_3.contacts, set_6_3.materials, this, objA, objB, cinfo, cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 6_6
+                _PooledContactInsertSMC(set_6_6.contacts, set_6_6.materials, this, objA, objB, cinfo, cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 6_333 -> 333_6
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsertSMC(set_333_6.contacts, set_333_6.materials, this, objB, objA, swapped_cinfo,
+                                        cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 6_666 -> 666_6
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsertSMC(set_666_6.contacts, set_666_6.materials, this, objB, objA, swapped_cinfo,
+                                        cmat, history);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_333: {
+            auto objA = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 333_3
+                _PooledContactInsertSMC(set_333_3.contacts, set_333_3.materials, this, objA, objB, cinfo,
+                                        cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 333_6
+                _PooledContactInsertSMC(set_333_6.contacts, set_333_6.materials, this, objA, objB, cinfo,
+                                        cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 333_333
+                _PooledContactInsertSMC(set_333_333.contacts, set_333_333.materials, this, objA, objB, cinfo,
+                                        cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 333_666 -> 666_333
+                collision::ChCollisionInfo swapped_cinfo(cinfo, true);
+                _PooledContactInsertSMC(set_666_333.contacts, set_666_333.materials, this, objB, objA, swapped_cinfo,
+                                        cmat, history);
+            }
+        } break;
+
+        case ChContactable::CONTACTABLE_666: {
+            auto objA = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableA);
+            if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
+                auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
+                // 666_3
+                _PooledContactInsertSMC(set_666_3.contacts, set_666_3.materials, this, objA, objB, cinfo,
+                                        cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
+                auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
+                // 666_6
+                _PooledContactInsertSMC(set_666_6.contacts, set_666_6.materials, this, objA, objB, cinfo,
+                                        cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
+                auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
+                // 666_333
+                _PooledContactInsertSMC(set_666_333.contacts, set_666_333.materials, this, objA, objB, cinfo,
+                                        cmat, history);
+            } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
+                auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
+                // 666_666
+                _PooledContactInsertSMC(set_666_666.contacts, set_666_666.materials, this, objA, objB, cinfo,
+                                        cmat, history);
+            }
+        } break;
+
+        default:
+            break;
+    }
+}
+
+void ChContactContainerPooledSMC::ComputeContactForces() {
+    contact_forces.clear();
+    SumAllContactForces(set_3_3.contacts, contact_forces);
+    SumAllContactForces(set_6_3.contacts, contact_forces);
+    SumAllContactForces(set_6_6.contacts, contact_forces);
+    SumAllContactForces(set_333_3.contacts, contact_forces);
+    SumAllContactForces(set_333_6.contacts, contact_forces);
+    SumAllContactForces(set_333_333.contacts, contact_forces);
+    SumAllContactForces(set_666_3.contacts, contact_forces);
+    SumAllContactForces(set_666_6.contacts, contact_forces);
+    SumAllContactForces(set_666_333.contacts, contact_forces);
+    SumAllContactForces(set_666_666.contacts, contact_forces);
+}
+
+template <class Tcont>
+void _PooledReportAllContactsSMC(ChContactPool<Tcont>& pool, ChContactContainer::ReportContactCallback* mcallback) {
+    for (auto contact : pool) {
+        bool proceed = mcallback->OnReportContact(
+            contact->GetContactP1(), contact->GetContactP2(), contact->GetContactPlane(), contact->GetContactDistance(),
+            contact->GetEffectiveCurvatureRadius(), contact->GetContactForce(), VNULL, contact->GetObjA(),
+            contact->GetObjB());
+        if (!proceed)
+            break;
+    }
+}
+
+void ChContactContainerPooledSMC::ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) {
+    _PooledReportAllContactsSMC(set_3_3.contacts, callback.get());
+    _PooledReportAllContactsSMC(set_6_3.contacts, callback.get());
+    _PooledReportAllContactsSMC(set_6_6.contacts, callback.get());
+    _PooledReportAllContactsSMC(set_333_3.contacts, callback.get());
+    _PooledReportAllContactsSMC(set_333_6.contacts, callback.get());
+    _PooledReportAllContactsSMC(set_333_333.contacts, callback.get());
+    _PooledReportAllContactsSMC(set_666_3.contacts, callback.get());
+    _PooledReportAllContactsSMC(set_666_6.contacts, callback.get());
+    _PooledReportAllContactsSMC(set_666_333.contacts, callback.get());
+    _PooledReportAllContactsSMC(set_666_666.contacts, callback.get());
+}
+
+// STATE INTERFACE
+
+void ChContactContainerPooledSMC::IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) {
+    // Forces on objects with a single set of variables, in parallel over the objects
+    // (each segment of entries writes to the entries of R of a different set of variables)
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+    int nsegments = (int)force_segments.size() - 1;
+#pragma omp parallel for schedule(dynamic, 16) num_threads(nthreads)
+    for (int is = 0; is < nsegments; is++) {
+        for (size_t i = force_segments[is]; i < force_segments[is + 1]; i++) {
+            const auto& entry = force_entries[i];
+            if (entry.obj->IsContactActive())
+                entry.obj->ContactForceLoadResidual_F(entry.force * c, entry.point, R);
+        }
+    }
+
+    // Forces on objects with multiple sets of variables (possibly shared with other objects)
+    for (const auto& entry : force_entries_serial) {
+        if (entry.obj->IsContactActive())
+            entry.obj->ContactForceLoadResidual_F(entry.force * c, entry.point, R);
+    }
+}
+
+template <class Tcont>
+void _PooledKRMmatricesLoadSMC(ChContactPool<Tcont>& pool, double Kfactor, double Rfactor, int nthreads) {
+    int ncontacts = (int)pool.size();
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int i = 0; i < ncontacts; i++) {
+        pool[i].ContKRMmatricesLoad(Kfactor, Rfactor);
+    }
+}
+
+void ChContactContainerPooledSMC::KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {
+    int nthreads = GetSystem()->GetNumThreadsChrono();
+    _PooledKRMmatricesLoadSMC(set_3_3.contacts, Kfactor, Rfactor, nthreads);
+    _PooledKRMmatricesLoadSMC(set_6_3.contacts, Kfactor, Rfactor, nthreads);
+    _PooledKRMmatricesLoadSMC(set_6_6.contacts, Kfactor, Rfactor, nthreads);
+    _PooledKRMmatricesLoadSMC(set_333_3.contacts, Kfactor, Rfactor, nthreads);
+    _PooledKRMmatricesLoadSMC(set_333_6.contacts, Kfactor, Rfactor, nthreads);
+    _PooledKRMmatricesLoadSMC(set_333_333.contacts, Kfactor, Rfactor, nthreads);
+    _PooledKRMmatricesLoadSMC(set_666_3.contacts, Kfactor, Rfactor, nthreads);
+    _PooledKRMmatricesLoadSMC(set_666_6.contacts, Kfactor, Rfactor, nthreads);
+    _PooledKRMmatricesLoadSMC(set_666_333.contacts, Kfactor, Rfactor, nthreads);
+    _PooledKRMmatricesLoadSMC(set_666_666.contacts, Kfactor, Rfactor, nthreads);
+}
+
+template <class Tcont>
+void _PooledInjectKRMmatricesSMC(ChContactPool<Tcont>& pool, ChSystemDescriptor& mdescriptor) {
+    for (auto contact : pool) {
+        contact->ContInjectKRMmatrices(mdescriptor);
+    }
+}
+
+void ChContactContainerPooledSMC::InjectKRMmatrices(ChSystemDescriptor& mdescriptor) {
+    _PooledInjectKRMmatricesSMC(set_3_3.contacts, mdescriptor);
+    _PooledInjectKRMmatricesSMC(set_6_3.contacts, mdescriptor);
+    _PooledInjectKRMmatricesSMC(set_6_6.contacts, mdescriptor);
+    _PooledInjectKRMmatricesSMC(set_333_3.contacts, mdescriptor);
+    _PooledInjectKRMmatricesSMC(set_333_6.contacts, mdescriptor);
+    _PooledInjectKRMmatricesSMC(set_333_333.contacts, mdescriptor);
+    _PooledInjectKRMmatricesSMC(set_666_3.contacts, mdescriptor);
+    _PooledInjectKRMmatricesSMC(set_666_6.contacts, mdescriptor);
+    _PooledInjectKRMmatricesSMC(set_666_333.contacts, mdescriptor);
+    _PooledInjectKRMmatricesSMC(set_666_666.contacts, mdescriptor);
+}
+
+void ChContactContainerPooledSMC::ArchiveOUT(ChArchiveOut& marchive) {
+    // version number
+    marchive.VersionWrite<ChContactContainerPooledSMC>();
+    // serialize parent class
+    ChContactContainerSMC::ArchiveOUT(marchive);
+    // NO SERIALIZATION of contact pools because assume they are volatile and generated when needed
+}
+
+void ChContactContainerPooledSMC::ArchiveIN(ChArchiveIn& marchive) {
+    // version number
+    /*int version =*/marchive.VersionRead<ChContactContainerPooledSMC>();
+    // deserialize parent class
+    ChContactContainerSMC::ArchiveIN(marchive);
+    RemoveAllContacts();
+    // NO SERIALIZATION of contact pools because assume they are volatile and generated when needed
+}
+
+}  // end namespace chrono
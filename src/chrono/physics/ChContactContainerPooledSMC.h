@@ -0,0 +1,126 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONTACTCONTAINER_POOLED_SMC_H
+#define CH_CONTACTCONTAINER_POOLED_SMC_H
+
+#include <vector>
+
+#include "chrono/physics/ChContactContainerSMC.h"
+#include "chrono/physics/ChContactPool.h"
+
+namespace chrono {
+
+/// Class representing a container of many smooth (penalty) contacts, using pooled storage and parallel evaluation.
+/// This is a drop-in replacement for ChContactContainerSMC (it can be set with ChSystemSMC::SetContactContainer).
+/// <pre>
+/// - contacts of each type are stored in a ChContactPool, together with a flat array of their composite materials;
+/// - contact forces (and Jacobians, if stiff contact is enabled) are not calculated while contacts are added, but
+///   all at once in EndAddContact, in parallel over the contacts;
+/// - contact forces are loaded in the residual with a segmented reduction: the forces acting on each object are
+///   sorted by the object variables and each segment is processed by a single thread, so that no synchronization is
+///   needed; forces acting on objects with several variables (e.g. mesh faces) are loaded serially.
+/// </pre>
+/// The number of threads is that of the containing system (see ChSystem::SetNumThreads). A custom contact force
+/// algorithm (see ChSystemSMC::SetContactForceAlgorithm) must support concurrent calls.
+class ChApi ChContactContainerPooledSMC : public ChContactContainerSMC {
+  public:
+    ChContactContainerPooledSMC();
+    ChContactContainerPooledSMC(const ChContactContainerPooledSMC& other);
+    virtual ~ChContactContainerPooledSMC();
+
+    /// "Virtual" copy constructor (covariant return type).
+    virtual ChContactContainerPooledSMC* Clone() const override { return new ChContactContainerPooledSMC(*this); }
+
+    /// Report the number of added contacts.
+    virtual int GetNcontacts() const override;
+
+    /// Remove all contained contact data and release the pooled storage.
+    virtual void RemoveAllContacts() override;
+
+    /// The collision system will call BeginAddContact() before adding all contacts.
+    /// This implementation rewinds all contact pools, so that the contact objects from the previous step are recycled.
+    virtual void BeginAddContact() override;
+
+    /// The collision system will call EndAddContact() after adding all contacts.
+    /// This implementation evaluates the forces of all added contacts, in parallel, and sorts them by object.
+    virtual void EndAddContact() override;
+
+    /// Scan all the contacts and for each contact executes the OnReportContact() function of the provided callback
+    /// object.
+    virtual void ReportAllContacts(std::shared_ptr<ReportContactCallback> callback) override;
+
+    /// Compute contact forces on all contactable objects in this container.
+    /// This function caches contact forces in a map.
+    virtual void ComputeContactForces() override;
+
+    // STATE FUNCTIONS
+
+    virtual void IntLoadResidual_F(const unsigned int off, ChVectorDynamic<>& R, const double c) override;
+    virtual void KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) override;
+    virtual void InjectKRMmatrices(ChSystemDescriptor& mdescriptor) override;
+
+    // SERIALIZATION
+
+    /// Method to allow serialization of transient data to archives.
+    virtual void ArchiveOUT(ChArchiveOut& marchive) override;
+
+    /// Method to allow de-serialization of transient data from archives.
+    virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  protected:
+    virtual void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeSMC& cmat) override;
+
+    /// Contacts of a given type, with their composite materials.
+    template <class Tcont>
+    struct ContactSet {
+        ChContactPool<Tcont> contacts;
+        std::vector<ChMaterialCompositeSMC> materials;
+    };
+
+    /// Contact force acting on one object, for loading in the residual.
+    struct ForceEntry {
+        ChVariables* key;  ///< variables of the object (null for objects with multiple variables)
+        ChContactable* obj;
+        ChVector<> force;  ///< force applied to the object (expressed in global frame)
+        ChVector<> point;  ///< application point (expressed in global frame)
+    };
+
+    ContactSet<ChContactSMC_3_3> set_3_3;
+    ContactSet<ChContactSMC_6_3> set_6_3;
+    ContactSet<ChContactSMC_6_6> set_6_6;
+    ContactSet<ChContactSMC_333_3> set_333_3;
+    ContactSet<ChContactSMC_333_6> set_333_6;
+    ContactSet<ChContactSMC_333_333> set_333_333;
+    ContactSet<ChContactSMC_666_3> set_666_3;
+    ContactSet<ChContactSMC_666_6> set_666_6;
+    ContactSet<ChContactSMC_666_333> set_666_333;
+    ContactSet<ChContactSMC_666_666> set_666_666;
+
+    std::vector<ForceEntry> force_entries;         ///< contact forces on single-variable objects, sorted by key
+    std::vector<size_t> force_segments;            ///< start of each group of entries with the same key (plus end)
+    std::vector<ForceEntry> force_entries_serial;  ///< contact forces on multi-variable objects
+
+  private:
+    template <class Tcont>
+    void EvaluateContacts(ContactSet<Tcont>& set, int nthreads);
+    template <class Tcont>
+    void CollectForces(ContactSet<Tcont>& set);
+};
+
+CH_CLASS_VERSION(ChContactContainerPooledSMC, 0)
+
+}  // end namespace chrono
+
+#endif
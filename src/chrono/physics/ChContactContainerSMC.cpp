@@ -12,8 +12,13 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/physics/ChContactContainerSMC.h"
+#include "chrono/physics/ChParticleCloud.h"
 #include "chrono/physics/ChSystemSMC.h"
+#include "chrono/fea/ChContactSurfaceMesh.h"
+#include "chrono/fea/ChContactSurfaceNodeCloud.h"
 
 namespace chrono {
 
@@ -33,7 +38,8 @@ ChContactContainerSMC::ChContactContainerSMC()
       n_added_666_3(0),
       n_added_666_6(0),
       n_added_666_333(0),
-      n_added_666_666(0) {}
+      n_added_666_666(0),
+      history_generation(0) {}
 
 ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other) : ChContactContainer(other) {
     n_added_3_3 = 0;
@@ -46,6 +52,7 @@ ChContactContainerSMC::ChContactContainerSMC(const ChContactContainerSMC& other)
     n_added_666_6 = 0;
     n_added_666_333 = 0;
     n_added_666_666 = 0;
+    history_generation = 0;
 }
 
 ChContactContainerSMC::~ChContactContainerSMC() {
@@ -115,6 +122,8 @@ void ChContactContainerSMC::BeginAddContact() {
     lastcontact_666_666 = contactlist_666_666.begin();
     n_added_666_666 = 0;
 
+    BeginContactHistory();
+
     // lastcontact_roll = contactlist_roll.begin();
     // n_added_roll = 0;
 }
@@ -162,6 +171,8 @@ void ChContactContainerSMC::EndAddContact() {
         lastcontact_666_666 = contactlist_666_666.erase(lastcontact_666_666);
     }
 
+    EndContactHistory();
+
     // while (lastcontact_roll != contactlist_roll.end()) {
     //    delete (*lastcontact_roll);
     //    lastcontact_roll = contactlist_roll.erase(lastcontact_roll);
@@ -176,15 +187,16 @@ void _OptimalContactInsert(std::list<Tcont*>& contactlist,           // contact
                            Ta* objA,                                 // collidable object A
                            Tb* objB,                                 // collidable object B
                            const collision::ChCollisionInfo& cinfo,  // collision information
-                           const ChMaterialCompositeSMC& cmat        // composite material
+                           const ChMaterialCompositeSMC& cmat,       // composite material
+                           ChContactHistorySMC* history              // contact history (may be null)
 ) {
     if (lastcontact != contactlist.end()) {
         // reuse old contacts
-        (*lastcontact)->Reset(objA, objB, cinfo, cmat);
+        (*lastcontact)->Reset(objA, objB, cinfo, cmat, history);
         lastcontact++;
     } else {
         // add new contact
-        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat);
+        Tcont* mc = new Tcont(container, objA, objB, cinfo, cmat, history);
         contactlist.push_back(mc);
         lastcontact = contactlist.end();
     }
@@ -259,6 +271,8 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
     auto contactableA = cinfo.modelA->GetContactable();
     auto contactableB = cinfo.modelB->GetContactable();
 
+    ChContactHistorySMC* history = FindContactHistory(cinfo);
+
     // CREATE THE CONTACTS
     //
     // Switch among the various cases of contacts: i.e. between a 6-dof variable and another 6-dof variable,
@@ -276,22 +290,22 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 3_3
-                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_3_3, lastcontact_3_3, n_added_3_3, this, objA, objB, cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 3_6 -> 6_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objB, objA, swapped_cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 3_333 -> 333_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objB, objA, swapped_cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 3_666 -> 666_3
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objB, objA, swapped_cinfo, cmat, history);
             }
         } break;
 
@@ -300,21 +314,21 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 6_3
-                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_3, lastcontact_6_3, n_added_6_3, this, objA, objB, cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 6_6
-                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_6_6, lastcontact_6_6, n_added_6_6, this, objA, objB, cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 6_333 -> 333_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objB, objA, swapped_cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 6_666 -> 666_6
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objB, objA, swapped_cinfo, cmat, history);
             }
         } break;
 
@@ -323,20 +337,20 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 333_3
-                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_3, lastcontact_333_3, n_added_333_3, this, objA, objB, cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 333_6
-                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_6, lastcontact_333_6, n_added_333_6, this, objA, objB, cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 333_333
-                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_333_333, lastcontact_333_333, n_added_333_333, this, objA, objB, cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 333_666 -> 666_333
                 collision::ChCollisionInfo swapped_cinfo(cinfo, true);
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objB, objA, swapped_cinfo, cmat, history);
             }
         } break;
 
@@ -345,19 +359,19 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
             if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_3) {
                 auto objB = static_cast<ChContactable_1vars<3>*>(contactableB);
                 // 666_3
-                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_3, lastcontact_666_3, n_added_666_3, this, objA, objB, cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_6) {
                 auto objB = static_cast<ChContactable_1vars<6>*>(contactableB);
                 // 666_6
-                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_6, lastcontact_666_6, n_added_666_6, this, objA, objB, cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_333) {
                 auto objB = static_cast<ChContactable_3vars<3, 3, 3>*>(contactableB);
                 // 666_333
-                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_333, lastcontact_666_333, n_added_666_333, this, objA, objB, cinfo, cmat, history);
             } else if (contactableB->GetContactableType() == ChContactable::CONTACTABLE_666) {
                 auto objB = static_cast<ChContactable_3vars<6, 6, 6>*>(contactableB);
                 // 666_666
-                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB, cinfo, cmat);
+                _OptimalContactInsert(contactlist_666_666, lastcontact_666_666, n_added_666_666, this, objA, objB, cinfo, cmat, history);
             }
         } break;
 
@@ -368,6 +382,180 @@ void ChContactContainerSMC::InsertContact(const collision::ChCollisionInfo& cinf
     }  // switch(contactableA->GetContactableType())
 }
 
+// -----------------------------------------------------------------------------
+// Contact history
+//
+// Each history entry is keyed by the pair of collision shapes in contact and tagged with the index of the collision
+// detection pass in which it was last found. Looking up a contact is an O(1) hash map access; if several contacts are
+// found between the same two shapes in one pass, they are matched in order with successive entries for that pair.
+// Entries not found in the current pass belong to contacts that were broken and are discarded at the end of the pass.
+// Entries are stored in an unordered map, so pointers to them remain valid as new entries are inserted.
+// -----------------------------------------------------------------------------
+
+ChContactHistorySMC* ChContactContainerSMC::FindContactHistory(const collision::ChCollisionInfo& cinfo) {
+    auto sys = static_cast<ChSystemSMC*>(GetSystem());
+    if (!sys || sys->GetTangentialDisplacementModel() != ChSystemSMC::MultiStep)
+        return nullptr;
+
+    HistoryKey key;
+    key.a = ChContactHistorySMC::Key(cinfo.shapeA, cinfo.modelA);
+    key.b = ChContactHistorySMC::Key(cinfo.shapeB, cinfo.modelB);
+    if (std::less<const void*>()(key.b, key.a))
+        std::swap(key.a, key.b);
+
+    for (key.ordinal = 0;; key.ordinal++) {
+        auto& entry = contact_history[key];
+        if (entry.generation != history_generation) {
+            // Entry from the previous pass (persistent contact) or new entry (zero tangential displacement)
+            entry.generation = history_generation;
+            return &entry;
+        }
+    }
+}
+
+void ChContactContainerSMC::BeginContactHistory() {
+    // Generation 0 is reserved for newly created entries
+    if (++history_generation == 0)
+        ++history_generation;
+}
+
+void ChContactContainerSMC::EndContactHistory() {
+    for (auto it = contact_history.begin(); it != contact_history.end();) {
+        if (it->second.generation != history_generation)
+            it = contact_history.erase(it);
+        else
+            ++it;
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Checkpointing of the contact history.
+// In a checkpoint, the shape (or model) pointers of the history keys are replaced by their indices in a traversal of
+// the collision models of the system, in the order of the assembly lists, with the shapes of a model numbered after
+// the model itself. The tangential displacement is stored relative to the first side of the saved key; as the sides
+// of a key are ordered by address, they may have to be swapped (and the displacement reversed) on restore.
+// -----------------------------------------------------------------------------
+
+struct HistoryRecord {
+    uint64_t a;           // index of the first side
+    uint64_t b;           // index of the second side
+    int32_t ordinal;      // index of the contact between the same two sides
+    uint32_t generation;  // last collision detection pass in which the contact was found
+    double delta_t[3];    // accumulated tangential displacement
+};
+
+static void ListCollisionKeys(ChCollisionModel* model, std::vector<const void*>& keys) {
+    if (!model)
+        return;
+    keys.push_back(model);
+    for (const auto& shape : model->GetShapes())
+        keys.push_back(shape.get());
+}
+
+static void ListCollisionKeys(const ChAssembly& assembly, std::vector<const void*>& keys) {
+    for (const auto& body : assembly.Get_bodylist())
+        ListCollisionKeys(body->GetCollisionModel().get(), keys);
+
+    for (const auto& mesh : assembly.Get_meshlist()) {
+        for (unsigned int is = 0; is < mesh->GetNcontactSurfaces(); is++) {
+            auto surface = mesh->GetContactSurface(is);
+            if (auto surface_mesh = std::dynamic_pointer_cast<fea::ChContactSurfaceMesh>(surface)) {
+                for (const auto& face : surface_mesh->GetTriangleList())
+                    ListCollisionKeys(face->GetCollisionModel(), keys);
+                for (const auto& face : surface_mesh->GetTriangleListRot())
+                    ListCollisionKeys(face->GetCollisionModel(), keys);
+            } else if (auto surface_nodes = std::dynamic_pointer_cast<fea::ChContactSurfaceNodeCloud>(surface)) {
+                for (const auto& node : surface_nodes->GetNodeList())
+                    ListCollisionKeys(node->GetCollisionModel(), keys);
+                for (const auto& node : surface_nodes->GetNodeListRot())
+                    ListCollisionKeys(node->GetCollisionModel(), keys);
+            }
+        }
+    }
+
+    for (const auto& item : assembly.Get_otherphysicslist()) {
+        if (auto cloud = std::dynamic_pointer_cast<ChParticleCloud>(item)) {
+            for (auto particle : cloud->GetParticles())
+                ListCollisionKeys(particle->collision_model, keys);
+        } else if (auto sub_assembly = std::dynamic_pointer_cast<ChAssembly>(item)) {
+            ListCollisionKeys(*sub_assembly, keys);
+        }
+    }
+}
+
+void ChContactContainerSMC::CheckpointOut(ChCheckpointOut& cp) {
+    std::unordered_map<const void*, uint64_t> index;
+    if (GetSystem()) {
+        std::vector<const void*> keys;
+        ListCollisionKeys(GetSystem()->GetAssembly(), keys);
+        for (size_t i = 0; i < keys.size(); i++)
+            index[keys[i]] = i;
+    }
+
+    std::vector<HistoryRecord> records;
+    records.reserve(contact_history.size());
+    for (const auto& entry : contact_history) {
+        auto ia = index.find(entry.first.a);
+        auto ib = index.find(entry.first.b);
+        if (ia == index.end() || ib == index.end())
+            continue;
+        HistoryRecord record;
+        record.a = ia->second;
+        record.b = ib->second;
+        record.ordinal = entry.first.ordinal;
+        record.generation = entry.second.generation;
+        record.delta_t[0] = entry.second.delta_t.x();
+        record.delta_t[1] = entry.second.delta_t.y();
+        record.delta_t[2] = entry.second.delta_t.z();
+        records.push_back(record);
+    }
+
+    // Sort the records, so that the checkpoint does not depend on the order of the hash map
+    std::sort(records.begin(), records.end(), [](const HistoryRecord& r1, const HistoryRecord& r2) {
+        if (r1.a != r2.a)
+            return r1.a < r2.a;
+        if (r1.b != r2.b)
+            return r1.b < r2.b;
+        return r1.ordinal < r2.ordinal;
+    });
+
+    cp.Write(history_generation);
+    cp.WriteArray(records);
+}
+
+void ChContactContainerSMC::CheckpointIn(ChCheckpointIn& cp) {
+    unsigned int generation;
+    std::vector<HistoryRecord> records;
+    cp.Read(generation);
+    cp.ReadArray(records);
+
+    std::vector<const void*> keys;
+    if (GetSystem())
+        ListCollisionKeys(GetSystem()->GetAssembly(), keys);
+
+    // Current contacts refer to the history entries
+    RemoveAllContacts();
+    contact_history.clear();
+
+    for (const auto& record : records) {
+        if (record.a >= keys.size() || record.b >= keys.size())
+            throw ChException("Checkpoint data inconsistent with the system (contact history)");
+        HistoryKey key;
+        key.a = keys[record.a];
+        key.b = keys[record.b];
+        key.ordinal = record.ordinal;
+        ChContactHistorySMC history;
+        history.delta_t = ChVector<>(record.delta_t[0], record.delta_t[1], record.delta_t[2]);
+        history.generation = record.generation;
+        if (std::less<const void*>()(key.b, key.a)) {
+            std::swap(key.a, key.b);
+            history.delta_t = -history.delta_t;
+        }
+        contact_history[key] = history;
+    }
+    history_generation = generation;
+}
+
 void ChContactContainerSMC::ComputeContactForces() {
     contact_forces.clear();
     SumAllContactForces(contactlist_3_3, contact_forces);
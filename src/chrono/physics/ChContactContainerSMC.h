@@ -18,6 +18,7 @@
 #include <algorithm>
 #include <cmath>
 #include <list>
+#include <unordered_map>
 
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/physics/ChContactSMC.h"
@@ -76,6 +77,28 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     std::unordered_map<ChContactable*, ForceTorque> contact_forces;
 
+    /// Key of a contact history entry: the two collision shapes (in increasing address order) and the index of the
+    /// contact among those found between the same two shapes in one collision detection pass.
+    struct HistoryKey {
+        const void* a;
+        const void* b;
+        int ordinal;
+        bool operator==(const HistoryKey& other) const {
+            return a == other.a && b == other.b && ordinal == other.ordinal;
+        }
+    };
+    struct HistoryKeyHash {
+        size_t operator()(const HistoryKey& key) const {
+            size_t h = std::hash<const void*>()(key.a);
+            h ^= std::hash<const void*>()(key.b) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            h ^= std::hash<int>()(key.ordinal) + 0x9e3779b9 + (h << 6) + (h >> 2);
+            return h;
+        }
+    };
+
+    std::unordered_map<HistoryKey, ChContactHistorySMC, HistoryKeyHash> contact_history;
+    unsigned int history_generation;
+
   public:
     ChContactContainerSMC();
     ChContactContainerSMC(const ChContactContainerSMC& other);
@@ -93,6 +116,13 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
+    /// Return the number of contact history entries (i.e., persistent contacts tracked across steps).
+    /// Contact history is only maintained with the MultiStep tangential displacement model.
+    size_t GetNumContactHistories() const { return contact_history.size(); }
+
+    /// Discard the contact history, so that all contacts are considered new at the next collision detection.
+    void ClearContactHistory() { contact_history.clear(); }
+
     /// The collision system will call BeginAddContact() before adding all contacts (for example with AddContact() or
     /// similar). Instead of simply deleting all list of the previous contacts, this optimized implementation rewinds
     /// the link iterator to begin and tries to reuse previous contact objects until possible, to avoid too much
@@ -143,6 +173,19 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
 
     virtual void ConstraintsFbLoadForces(double factor) override;
 
+    // CHECKPOINTING
+
+    /// Write the contact history to a binary checkpoint.
+    /// History entries are saved with the indices of their collision shapes (or models) in the system, so that they
+    /// can be restored into another instance of the same model. Only collision models of bodies, FEA contact surfaces,
+    /// and particle clouds (also in nested assemblies) are indexed; contacts involving other collision models are
+    /// considered new after a restore.
+    virtual void CheckpointOut(ChCheckpointOut& cp) override;
+
+    /// Read the contact history from a binary checkpoint.
+    /// All current contacts are removed (they are regenerated at the next step).
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     // SERIALIZATION
 
     /// Method to allow serialization of transient data to archives.
@@ -151,8 +194,18 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     /// Method to allow de-serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
 
-  private:
-    void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeSMC& cmat);
+  protected:
+    virtual void InsertContact(const collision::ChCollisionInfo& cinfo, const ChMaterialCompositeSMC& cmat);
+
+    /// Return the contact history entry for the specified contact (creating a new one if the two shapes were not in
+    /// contact at the previous collision detection pass), or null if contact history is not used.
+    ChContactHistorySMC* FindContactHistory(const collision::ChCollisionInfo& cinfo);
+
+    /// Start a new collision detection pass for the contact history.
+    void BeginContactHistory();
+
+    /// Discard the contact history entries of the contacts not found in the current collision detection pass.
+    void EndContactHistory();
 };
 
 CH_CLASS_VERSION(ChContactContainerSMC, 0)
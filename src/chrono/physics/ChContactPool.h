@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CH_CONTACT_POOL_H
+#define CH_CONTACT_POOL_H
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+namespace chrono {
+
+/// Pooled storage for contacts of a given type.
+/// Contact objects are default-constructed in contiguous chunks and are never moved or released until the pool is
+/// cleared, so that their addresses (and the addresses of the constraints they contain, as referenced by the system
+/// descriptor) remain valid. At each step, the pool is rewound and the already constructed contacts are recycled
+/// in order, without any heap allocation once the pool has grown to the number of contacts in the simulation.
+template <class Tcont>
+class ChContactPool {
+  public:
+    /// Forward iterator over the contacts currently in use. Dereferences to a pointer to the contact.
+    class iterator {
+      public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef Tcont* value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef Tcont** pointer;
+        typedef Tcont* reference;
+
+        iterator(ChContactPool* pool, size_t index) : m_pool(pool), m_index(index) {}
+        Tcont* operator*() const { return &(*m_pool)[m_index]; }
+        iterator& operator++() {
+            ++m_index;
+            return *this;
+        }
+        bool operator==(const iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const iterator& other) const { return m_index != other.m_index; }
+
+      private:
+        ChContactPool* m_pool;
+        size_t m_index;
+    };
+
+    ChContactPool() : m_size(0) {}
+
+    /// Return the number of contacts currently in use.
+    size_t size() const { return m_size; }
+
+    /// Return the number of contacts that can be stored without allocating a new chunk.
+    size_t capacity() const { return m_chunks.size() * CHUNK_SIZE; }
+
+    /// Access the i-th contact in use.
+    Tcont& operator[](size_t i) { return m_chunks[i >> CHUNK_BITS][i & (CHUNK_SIZE - 1)]; }
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, m_size); }
+
+    /// Return the next available contact, allocating a new chunk if necessary.
+    /// The returned contact is either default-constructed or a recycled one; the caller must reset it.
+    Tcont* Acquire() {
+        if (m_size == capacity())
+            m_chunks.emplace_back(new Tcont[CHUNK_SIZE]);
+        return &(*this)[m_size++];
+    }
+
+    /// Mark all contacts as unused, keeping the allocated storage for reuse.
+    void Rewind() { m_size = 0; }
+
+    /// Release all allocated storage.
+    void Clear() {
+        m_chunks.clear();
+        m_size = 0;
+    }
+
+  private:
+    static const size_t CHUNK_BITS = 8;
+    static const size_t CHUNK_SIZE = size_t(1) << CHUNK_BITS;
+
+    std::vector<std::unique_ptr<Tcont[]>> m_chunks;  ///< contiguous chunks of contact objects
+    size_t m_size;                                   ///< number of contacts in use
+};
+
+}  // end namespace chrono
+
+#endif
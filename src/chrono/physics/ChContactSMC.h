@@ -21,6 +21,7 @@
 
 #include <cmath>
 #include <algorithm>
+#include <functional>
 #include <limits>
 
 #include "chrono/collision/ChCollisionModel.h"
@@ -55,6 +56,42 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
         double mass1,                       ///< mass of obj1
         double mass2                        ///< mass of obj2
         ) const override {
+        return Calculate(sys, normal_dir, p1, p2, vel1, vel2, mat, delta, eff_radius, mass1, mass2, nullptr);
+    }
+
+    /// Default SMC force calculation algorithm, with contact history.
+    /// With the MultiStep tangential displacement model, the elastic tangential force is calculated from the
+    /// tangential displacement accumulated since contact initiation (limited by the Coulomb law).
+    virtual ChVector<> CalculateForceWithHistory(
+        const ChSystemSMC& sys,             ///< containing system
+        const ChVector<>& normal_dir,       ///< normal contact direction (expressed in global frame)
+        const ChVector<>& p1,               ///< most penetrated point on obj1 (expressed in global frame)
+        const ChVector<>& p2,               ///< most penetrated point on obj2 (expressed in global frame)
+        const ChVector<>& vel1,             ///< velocity of contact point on obj1 (expressed in global frame)
+        const ChVector<>& vel2,             ///< velocity of contact point on obj2 (expressed in global frame)
+        const ChMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        double delta,                       ///< overlap in normal direction
+        double eff_radius,                  ///< effective radius of curvature at contact
+        double mass1,                       ///< mass of obj1
+        double mass2,                       ///< mass of obj2
+        ChVector<>& delta_t                 ///< [in/out] accumulated tangential displacement
+        ) const override {
+        return Calculate(sys, normal_dir, p1, p2, vel1, vel2, mat, delta, eff_radius, mass1, mass2, &delta_t);
+    }
+
+  private:
+    ChVector<> Calculate(const ChSystemSMC& sys,
+                         const ChVector<>& normal_dir,
+                         const ChVector<>& p1,
+                         const ChVector<>& p2,
+                         const ChVector<>& vel1,
+                         const ChVector<>& vel2,
+                         const ChMaterialCompositeSMC& mat,
+                         double delta,
+                         double eff_radius,
+                         double mass1,
+                         double mass2,
+                         ChVector<>* delta_t) const {
         // Set contact force to zero if no penetration.
         if (delta <= 0) {
             return ChVector<>(0, 0, 0);
@@ -172,15 +209,54 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
                 }
         }
 
+        // With contact history, the elastic tangential force is proportional to the accumulated tangential
+        // displacement. If the tangential force exceeds the Coulomb limit, the contact slides and the stored
+        // displacement is reduced so that the elastic force is consistent with the sliding force.
+        if (delta_t && tdispl_model == ChSystemSMC::MultiStep) {
+            double forceN = kn * delta - gn * relvel_n_mag;
+            ChVector<> forceT_damp = -gt * relvel_t;
+            ChVector<> forceT = forceT_damp - kt * (*delta_t);
+
+            // If the resulting normal contact force is negative, the two shapes are moving
+            // away from each other so fast that no contact force is generated.
+            if (forceN < 0) {
+                forceN = 0;
+                forceT = VNULL;
+            }
+
+            // Include adhesion force
+            switch (adhesion_model) {
+                case ChSystemSMC::AdhesionForceModel::Perko:
+                    // Currently not implemented.  Fall through to Constant.
+                case ChSystemSMC::AdhesionForceModel::Constant:
+                    forceN -= mat.adhesion_eff;
+                    break;
+                case ChSystemSMC::AdhesionForceModel::DMT:
+                    forceN -= mat.adhesionMultDMT_eff * sqrt(eff_radius);
+                    break;
+            }
+
+            // Coulomb law
+            double forceT_mag = forceT.Length();
+            double forceT_max = mat.mu_eff * std::abs(forceN);
+            if (forceT_mag > forceT_max) {
+                forceT *= forceT_max / forceT_mag;
+                if (kt > 0)
+                    *delta_t = (forceT_damp - forceT) / kt;
+            }
+
+            return forceN * normal_dir + forceT;
+        }
+
         // Tangential displacement (magnitude)
-        double delta_t = 0;
+        double delta_t_mag = 0;
         switch (tdispl_model) {
             case ChSystemSMC::OneStep:
-                delta_t = relvel_t_mag * dT;
+                delta_t_mag = relvel_t_mag * dT;
                 break;
             case ChSystemSMC::MultiStep:
-                //// TODO: implement proper MultiStep mode
-                delta_t = relvel_t_mag * dT;
+                // Without contact history, fall back to OneStep
+                delta_t_mag = relvel_t_mag * dT;
                 break;
             default:
                 break;
@@ -188,7 +264,7 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
 
         // Calculate the magnitudes of the normal and tangential contact forces
         double forceN = kn * delta - gn * relvel_n_mag;
-        double forceT = kt * delta_t + gt * relvel_t_mag;
+        double forceT = kt * delta_t_mag + gt * relvel_t_mag;
 
         // If the resulting normal contact force is negative, the two shapes are moving
         // away from each other so fast that no contact force is generated.
@@ -221,6 +297,21 @@ class ChDefaultContactForceSMC : public ChSystemSMC::ChContactForceSMC {
     }
 };
 
+/// Contact history data for smooth contacts (used with the MultiStep tangential displacement model).
+/// A history entry is associated with a pair of collision shapes (see ChContactContainerSMC) and persists as long as
+/// the two shapes remain in contact.
+struct ChContactHistorySMC {
+    ChContactHistorySMC() : generation(0) {}
+
+    /// Return the key identifying one side of a contact: the collision shape, if available, or else the model.
+    static const void* Key(const collision::ChCollisionShape* shape, const collision::ChCollisionModel* model) {
+        return shape ? static_cast<const void*>(shape) : static_cast<const void*>(model);
+    }
+
+    ChVector<> delta_t;       ///< accumulated tangential displacement (expressed in global frame)
+    unsigned int generation;  ///< last collision detection pass in which the contact was found
+};
+
 /// Class for smooth (penalty-based) contact between two generic contactable objects.
 /// Ta and Tb are of ChContactable sub classes.
 template <class Ta, class Tb>
@@ -239,17 +330,22 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     ChVector<> m_force;        ///< contact force on objB
     ChContactJacobian* m_Jac;  ///< contact Jacobian data
 
+    ChContactHistorySMC* m_history;  ///< contact history (MultiStep tangential displacement model only)
+    double m_history_sign;           ///< +1 if objB is the second side of the history entry, -1 otherwise
+    ChVector<> m_delta_t0;           ///< tangential displacement of objB relative to objA at the previous step
+
   public:
-    ChContactSMC() : m_Jac(NULL) {}
+    ChContactSMC() : m_Jac(NULL), m_history(NULL), m_history_sign(1) {}
 
     ChContactSMC(ChContactContainer* mcontainer,           ///< contact container
                  Ta* mobjA,                                ///< collidable object A
                  Tb* mobjB,                                ///< collidable object B
                  const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
-                 const ChMaterialCompositeSMC& mat         ///< composite material
+                 const ChMaterialCompositeSMC& mat,        ///< composite material
+                 ChContactHistorySMC* history = NULL       ///< contact history (if any)
                  )
-        : ChContactTuple<Ta, Tb>(mcontainer, mobjA, mobjB, cinfo), m_Jac(NULL) {
-        Reset(mobjA, mobjB, cinfo, mat);
+        : ChContactTuple<Ta, Tb>(mcontainer, mobjA, mobjB, cinfo), m_Jac(NULL), m_history(NULL), m_history_sign(1) {
+        Reset(mobjA, mobjB, cinfo, mat, history);
     }
 
     ~ChContactSMC() { delete m_Jac; }
@@ -272,21 +368,41 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
     void Reset(Ta* mobjA,                                ///< collidable object A
                Tb* mobjB,                                ///< collidable object B
                const collision::ChCollisionInfo& cinfo,  ///< data for the collision pair
-               const ChMaterialCompositeSMC& mat         ///< composite material
+               const ChMaterialCompositeSMC& mat,        ///< composite material
+               ChContactHistorySMC* history = NULL       ///< contact history (if any)
     ) {
         // Reset geometric information
         this->Reset_cinfo(mobjA, mobjB, cinfo);
+        SetHistory(history, cinfo);
 
         // Note: cinfo.distance is the same as this->norm_dist.
         assert(cinfo.distance < 0);
 
+        Evaluate(mat);
+    }
+
+    /// Calculate the contact force and, if stiff contact is enabled, the Jacobians of the generalized contact forces.
+    /// This function uses the current contact geometry (as set by Reset) and only modifies data owned by this
+    /// contact, so that different contacts can be evaluated concurrently.
+    void Evaluate(const ChMaterialCompositeSMC& mat) {
+        ChVector<> vel1 = this->objA->GetContactPointSpeed(this->p1);
+        ChVector<> vel2 = this->objB->GetContactPointSpeed(this->p2);
+
         // Calculate contact force.
-        m_force = CalculateForce(-this->norm_dist,                            // overlap (here, always positive)
-                                 this->normal,                                // normal contact direction
-                                 this->objA->GetContactPointSpeed(this->p1),  // velocity of contact point on objA
-                                 this->objB->GetContactPointSpeed(this->p2),  // velocity of contact point on objB
-                                 mat                                          // composite material for contact pair
-        );
+        if (m_history) {
+            // Update the tangential displacement accumulated since contact initiation
+            m_delta_t0 = m_history_sign * m_history->delta_t;
+            ChVector<> delta_t = AccumulateTangentialDisplacement(this->normal, vel1, vel2);
+            m_force = CalculateForce(-this->norm_dist, this->normal, vel1, vel2, mat, &delta_t);
+            m_history->delta_t = m_history_sign * delta_t;
+        } else {
+            m_force = CalculateForce(-this->norm_dist,  // overlap (here, always positive)
+                                     this->normal,      // normal contact direction
+                                     vel1,              // velocity of contact point on objA
+                                     vel2,              // velocity of contact point on objB
+                                     mat                // composite material for contact pair
+            );
+        }
 
         // Set up and compute Jacobian matrices.
         if (static_cast<ChSystemSMC*>(this->container->GetSystem())->GetStiffContact()) {
@@ -301,7 +417,8 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         const ChVector<>& normal_dir,      ///< normal contact direction (expressed in global frame)
         const ChVector<>& vel1,            ///< velocity of contact point on objA (expressed in global frame)
         const ChVector<>& vel2,            ///< velocity of contact point on objB (expressed in global frame)
-        const ChMaterialCompositeSMC& mat  ///< composite material for contact pair
+        const ChMaterialCompositeSMC& mat,  ///< composite material for contact pair
+        ChVector<>* delta_t = NULL          ///< accumulated tangential displacement (if contact history is used)
     ) {
         // Set contact force to zero if no penetration.
         if (delta <= 0) {
@@ -310,6 +427,11 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
 
         // Use current SMC algorithm to calculate the force
         ChSystemSMC* sys = static_cast<ChSystemSMC*>(this->container->GetSystem());
+        if (delta_t) {
+            return sys->GetContactForceAlgorithm().CalculateForceWithHistory(
+                *sys, normal_dir, this->p1, this->p2, vel1, vel2, mat, delta, this->eff_radius,
+                this->objA->GetContactableMass(), this->objB->GetContactableMass(), *delta_t);
+        }
         return sys->GetContactForceAlgorithm().CalculateForce(*sys,                                        //
                                                               normal_dir, this->p1, this->p2, vel1, vel2,  //
                                                               mat,                                         //
@@ -482,6 +604,30 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         */
     }
 
+    /// Associate this contact with the specified contact history entry (or none, if null).
+    void SetHistory(ChContactHistorySMC* history, const collision::ChCollisionInfo& cinfo) {
+        m_history = history;
+        if (history) {
+            const void* keyA = ChContactHistorySMC::Key(cinfo.shapeA, cinfo.modelA);
+            const void* keyB = ChContactHistorySMC::Key(cinfo.shapeB, cinfo.modelB);
+            m_history_sign = std::less<const void*>()(keyA, keyB) ? 1 : -1;
+        }
+    }
+
+    /// Return the tangential displacement of objB relative to objA, accumulated since contact initiation, for the
+    /// given contact normal and contact point velocities.
+    ChVector<> AccumulateTangentialDisplacement(const ChVector<>& normal_dir,
+                                                const ChVector<>& vel1,
+                                                const ChVector<>& vel2) const {
+        double dT = this->container->GetSystem()->GetStep();
+        ChVector<> relvel = vel2 - vel1;
+        ChVector<> relvel_t = relvel - relvel.Dot(normal_dir) * normal_dir;
+
+        // Increment the displacement and project it onto the current contact plane
+        ChVector<> delta_t = m_delta_t0 + relvel_t * dT;
+        return delta_t - delta_t.Dot(normal_dir) * normal_dir;
+    }
+
     /// Compute all forces in a contiguous array.
     /// Used in finite-difference Jacobian approximation.
     void CalculateQ(const ChState& stateA_x,            ///< state positions for objA
@@ -524,7 +670,14 @@ class ChContactSMC : public ChContactTuple<Ta, Tb> {
         ChVector<> vel2 = this->objB->GetContactPointSpeed(p2_loc, stateB_x, stateB_w);
 
         // Compute the contact force.
-        ChVector<> force = CalculateForce(delta, normal_dir, vel1, vel2, mat);
+        // With contact history, the tangential displacement is accumulated from the one at the previous step.
+        ChVector<> force;
+        if (m_history) {
+            ChVector<> delta_t = AccumulateTangentialDisplacement(normal_dir, vel1, vel2);
+            force = CalculateForce(delta, normal_dir, vel1, vel2, mat, &delta_t);
+        } else {
+            force = CalculateForce(delta, normal_dir, vel1, vel2, mat);
+        }
 
         // Compute and load the generalized contact forces.
         this->objA->ContactForceLoadQ(-force, p1_abs, stateA_x, Q, 0);
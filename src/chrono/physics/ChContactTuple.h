@@ -95,6 +95,9 @@ class ChContactTuple {
         contact_plane.Set_A_axis(Vx, Vy, Vz);
     }
 
+    /// Set the associated contact container (used when recycling default-constructed contacts).
+    void SetContactContainer(ChContactContainer* mcontainer) { container = mcontainer; }
+
     /// Get the colliding object A, with point P1
     Ta* GetObjA() { return this->objA; }
 
@@ -24,6 +24,7 @@ ChLinkBase::ChLinkBase(const ChLinkBase& other) : ChPhysicsItem(other) {
     disabled = other.disabled;
     valid = other.valid;
     broken = other.broken;
+    sleeping = other.sleeping;
 }
 
 void ChLinkBase::ArchiveOUT(ChArchiveOut& marchive) {
@@ -27,9 +27,10 @@ class ChApi ChLinkBase : public ChPhysicsItem {
     bool disabled;  ///< all constraints of link disabled because of user needs
     bool valid;     ///< link data is valid
     bool broken;    ///< link is broken because of excessive pulling/pushing.
+    bool sleeping;  ///< link only connects sleeping (or fixed) bodies
 
   public:
-    ChLinkBase() : disabled(false), valid(true), broken(false) {}
+    ChLinkBase() : disabled(false), valid(true), broken(false), sleeping(false) {}
     ChLinkBase(const ChLinkBase& other);
     virtual ~ChLinkBase() {}
 
@@ -49,10 +50,15 @@ class ChApi ChLinkBase : public ChPhysicsItem {
     /// Set the 'broken' status vof this link.
     virtual void SetBroken(bool mon) { broken = mon; }
 
+    /// Tells if the link is sleeping, i.e. it only connects bodies in a sleeping island.
+    bool IsSleeping() const { return sleeping; }
+    /// Set the 'sleeping' status of this link (internal use only: managed by the system when sleeping is enabled).
+    void SetSleeping(bool mon) { sleeping = mon; }
+
     /// Return true if the link is currently active and thereofre included into the system solver.
     /// This method cumulates the effect of various flags (so a link may be inactive either because disabled, or broken,
-    /// or not valid)
-    virtual bool IsActive() const override { return (valid && !disabled && !broken); }
+    /// or not valid, or sleeping)
+    virtual bool IsActive() const override { return (valid && !disabled && !broken && !sleeping); }
 
     /// Get the number of scalar variables affected by constraints in this link
     virtual int GetNumCoords() = 0;
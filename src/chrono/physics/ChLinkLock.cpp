@@ -1922,6 +1922,14 @@ class my_enum_mappers_types : public ChLinkLock {
     CH_ENUM_MAPPER_END(LinkType);
 };
 
+void ChLinkLock::CheckpointOut(ChCheckpointOut& cp) {
+    mask.CheckpointOut(cp);
+}
+
+void ChLinkLock::CheckpointIn(ChCheckpointIn& cp) {
+    mask.CheckpointIn(cp);
+}
+
 void ChLinkLock::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChLinkLock>();
@@ -159,6 +159,12 @@ class ChApi ChLinkLock : public ChLinkMarkers {
     /// </pre>
     virtual void Update(double mytime, bool update_assets = true) override;
 
+    /// Write the constraint jacobians (as last loaded for the solver) to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) override;
+
+    /// Read the constraint jacobians from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
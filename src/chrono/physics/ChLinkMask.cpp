@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include "chrono/core/ChException.h"
 #include "chrono/physics/ChLinkMask.h"
 
 namespace chrono {
@@ -192,6 +193,25 @@ int ChLinkMask::SetAllBroken(bool mdis) {
     return cnt;
 }
 
+void ChLinkMask::CheckpointOut(ChCheckpointOut& cp) const {
+    cp.Write(nconstr);
+    for (auto constr : constraints) {
+        cp.Write(constr->Get_Cq_a().data(), 6 * sizeof(double));
+        cp.Write(constr->Get_Cq_b().data(), 6 * sizeof(double));
+    }
+}
+
+void ChLinkMask::CheckpointIn(ChCheckpointIn& cp) {
+    int num_constr;
+    cp.Read(num_constr);
+    if (num_constr != nconstr)
+        throw ChException("Checkpoint data inconsistent with the system (number of link constraints)");
+    for (auto constr : constraints) {
+        cp.Read(constr->Get_Cq_a().data(), 6 * sizeof(double));
+        cp.Read(constr->Get_Cq_b().data(), 6 * sizeof(double));
+    }
+}
+
 void ChLinkMask::ArchiveOUT(ChArchiveOut& marchive) {
     //// TODO
 }
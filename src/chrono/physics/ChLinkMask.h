@@ -19,6 +19,7 @@
 #include <vector>
 
 #include "chrono/core/ChMath.h"
+#include "chrono/serialization/ChCheckpoint.h"
 #include "chrono/solver/ChConstraintTwoBodies.h"
 
 namespace chrono {
@@ -94,6 +95,12 @@ class ChApi ChLinkMask {
     /// off (broken) at once, because marked as 'broken'. Return n.of changed.
     int SetAllBroken(bool mdis);
 
+    /// Write the jacobians of all constraints to a binary checkpoint.
+    void CheckpointOut(ChCheckpointOut& cp) const;
+
+    /// Read the jacobians of all constraints from a binary checkpoint.
+    void CheckpointIn(ChCheckpointIn& cp);
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive);
 
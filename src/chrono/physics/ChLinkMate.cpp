@@ -644,6 +644,14 @@ void ChLinkMateGeneric::ConstraintsFetch_react(double factor) {
     react_torque = this->P * gamma_m;
 }
 
+void ChLinkMateGeneric::CheckpointOut(ChCheckpointOut& cp) {
+    mask.CheckpointOut(cp);
+}
+
+void ChLinkMateGeneric::CheckpointIn(ChCheckpointIn& cp) {
+    mask.CheckpointIn(cp);
+}
+
 void ChLinkMateGeneric::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChLinkMateGeneric>();
@@ -211,6 +211,16 @@ class ChApi ChLinkMateGeneric : public ChLinkMate {
     /// The K matrices are load with scaling values Kfactor.
     virtual void KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) override;
 
+    //
+    // CHECKPOINTING
+    //
+
+    /// Write the constraint jacobians (as last loaded for the solver) to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) override;
+
+    /// Read the constraint jacobians from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     //
     // SERIALIZATION
     //
@@ -34,6 +34,16 @@ void ChLinkMotor::Update(double mytime, bool update_assets) {
     m_func->Update(mytime);
 }
 
+void ChLinkMotor::CheckpointOut(ChCheckpointOut& cp) {
+    ChLinkMateGeneric::CheckpointOut(cp);
+    m_func->CheckpointOut(cp);
+}
+
+void ChLinkMotor::CheckpointIn(ChCheckpointIn& cp) {
+    ChLinkMateGeneric::CheckpointIn(cp);
+    m_func->CheckpointIn(cp);
+}
+
 void ChLinkMotor::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChLinkMotor>();
@@ -50,6 +50,12 @@ class ChApi ChLinkMotor : public ChLinkMateGeneric {
     /// Update state of the LinkMotor.
     virtual void Update(double mytime, bool update_assets) override;
 
+    /// Write the constraint jacobians and the internal state of the actuation function to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) override;
+
+    /// Read the constraint jacobians and the internal state of the actuation function from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
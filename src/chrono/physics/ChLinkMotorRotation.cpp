@@ -104,6 +104,20 @@ void ChLinkMotorRotation::Update(double mytime, bool update_assets) {
     this->mrot_dtdt = aframe12.GetWacc_loc().z();
 }
 
+void ChLinkMotorRotation::CheckpointOut(ChCheckpointOut& cp) {
+    ChLinkMotor::CheckpointOut(cp);
+    cp.Write(mrot);
+    cp.Write(mrot_dt);
+    cp.Write(mrot_dtdt);
+}
+
+void ChLinkMotorRotation::CheckpointIn(ChCheckpointIn& cp) {
+    ChLinkMotor::CheckpointIn(cp);
+    cp.Read(mrot);
+    cp.Read(mrot_dt);
+    cp.Read(mrot_dtdt);
+}
+
 void ChLinkMotorRotation::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChLinkMotorRotation>();
@@ -68,6 +68,12 @@ class ChApi ChLinkMotorRotation : public ChLinkMotor {
 
     void Update(double mytime, bool update_assets) override;
 
+    /// Write the accumulated rotation (with the number of turns) to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) override;
+
+    /// Read the accumulated rotation (with the number of turns) from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
@@ -20,6 +20,7 @@
 #include "chrono/assets/ChCamera.h"
 #include "chrono/assets/ChVisualModel.h"
 #include "chrono/collision/ChCollisionModel.h"
+#include "chrono/serialization/ChCheckpoint.h"
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/timestepper/ChState.h"
 
@@ -420,6 +421,17 @@ class ChApi ChPhysicsItem : public ChObj {
     /// NOTE: signs are flipped respect to the ChTimestepper dF/dx terms:  K = -dF/dq, R = -dF/dv
     virtual void KRMmatricesLoad(double Kfactor, double Rfactor, double Mfactor) {}
 
+    // CHECKPOINTING
+
+    /// Write the internal state of this item to a binary checkpoint (see ChSystem::SaveCheckpoint).
+    /// Only state which is not included in the state vectors (see IntStateGather) and cannot be recovered from them
+    /// must be written here (e.g., internal variables, histories, flags changed during simulation).
+    virtual void CheckpointOut(ChCheckpointOut& cp) {}
+
+    /// Read the internal state of this item from a binary checkpoint (see ChSystem::RestoreCheckpoint).
+    /// This must read exactly the data written by CheckpointOut.
+    virtual void CheckpointIn(ChCheckpointIn& cp) {}
+
     // SERIALIZATION
 
     /// Method to allow serialization of transient data to archives.
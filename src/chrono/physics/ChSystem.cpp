@@ -13,6 +13,8 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstring>
+#include <functional>
 
 #include "chrono/collision/ChCollisionSystemBullet.h"
 #ifdef CHRONO_COLLISION
@@ -59,6 +61,15 @@ ChSystem::ChSystem()
       tol_force(-1),
       maxiter(6),
       use_sleeping(false),
+      use_step_graph(false),
+      step_graph_concurrent(false),
+      step_ncontacts_old(0),
+      step_update_meshes(false),
+      num_islands(0),
+      num_sleeping_islands(0),
+      sleep_island_counter(0),
+      use_island_solve(false),
+      num_solver_islands(1),
       min_bounce_speed(0.15),
       max_penetration_recovery_speed(0.6),
       stepcount(0),
@@ -126,6 +137,16 @@ ChSystem::ChSystem(const ChSystem& other) {
     max_penetration_recovery_speed = other.max_penetration_recovery_speed;
     SetSolverType(other.GetSolverType());
     use_sleeping = other.use_sleeping;
+    use_step_graph = other.use_step_graph;
+    step_graph_concurrent = false;
+    step_ncontacts_old = 0;
+    step_update_meshes = false;
+    num_islands = 0;
+    num_sleeping_islands = 0;
+    sleep_island_counter = 0;
+    use_island_solve = other.use_island_solve;
+    island_solver_factory = other.island_solver_factory;
+    num_solver_islands = 1;
 
     ncontacts = other.ncontacts;
 
@@ -255,50 +276,50 @@ double ChSystem::GetSolverTolerance() const {
     return 0;
 }
 
-void ChSystem::SetSolverType(ChSolver::Type type) {
-    // Do nothing if changing to a CUSTOM solver.
-    if (type == ChSolver::Type::CUSTOM)
-        return;
-
-    descriptor = chrono_types::make_shared<ChSystemDescriptor>();
-
+// Create a solver of the specified type (only types that can be created without additional modules).
+static std::shared_ptr<ChSolver> CreateSolverOfType(ChSolver::Type type) {
     switch (type) {
         case ChSolver::Type::PSOR:
-            solver = chrono_types::make_shared<ChSolverPSOR>();
-            break;
+            return chrono_types::make_shared<ChSolverPSOR>();
         case ChSolver::Type::PSSOR:
-            solver = chrono_types::make_shared<ChSolverPSSOR>();
-            break;
+            return chrono_types::make_shared<ChSolverPSSOR>();
         case ChSolver::Type::PJACOBI:
-            solver = chrono_types::make_shared<ChSolverPJacobi>();
-            break;
+            return chrono_types::make_shared<ChSolverPJacobi>();
         case ChSolver::Type::PMINRES:
-            solver = chrono_types::make_shared<ChSolverPMINRES>();
-            break;
+            return chrono_types::make_shared<ChSolverPMINRES>();
         case ChSolver::Type::BARZILAIBORWEIN:
-            solver = chrono_types::make_shared<ChSolverBB>();
-            break;
+            return chrono_types::make_shared<ChSolverBB>();
         case ChSolver::Type::APGD:
-            solver = chrono_types::make_shared<ChSolverAPGD>();
-            break;
+            return chrono_types::make_shared<ChSolverAPGD>();
         case ChSolver::Type::GMRES:
-            solver = chrono_types::make_shared<ChSolverGMRES>();
-            break;
+            return chrono_types::make_shared<ChSolverGMRES>();
         case ChSolver::Type::MINRES:
-            solver = chrono_types::make_shared<ChSolverMINRES>();
-            break;
+            return chrono_types::make_shared<ChSolverMINRES>();
         case ChSolver::Type::SPARSE_LU:
-            solver = chrono_types::make_shared<ChSolverSparseLU>();
-            break;
+            return chrono_types::make_shared<ChSolverSparseLU>();
         case ChSolver::Type::SPARSE_QR:
-            solver = chrono_types::make_shared<ChSolverSparseQR>();
-            break;
+            return chrono_types::make_shared<ChSolverSparseQR>();
         default:
-            GetLog() << "Solver type not supported. Use SetSolver instead.\n";
-            break;
+            return nullptr;
     }
 }
 
+void ChSystem::SetSolverType(ChSolver::Type type) {
+    // Do nothing if changing to a CUSTOM solver.
+    if (type == ChSolver::Type::CUSTOM)
+        return;
+
+    descriptor = chrono_types::make_shared<ChSystemDescriptor>();
+
+    auto newsolver = CreateSolverOfType(type);
+    if (!newsolver) {
+        GetLog() << "Solver type not supported. Use SetSolver instead.\n";
+        return;
+    }
+    solver = newsolver;
+    island_solvers.clear();
+}
+
 std::shared_ptr<ChSolver> ChSystem::GetSolver() {
     // In case the solver is iterative, and if the user specified a force-level tolerance,
     // overwrite the solver's tolerance threshold.
@@ -338,6 +359,48 @@ void ChSystem::SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescri
 void ChSystem::SetSolver(std::shared_ptr<ChSolver> newsolver) {
     assert(newsolver);
     solver = newsolver;
+    island_solvers.clear();
+}
+
+void ChSystem::RegisterIslandSolverFactory(std::shared_ptr<IslandSolverFactory> factory) {
+    island_solver_factory = factory;
+    island_solvers.clear();
+}
+
+bool ChSystem::UpdateIslandSolvers(int n) {
+    while ((int)island_solvers.size() < n) {
+        auto island_solver = island_solver_factory ? island_solver_factory->CreateSolver()
+                                                   : CreateSolverOfType(solver->GetType());
+        if (!island_solver)
+            return false;
+        island_solvers.push_back(island_solver);
+    }
+
+    // Solvers created by a user-defined factory keep their own settings
+    if (island_solver_factory)
+        return true;
+
+    // Otherwise, copy the settings of the current solver (these may change between steps, see GetSolver)
+    auto iter_solver = std::dynamic_pointer_cast<ChIterativeSolver>(GetSolver());
+    auto vi_solver = std::dynamic_pointer_cast<ChIterativeSolverVI>(solver);
+    for (int i = 0; i < n; i++) {
+        if (auto iter_island = std::dynamic_pointer_cast<ChIterativeSolver>(island_solvers[i])) {
+            if (iter_solver) {
+                iter_island->m_max_iterations = iter_solver->m_max_iterations;
+                iter_island->m_tolerance = iter_solver->m_tolerance;
+                iter_island->m_use_precond = iter_solver->m_use_precond;
+                iter_island->m_warm_start = iter_solver->m_warm_start;
+            }
+        }
+        if (auto vi_island = std::dynamic_pointer_cast<ChIterativeSolverVI>(island_solvers[i])) {
+            if (vi_solver) {
+                vi_island->SetOmega(vi_solver->GetOmega());
+                vi_island->SetSharpnessLambda(vi_solver->GetSharpnessLambda());
+            }
+        }
+    }
+
+    return true;
 }
 
 void ChSystem::SetCollisionSystemType(ChCollisionSystemType type) {
@@ -513,130 +576,185 @@ bool ChSystem::ManageSleepingBodies() {
     if (!GetUseSleeping())
         return 0;
 
+    const auto& bodylist = assembly.bodylist;
+    int nbodies = (int)bodylist.size();
+
     // STEP 1:
     // See if some body could change from no sleep-> sleep
 
-    for (auto& body : assembly.bodylist) {
+    for (auto& body : bodylist) {
         // mark as 'could sleep' candidate
         body->TrySleeping();
     }
 
     // STEP 2:
-    // See if some sleeping or potential sleeping body is touching a non sleeping one,
-    // if so, set to no sleep.
+    // Build the body islands, i.e. the connected components of the graph of non-fixed bodies, with links and contacts
+    // as edges. Fixed bodies do not connect islands. Contacts between sleeping bodies are not generated, so sleeping
+    // bodies are also connected through the identifier of the island they fell asleep with.
+
+    std::unordered_map<ChBody*, int> body_index;
+    body_index.reserve(nbodies);
+    for (int i = 0; i < nbodies; i++) {
+        if (!bodylist[i]->GetBodyFixed())
+            body_index[bodylist[i].get()] = i;
+    }
+    auto index = [&body_index](ChPhysicsItem* item) {
+        auto body = dynamic_cast<ChBody*>(item);
+        if (!body)
+            return -1;
+        auto it = body_index.find(body);
+        return it == body_index.end() ? -1 : it->second;
+    };
 
-    // Make this class for iterating through contacts
+    // Union-find over body indices
+    std::vector<int> parent(nbodies);
+    for (int i = 0; i < nbodies; i++)
+        parent[i] = i;
+    auto find = [&parent](int i) {
+        while (parent[i] != i) {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+    auto join = [&parent, &find](int i, int j) {
+        i = find(i);
+        j = find(j);
+        if (i != j)
+            parent[j] = i;
+    };
+
+    // Bodies which must be kept awake (e.g., connected to ground through a link requiring waking)
+    std::vector<char> keep_awake(nbodies, 0);
+
+    // Connect bodies which fell asleep in the same island (including bodies woken up externally since)
+    std::unordered_map<unsigned int, int> island_first;
+    for (int i = 0; i < nbodies; i++) {
+        auto it = sleep_island.find(bodylist[i].get());
+        if (it == sleep_island.end())
+            continue;
+        auto first = island_first.insert({it->second, i});
+        if (!first.second)
+            join(first.first->second, i);
+    }
 
-    class _wakeup_reporter_class : public ChContactContainer::ReportContactCallback {
+    // Connect bodies through links
+    for (auto& link : assembly.linklist) {
+        if (link->IsDisabled() || link->IsBroken() || !link->IsValid())
+            continue;
+        auto Lpointer = std::dynamic_pointer_cast<ChLink>(link);
+        if (!Lpointer)
+            continue;
+        int i1 = index(dynamic_cast<ChPhysicsItem*>(Lpointer->GetBody1()));
+        int i2 = index(dynamic_cast<ChPhysicsItem*>(Lpointer->GetBody2()));
+        if (i1 >= 0 && i2 >= 0) {
+            join(i1, i2);
+        } else if (Lpointer->IsRequiringWaking()) {
+            if (i1 >= 0)
+                keep_awake[i1] = 1;
+            if (i2 >= 0)
+                keep_awake[i2] = 1;
+        }
+    }
+
+    // Connect bodies through contacts
+    class _island_reporter_class : public ChContactContainer::ReportContactCallback {
       public:
-        // Callback, used to report contact points already added to the container.
-        // If returns false, the contact scanning will be stopped.
-        virtual bool OnReportContact(
-            const ChVector<>& pA,             // get contact pA
-            const ChVector<>& pB,             // get contact pB
-            const ChMatrix33<>& plane_coord,  // get contact plane coordsystem (A column 'X' is contact normal)
-            const double& distance,           // get contact distance
-            const double& eff_radius,         // effective radius of curvature at contact
-            const ChVector<>& react_forces,   // get react.forces (if already computed). In coordsystem 'plane_coord'
-            const ChVector<>& react_torques,  // get react.torques, if rolling friction (if already computed).
-            ChContactable* contactobjA,  // get model A (note: some containers may not support it and could be zero!)
-            ChContactable* contactobjB   // get model B (note: some containers may not support it and could be zero!)
-            ) override {
-            if (!(contactobjA && contactobjB))
-                return true;
-            ChBody* b1 = dynamic_cast<ChBody*>(contactobjA);
-            ChBody* b2 = dynamic_cast<ChBody*>(contactobjB);
-            if (!(b1 && b2))
-                return true;
-            bool sleep1 = b1->GetSleeping();
-            bool sleep2 = b2->GetSleeping();
-            bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-            bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-            bool ground1 = b1->GetBodyFixed();
-            bool ground2 = b2->GetBodyFixed();
-            if (sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->SetSleeping(false);
-                need_Setup_A = true;
-            }
-            if (could_sleep1 && !(sleep2 || could_sleep2) && !ground2) {
-                b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-            }
-            if (could_sleep2 && !(sleep1 || could_sleep1) && !ground1) {
-                b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-            }
-            someone_sleeps = sleep1 | sleep2 | someone_sleeps;
+        _island_reporter_class(std::function<void(ChContactable*, ChContactable*)> f) : connect(f) {}
 
+        // Callback, used to report contact points already added to the container.
+        virtual bool OnReportContact(const ChVector<>& pA,
+                                     const ChVector<>& pB,
+                                     const ChMatrix33<>& plane_coord,
+                                     const double& distance,
+                                     const double& eff_radius,
+                                     const ChVector<>& react_forces,
+                                     const ChVector<>& react_torques,
+                                     ChContactable* contactobjA,
+                                     ChContactable* contactobjB) override {
+            if (contactobjA && contactobjB)
+                connect(contactobjA, contactobjB);
             return true;  // to continue scanning contacts
         }
 
-        // Data
-        bool someone_sleeps;
-        bool need_Setup_A;
+        std::function<void(ChContactable*, ChContactable*)> connect;
     };
 
-    auto my_waker = chrono_types::make_shared<_wakeup_reporter_class>();
-    my_waker->need_Setup_A = false;
-
-    bool need_Setup_L = false;
+    auto my_reporter = chrono_types::make_shared<_island_reporter_class>([&](ChContactable* a, ChContactable* b) {
+        int i1 = index(a->GetPhysicsItem());
+        int i2 = index(b->GetPhysicsItem());
+        if (i1 >= 0 && i2 >= 0)
+            join(i1, i2);
+    });
+    contact_container->ReportAllContacts(my_reporter);
+
+    // STEP 3:
+    // An island can sleep only if all its bodies are sleeping or could sleep.
+
+    std::vector<char> island_awake(nbodies, 0);
+    for (int i = 0; i < nbodies; i++) {
+        if (bodylist[i]->GetBodyFixed())
+            continue;
+        bool could_sleep = bodylist[i]->GetSleeping() || bodylist[i]->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
+        if (!could_sleep || keep_awake[i])
+            island_awake[find(i)] = 1;
+    }
 
-    for (int i = 0; i < 1; i++)  //***TO DO*** reconfigurable number of wakeup cycles
-    {
-        my_waker->someone_sleeps = false;
-
-        // scan all links and wake connected bodies
-        for (auto& link : assembly.linklist) {
-            if (auto Lpointer = std::dynamic_pointer_cast<ChLink>(link)) {
-                if (Lpointer->IsRequiringWaking()) {
-                    ChBody* b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
-                    ChBody* b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
-                    if (b1 && b2) {
-                        bool sleep1 = b1->GetSleeping();
-                        bool sleep2 = b2->GetSleeping();
-                        bool could_sleep1 = b1->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-                        bool could_sleep2 = b2->BFlagGet(ChBody::BodyFlag::COULDSLEEP);
-                        if (sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->SetSleeping(false);
-                            need_Setup_L = true;
-                        }
-                        if (could_sleep1 && !(sleep2 || could_sleep2)) {
-                            b1->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-                        }
-                        if (could_sleep2 && !(sleep1 || could_sleep1)) {
-                            b2->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
-                        }
-                    }
-                }
+    // STEP 4:
+    // Put to sleep or wake up islands as a whole.
+
+    bool changed = false;
+    num_islands = 0;
+    num_sleeping_islands = 0;
+    std::unordered_map<int, unsigned int> island_id;
+    std::unordered_map<ChBody*, unsigned int> new_sleep_island;
+
+    for (int i = 0; i < nbodies; i++) {
+        auto body = bodylist[i].get();
+        if (body->GetBodyFixed())
+            continue;
+        int root = find(i);
+        if (root == i) {
+            num_islands++;
+            if (!island_awake[i])
+                num_sleeping_islands++;
+        }
+        if (island_awake[root]) {
+            if (body->GetSleeping()) {
+                body->SetSleeping(false);
+                changed = true;
             }
+        } else {
+            if (!body->GetSleeping()) {
+                body->SetSleeping(true);
+                changed = true;
+            }
+            auto id = island_id.insert({root, sleep_island_counter});
+            if (id.second)
+                sleep_island_counter++;
+            new_sleep_island[body] = id.first->second;
         }
-
-        // scan all contacts and wake neighboring bodies
-        contact_container->ReportAllContacts(my_waker);
-
-        // bailout wakeup cycle prematurely, if all bodies are not sleeping
-        if (!my_waker->someone_sleeps)
-            break;
     }
 
-    /// If some body still must change from no sleep-> sleep, do it
-    int need_Setup_B = 0;
-    for (auto& body : assembly.bodylist) {
-        if (body->BFlagGet(ChBody::BodyFlag::COULDSLEEP)) {
-            body->SetSleeping(true);
-            ++need_Setup_B;
+    sleep_island.swap(new_sleep_island);
+
+    // Links which only connect sleeping (or fixed) bodies are excluded from the system
+    for (auto& link : assembly.linklist) {
+        auto Lpointer = std::dynamic_pointer_cast<ChLink>(link);
+        if (!Lpointer)
+            continue;
+        auto b1 = dynamic_cast<ChBody*>(Lpointer->GetBody1());
+        auto b2 = dynamic_cast<ChBody*>(Lpointer->GetBody2());
+        bool sleeping = b1 && b2 && !b1->IsActive() && !b2->IsActive() && (b1->GetSleeping() || b2->GetSleeping());
+        if (sleeping != Lpointer->IsSleeping()) {
+            Lpointer->SetSleeping(sleeping);
+            changed = true;
         }
     }
 
     // if some body has been activated/deactivated because of sleep state changes,
     // the offsets and DOF counts must be updated:
-    if (my_waker->need_Setup_A || need_Setup_B || need_Setup_L) {
+    if (changed) {
         Setup();
         return true;
     }
@@ -1082,6 +1200,31 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // R and Qc vectors  --> solver sparse solver structures  (also sets L and Dv to warmstart)
     IntToDescriptor(0, Dv, R, 0, L, Qc);
 
+    // Let the solver know how many threads it may use
+    descriptor->SetNumThreads(nthreads_chrono);
+
+    // If requested, split the problem into independent islands, each solved with its own solver.
+    // Any change in the partition invalidates the setup of the island solvers (or of the current solver).
+    bool use_islands = false;
+    if (use_island_solve) {
+        use_islands = solver_islands.Build(*descriptor) && UpdateIslandSolvers(solver_islands.GetNumIslands());
+        descriptor->UpdateCountsAndOffsets();
+
+        std::vector<int> signature;
+        if (use_islands) {
+            for (int i = 0; i < solver_islands.GetNumIslands(); i++) {
+                auto& island = solver_islands.GetIsland(i);
+                signature.push_back((int)island.GetVariablesList().size());
+                signature.push_back((int)island.GetConstraintsList().size());
+            }
+        }
+        if (signature != island_signature) {
+            island_signature.swap(signature);
+            force_setup = true;
+        }
+        num_solver_islands = use_islands ? solver_islands.GetNumIslands() : 1;
+    }
+
     // If the solver's Setup() must be called or if the solver's Solve() requires it,
     // fill the sparse system structures with information in G and Cq.
     if (force_setup || GetSolver()->SolveRequiresMatrix()) {
@@ -1123,22 +1266,58 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
 
     GetSolver()->EnableWrite(write_matrix, std::to_string(stepcount) + "_" + std::to_string(solvecount), output_dir);
 
-    // If indicated, first perform a solver setup.
-    // Return 'false' if the setup phase fails.
-    if (force_setup) {
-        timer_ls_setup.start();
-        bool success = GetSolver()->Setup(*descriptor);
-        timer_ls_setup.stop();
-        setupcount++;
-        if (!success)
-            return false;
-    }
+    if (use_islands) {
+        // Solve the islands concurrently, largest first. Solving an island sets the offsets of its variables and
+        // constraints, so these must be reset before each phase and, at the end, for the entire descriptor.
+        int nislands = solver_islands.GetNumIslands();
+        for (int i = 0; i < nislands; i++)
+            solver_islands.GetIsland(i).SetMassFactor(descriptor->GetMassFactor());
+
+        if (force_setup) {
+            timer_ls_setup.start();
+            bool success = true;
+#pragma omp parallel for num_threads(nthreads_chrono) schedule(dynamic, 1) reduction(&& : success)
+            for (int i = 0; i < nislands; i++) {
+                auto& island = solver_islands.GetIsland(i);
+                island.UpdateCountsAndOffsets();
+                success = island_solvers[i]->Setup(island) && success;
+            }
+            timer_ls_setup.stop();
+            setupcount++;
+            if (!success) {
+                descriptor->UpdateCountsAndOffsets();
+                return false;
+            }
+        }
+
+        timer_ls_solve.start();
+#pragma omp parallel for num_threads(nthreads_chrono) schedule(dynamic, 1)
+        for (int i = 0; i < nislands; i++) {
+            auto& island = solver_islands.GetIsland(i);
+            island.UpdateCountsAndOffsets();
+            island_solvers[i]->Solve(island);
+        }
+        timer_ls_solve.stop();
+
+        descriptor->UpdateCountsAndOffsets();
+    } else {
+        // If indicated, first perform a solver setup.
+        // Return 'false' if the setup phase fails.
+        if (force_setup) {
+            timer_ls_setup.start();
+            bool success = GetSolver()->Setup(*descriptor);
+            timer_ls_setup.stop();
+            setupcount++;
+            if (!success)
+                return false;
+        }
 
-    // Solve the problem
-    // The solution is scattered in the provided system descriptor
-    timer_ls_solve.start();
-    GetSolver()->Solve(*descriptor);
-    timer_ls_solve.stop();
+        // Solve the problem
+        // The solution is scattered in the provided system descriptor
+        timer_ls_solve.start();
+        GetSolver()->Solve(*descriptor);
+        timer_ls_solve.stop();
+    }
 
     // Dv and L vectors  <-- sparse solver structures
     IntFromDescriptor(0, Dv, 0, L);
@@ -1287,6 +1466,14 @@ double ChSystem::ComputeCollisions() {
     collision_system->Run();
     collision_system->PostProcess();
 
+    ReportCollisions();
+
+    timer_collision.stop();
+
+    return mretC;
+}
+
+void ChSystem::ReportCollisions() {
     // Report and store contacts and/or proximities, if there are some
     // containers in the physic system. The default contact container
     // for ChBody and ChParticles is used always.
@@ -1314,10 +1501,6 @@ double ChSystem::ComputeCollisions() {
 
     // Cache the total number of contacts
     ncontacts = contact_container->GetNcontacts();
-
-    timer_collision.stop();
-
-    return mretC;
 }
 
 // =============================================================================
@@ -1454,54 +1637,10 @@ bool ChSystem::Integrate_Y() {
     if (visual_system)
         visual_system->OnSetup(this);
 
-    // Compute contacts and create contact constraints
-    int ncontacts_old = ncontacts;
-    ComputeCollisions();
-
-    // Declare an NSC system as "out of date" if there are contacts
-    if (GetContactMethod() == ChContactMethod::NSC && (ncontacts_old != 0 || ncontacts != 0))
-        is_updated = false;
-
-    // Counts dofs, number of constraints, statistics, etc.
-    // Note: this must be invoked at all times (regardless of the flag is_updated), as various physics items may use
-    // their own Setup to perform operations at the beginning of a step.
-    Setup();
-
-    // If needed, update everything. No need to update visualization assets here.
-    if (!is_updated) {
-        Update(false);
-    }
-
-    // Re-wake the bodies that cannot sleep because they are in contact with
-    // some body that is not in sleep state.
-    ManageSleepingBodies();
-
-    // Prepare lists of variables and constraints.
-    DescriptorPrepareInject(*descriptor);
-
-    // No need to update counts and offsets, as already done by the above call (in ChSystemDescriptor::EndInsertion)
-    ////descriptor->UpdateCountsAndOffsets();
-
-    // Set some settings in timestepper object
-    timestepper->SetQcDoClamp(true);
-    timestepper->SetQcClamping(max_penetration_recovery_speed);
-    if (std::dynamic_pointer_cast<ChTimestepperHHT>(timestepper) ||
-        std::dynamic_pointer_cast<ChTimestepperNewmark>(timestepper))
-        timestepper->SetQcDoClamp(false);
-
-    // PERFORM TIME STEP HERE!
-    {
-        CH_PROFILE("Advance");
-        timer_advance.start();
-        timestepper->Advance(step);
-        timer_advance.stop();
-    }
-
-    // Executes custom processing at the end of step
-    CustomEndOfStep();
-
-    // Call method to gather contact forces/torques in rigid bodies
-    contact_container->ComputeContactForces();
+    // Execute the graph of the step stages (built at the first step and whenever the execution mode changes)
+    if (step_graph.GetNumTasks() == 0 || step_graph_concurrent != use_step_graph)
+        BuildStepTaskGraph();
+    step_graph.Run(use_step_graph ? nthreads_chrono : 1);
 
     // Time elapsed for step
     timer_step.stop();
@@ -1516,6 +1655,162 @@ bool ChSystem::Integrate_Y() {
     return true;
 }
 
+// -----------------------------------------------------------------------------
+//  STAGES OF THE INTEGRATION STEP
+//
+//  Serial pipeline:
+//    collision -> setup -> update -> sleeping -> descriptor -> advance -> end_of_step
+//
+//  Task graph (if enabled):
+//    collision_sync -> { collision | mesh_update } -> collision_report -> setup -> update -> sleeping -> ...
+//
+//  In the task graph, only work which is disjoint by construction is overlapped. The broadphase and narrowphase
+//  ("collision") operate on the data of the collision system only, synchronized with the state of the system in
+//  "collision_sync". Mesh updates ("mesh_update") only read the node states and write element data. Everything else
+//  that may access the collision system or the contactables (reporting of contacts and collision callbacks, setup of
+//  the physics items, e.g. SCM terrain ray casts, and updates of the other items) runs after both complete, in the
+//  same order as in the serial pipeline. The collision detection is always executed on the calling thread (first task
+//  in its wave), so that the profilers (not thread safe) are only accessed from that thread.
+//
+//  The graph is built once, with tasks referencing only the system, and the per-step data is kept in the system.
+// -----------------------------------------------------------------------------
+
+void ChSystem::BuildStepTaskGraph() {
+    step_graph.Clear();
+    step_graph_concurrent = use_step_graph;
+
+    int update;
+    if (!use_step_graph) {
+        // Compute contacts and create contact constraints
+        int collision = step_graph.AddTask("collision", [this]() {
+            int ncontacts_old = ncontacts;
+            ComputeCollisions();
+
+            // Declare an NSC system as "out of date" if there are contacts
+            if (GetContactMethod() == ChContactMethod::NSC && (ncontacts_old != 0 || ncontacts != 0))
+                is_updated = false;
+        });
+
+        // Counts dofs, number of constraints, statistics, etc.
+        // Note: this must be invoked at all times (regardless of the flag is_updated), as various physics items may
+        // use their own Setup to perform operations at the beginning of a step.
+        int setup = step_graph.AddTask("setup", [this]() { Setup(); }, {collision});
+
+        // If needed, update everything. No need to update visualization assets here.
+        update = step_graph.AddTask("update",
+                                    [this]() {
+                                        if (!is_updated)
+                                            Update(false);
+                                    },
+                                    {setup});
+    } else {
+        int sync = step_graph.AddTask("collision_sync", [this]() {
+            // Insert queued items (this modifies the assembly lists)
+            assembly.FlushBatch();
+
+            // The system is out of date if it was not updated after the last state change, or if it is an NSC system
+            // which had contacts at the previous step (see collision_report)
+            step_ncontacts_old = ncontacts;
+            step_update_meshes = !is_updated || (GetContactMethod() == ChContactMethod::NSC && ncontacts != 0);
+
+            timer_collision.start();
+            assembly.SyncCollisionModels();
+            collision_system->PreProcess();
+            timer_collision.stop();
+        });
+
+        // Broadphase and narrowphase
+        int collision = step_graph.AddTask("collision",
+                                           [this]() {
+                                               timer_collision.start();
+                                               collision_system->Run();
+                                               timer_collision.stop();
+                                           },
+                                           {sync});
+
+        // Mesh updates, if the system is known to be out of date before the collision detection
+        int mesh_update = step_graph.AddTask("mesh_update",
+                                             [this]() {
+                                                 if (!step_update_meshes)
+                                                     return;
+                                                 timer_update.start();
+                                                 assembly.UpdateMeshes(false);
+                                                 timer_update.stop();
+                                             },
+                                             {sync});
+
+        int report = step_graph.AddTask("collision_report",
+                                        [this]() {
+                                            timer_collision.start();
+                                            collision_system->PostProcess();
+                                            ReportCollisions();
+                                            timer_collision.stop();
+
+                                            // Declare an NSC system as "out of date" if there are contacts
+                                            if (GetContactMethod() == ChContactMethod::NSC &&
+                                                (step_ncontacts_old != 0 || ncontacts != 0))
+                                                is_updated = false;
+                                        },
+                                        {collision, mesh_update});
+
+        int setup = step_graph.AddTask("setup", [this]() { Setup(); }, {report});
+
+        // Update the items not updated yet (all of them if the meshes were not updated with the collision detection)
+        update = step_graph.AddTask("update",
+                                    [this]() {
+                                        if (is_updated)
+                                            return;
+                                        if (!step_update_meshes) {
+                                            Update(false);
+                                            return;
+                                        }
+                                        timer_update.start();
+                                        assembly.UpdateItems(false);
+                                        contact_container->Update(ch_time, false);
+                                        timer_update.stop();
+                                    },
+                                    {setup});
+    }
+
+    // Re-wake the bodies that cannot sleep because they are in contact with
+    // some body that is not in sleep state.
+    int sleeping = step_graph.AddTask("sleeping", [this]() { ManageSleepingBodies(); }, {update});
+
+    int prepare = step_graph.AddTask("descriptor",
+                                     [this]() {
+                                         // Prepare lists of variables and constraints.
+                                         DescriptorPrepareInject(*descriptor);
+
+                                         // Set some settings in timestepper object
+                                         timestepper->SetQcDoClamp(true);
+                                         timestepper->SetQcClamping(max_penetration_recovery_speed);
+                                         if (std::dynamic_pointer_cast<ChTimestepperHHT>(timestepper) ||
+                                             std::dynamic_pointer_cast<ChTimestepperNewmark>(timestepper))
+                                             timestepper->SetQcDoClamp(false);
+                                     },
+                                     {sleeping});
+
+    // PERFORM TIME STEP HERE!
+    int advance = step_graph.AddTask("advance",
+                                     [this]() {
+                                         CH_PROFILE("Advance");
+                                         timer_advance.start();
+                                         timestepper->Advance(step);
+                                         timer_advance.stop();
+                                     },
+                                     {prepare});
+
+    step_graph.AddTask("end_of_step",
+                       [this]() {
+                           // Executes custom processing at the end of step
+                           CustomEndOfStep();
+
+                           // Call method to gather contact forces/torques in rigid bodies
+                           contact_container->ComputeContactForces();
+                       },
+                       {advance});
+}
+
 // -----------------------------------------------------------------------------
 // **** SATISFY ALL CONSTRAINT EQUATIONS WITH NEWTON
 // **** ITERATION, UNTIL TOLERANCE SATISFIED, THEN UPDATE
@@ -2005,6 +2300,151 @@ bool ChSystem::DoFullAssembly() {
     return last_err;
 }
 
+// -----------------------------------------------------------------------------
+//  CHECKPOINTING
+
+static const char CH_CHECKPOINT_MAGIC[8] = {'C', 'H', 'R', 'O', 'N', 'O', 'C', 'P'};
+static const uint32_t CH_CHECKPOINT_VERSION = 1;
+
+bool ChSystem::SaveCheckpoint(const std::string& filename) {
+    if (!is_initialized)
+        return false;
+
+    ChCheckpointOut cp(filename);
+    if (!cp.IsOpen())
+        return false;
+
+    // Gather the current state (using the offsets computed at the last step)
+    ChState x(GetNcoords_x(), this);
+    ChStateDelta v(GetNcoords_w(), this);
+    ChStateDelta a(GetNcoords_w(), this);
+    ChVectorDynamic<> L(GetNconstr());
+    double T;
+    StateGather(x, v, T);
+    StateGatherAcceleration(a);
+    StateGatherReactions(L);
+
+    cp.Write(CH_CHECKPOINT_MAGIC, sizeof(CH_CHECKPOINT_MAGIC));
+    cp.Write(CH_CHECKPOINT_VERSION);
+
+    cp.Write(ch_time);
+    cp.Write(step);
+    cp.Write((uint64_t)stepcount);
+    cp.Write(solvecount);
+    cp.Write(setupcount);
+    cp.Write(ncontacts);
+
+    // Reactions of contacts are not saved (contacts are regenerated at the next step)
+    cp.Write(x);
+    cp.Write(v);
+    cp.Write(a);
+    cp.Write(ChVectorDynamic<>(L.head(assembly.ndoc_w)));
+
+    cp.BeginBlock();
+    assembly.CheckpointOut(cp);
+    cp.EndBlock();
+
+    cp.BeginBlock();
+    contact_container->CheckpointOut(cp);
+    cp.EndBlock();
+
+    cp.BeginBlock();
+    timestepper->CheckpointOut(cp);
+    cp.EndBlock();
+
+    cp.BeginBlock();
+    collision_system->CheckpointOut(cp);
+    cp.EndBlock();
+
+    return cp.Close();
+}
+
+bool ChSystem::RestoreCheckpoint(const std::string& filename) {
+    ChCheckpointIn cp(filename);
+    if (!cp.IsOpen())
+        return false;
+
+    if (!is_initialized)
+        SetupInitial();
+    Setup();
+
+    try {
+        char magic[sizeof(CH_CHECKPOINT_MAGIC)];
+        uint32_t version;
+        cp.Read(magic, sizeof(magic));
+        cp.Read(version);
+        if (std::memcmp(magic, CH_CHECKPOINT_MAGIC, sizeof(magic)) != 0 || version != CH_CHECKPOINT_VERSION)
+            throw ChException("Not a Chrono checkpoint file (or unsupported version)");
+
+        double time;
+        double step_size;
+        uint64_t num_steps;
+        int num_solves;
+        int num_setups;
+        int num_contacts;
+        cp.Read(time);
+        cp.Read(step_size);
+        cp.Read(num_steps);
+        cp.Read(num_solves);
+        cp.Read(num_setups);
+        cp.Read(num_contacts);
+
+        ChState x(this);
+        ChStateDelta v(this);
+        ChStateDelta a(this);
+        ChVectorDynamic<> L;
+        cp.Read(x);
+        cp.Read(v);
+        cp.Read(a);
+        cp.Read(L);
+        if (x.size() != GetNcoords_x() || v.size() != GetNcoords_w() || a.size() != GetNcoords_w() ||
+            L.size() != assembly.ndoc_w)
+            throw ChException("Checkpoint data inconsistent with the system (number of coordinates)");
+
+        // Scatter the state and the reactions
+        ChVectorDynamic<> L_all = ChVectorDynamic<>::Zero(GetNconstr());
+        L_all.head(L.size()) = L;
+        StateScatter(x, v, time, false);
+        StateScatterAcceleration(a);
+        StateScatterReactions(L_all);
+
+        // Restore the internal state of all items (which may also override parts of the scattered state)
+        cp.BeginBlock();
+        assembly.CheckpointIn(cp);
+        cp.EndBlock();
+
+        cp.BeginBlock();
+        contact_container->CheckpointIn(cp);
+        cp.EndBlock();
+
+        cp.BeginBlock();
+        timestepper->CheckpointIn(cp);
+        cp.EndBlock();
+
+        cp.BeginBlock();
+        collision_system->CheckpointIn(cp);
+        cp.EndBlock();
+
+        ch_time = time;
+        step = step_size;
+        stepcount = (size_t)num_steps;
+        solvecount = num_solves;
+        setupcount = num_setups;
+        ncontacts = num_contacts;
+
+        // Update all items with the restored state
+        Update(time, true);
+    } catch (const ChException& e) {
+        GetLog() << "Cannot restore checkpoint " << filename << ": " << e.what() << "\n";
+        return false;
+    }
+
+    applied_forces_current = false;
+    is_updated = true;
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 //  STREAMING - FILE HANDLING
 
@@ -22,16 +22,19 @@
 #include <cstring>
 #include <iostream>
 #include <list>
+#include <unordered_map>
 
 #include "chrono/core/ChGlobal.h"
 #include "chrono/core/ChLog.h"
 #include "chrono/core/ChMath.h"
+#include "chrono/core/ChTaskGraph.h"
 #include "chrono/core/ChTimer.h"
 #include "chrono/collision/ChCollisionSystem.h"
 #include "chrono/utils/ChOpenMP.h"
 #include "chrono/physics/ChAssembly.h"
 #include "chrono/physics/ChContactContainer.h"
 #include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChSystemDescriptorIslands.h"
 #include "chrono/solver/ChSolver.h"
 #include "chrono/timestepper/ChAssemblyAnalysis.h"
 #include "chrono/timestepper/ChIntegrable.h"
@@ -197,6 +200,31 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Get the current value of the force-level tolerance (used with iterative solvers only).
     double GetSolverForceTolerance() const { return tol_force; }
 
+    /// Class to be used as a callback interface for creating the solvers used for independent islands.
+    class ChApi IslandSolverFactory {
+      public:
+        virtual ~IslandSolverFactory() {}
+
+        /// Create a new solver instance, to be used for one island.
+        virtual std::shared_ptr<ChSolver> CreateSolver() = 0;
+    };
+
+    /// Enable/disable solving independent islands separately (default: false).
+    /// If enabled, the problem collected in the system descriptor is split into independent subproblems (see
+    /// ChSystemDescriptorIslands), which are then solved concurrently on up to GetNumThreadsChrono() threads, each with
+    /// its own solver instance. By default, island solvers are of the same type as the current solver (only the types
+    /// supported by SetSolverType) and inherit its iterative solver settings; use RegisterIslandSolverFactory to create
+    /// other solvers. If the problem cannot be split or no island solver can be created, the current solver is used on
+    /// the entire problem. Note that, when islands are solved separately, the statistics of the current solver (e.g.,
+    /// number of iterations) are not updated.
+    void EnableIslandSolve(bool val) { use_island_solve = val; }
+
+    /// Specify a user-defined factory for the solvers used for independent islands.
+    void RegisterIslandSolverFactory(std::shared_ptr<IslandSolverFactory> factory);
+
+    /// Return the number of islands solved separately at the last call to the solver (1 if the problem was not split).
+    int GetNumSolverIslands() const { return num_solver_islands; }
+
     /// Instead of using the default 'system descriptor', you can create your own custom descriptor
     /// (inherited from ChSystemDescriptor) and plug it into the system using this function.
     void SetSystemDescriptor(std::shared_ptr<ChSystemDescriptor> newdescriptor);
@@ -238,6 +266,10 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     int GetNumthreadsCollision() const { return nthreads_collision; }
     int GetNumthreadsEigen() const { return nthreads_eigen; }
 
+    /// Set the minimum number of bodies (or shafts, or links) for parallel processing of the system state functions.
+    /// See ChAssembly::SetParallelThreshold.
+    void SetParallelThreshold(int threshold) { assembly.SetParallelThreshold(threshold); }
+
     //
     // DATABASE HANDLING
     //
@@ -452,6 +484,13 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// Return the time (in seconds) for narrowphase collision detection, within the time step.
     double GetTimerCollisionNarrow() const { return collision_system->GetTimerCollisionNarrow(); }
 
+    /// Return the task graph of the integration step.
+    /// The graph provides the time spent in each stage of the last step (see ChTaskGraph::GetTaskTime). With the serial
+    /// pipeline, the stages are: "collision", "setup", "update", "sleeping", "descriptor", "advance", "end_of_step".
+    /// With the task graph enabled (see SetUseStepTaskGraph), the "collision" stage is split in "collision_sync",
+    /// "collision" (broadphase and narrowphase, executed concurrently with "mesh_update"), and "collision_report".
+    const ChTaskGraph& GetStepTaskGraph() const { return step_graph; }
+
     /// Get current estimated RTF (real time factor).
     double GetRTF() const { return m_RTF; }
 
@@ -718,18 +757,55 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// motion has almost come to a rest. This feature will allow faster simulation
     /// of large scenarios for real-time purposes, but it will affect the precision!
     /// This functionality can be turned off selectively for specific ChBodies.
+    /// Bodies are put to sleep and woken up by islands, i.e. groups of non-fixed bodies connected through links or
+    /// contacts. An island falls asleep only when all its bodies satisfied their sleeping thresholds (see
+    /// ChBody::SetSleepTime, ChBody::SetSleepMinSpeed, and ChBody::SetSleepMinWvel); it is woken up as a whole as soon
+    /// as one of its bodies is touched by an awake body. Sleeping bodies and the links between them are excluded from
+    /// the system descriptor and from the narrowphase collision detection.
     void SetUseSleeping(bool ms) { use_sleeping = ms; }
 
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool GetUseSleeping() const { return use_sleeping; }
 
+    /// Enable concurrent execution of independent stages of the integration step (default: false).
+    /// If enabled, the broadphase and narrowphase collision detection (which only access the data of the collision
+    /// system) are performed concurrently with the update of the FEA meshes (which only access their nodes and
+    /// elements), on up to GetNumThreadsChrono() threads. The contact reporting, the collision callbacks, and the setup
+    /// and update of all other items are executed after both complete, in the same order as with the serial pipeline.
+    /// Items queued with ChAssembly::AddBatch are inserted before the collision detection. With this option, element
+    /// updates must not access the collision system. Results are identical to those of the serial pipeline, but the
+    /// option can be turned off to exactly reproduce the serial order of operations (e.g., for debugging).
+    void SetUseStepTaskGraph(bool val) { use_step_graph = val; }
+
+    /// Tell if independent stages of the integration step are executed concurrently.
+    bool GetUseStepTaskGraph() const { return use_step_graph; }
+
+    /// Return the number of body islands found at the last step (only if sleeping is enabled).
+    int GetNumIslands() const { return num_islands; }
+
+    /// Return the number of sleeping body islands at the last step (only if sleeping is enabled).
+    int GetNumSleepingIslands() const { return num_sleeping_islands; }
+
   private:
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
+    /// Bodies are grouped in islands (connected components of the graph of non-fixed bodies and their links and
+    /// contacts) and an island is put to sleep or woken up as a whole.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
     /// returns false if nothing changed. In the former case, also performs Setup()
     /// because the sleeping policy changed the totalDOFs and offsets.
     bool ManageSleepingBodies();
 
+    /// Build the task graph of the integration step.
+    void BuildStepTaskGraph();
+
+    /// Report the contacts and proximities found by the collision system and invoke the custom collision callbacks.
+    /// Assumes that the collision detection (broadphase and narrowphase) was already performed.
+    void ReportCollisions();
+
+    /// Make sure there is a solver for each of the first n islands and update their settings.
+    /// Returns false if an island solver cannot be created.
+    bool UpdateIslandSolvers(int n);
+
     /// Performs a single dynamical simulation step, according to
     /// current values of:  Y, time, step  (and other minor settings)
     /// Depending on the integration type, it switches to one of the following:
@@ -883,6 +959,26 @@ class ChApi ChSystem : public ChIntegrableIIorder {
     /// nonlinearities before coming to the precise static solution.
     bool DoStaticRelaxing(int nsteps = 10);
 
+    //
+    // CHECKPOINTING
+    //
+
+    /// Save the full dynamic state of the system to a binary checkpoint file.
+    /// The checkpoint includes the time, the state vectors (positions, velocities, accelerations, and constraint
+    /// reactions), the internal state of all physics items (see ChPhysicsItem::CheckpointOut), and the internal state
+    /// of the timestepper and of the collision system. This function must be called between simulation steps (i.e.,
+    /// after a call to DoStepDynamics); the system is not set up again, as some physics items perform
+    /// history-dependent operations in their Setup. Return false if the system was not set up yet or if the file
+    /// cannot be written.
+    bool SaveCheckpoint(const std::string& filename);
+
+    /// Restore the full dynamic state of the system from a binary checkpoint file created with SaveCheckpoint.
+    /// The system must contain the same model as the one which was checkpointed (constructed in the same order), with
+    /// the same solver, timestepper, and collision system settings. Contacts are regenerated at the next step.
+    /// Return false if the file cannot be read or its data is inconsistent with the system; in the latter case, the
+    /// system may be left partially restored.
+    bool RestoreCheckpoint(const std::string& filename);
+
     //
     // SERIALIZATION
     //
@@ -931,9 +1027,27 @@ class ChApi ChSystem : public ChIntegrableIIorder {
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
 
+    bool use_step_graph;         ///< if true, execute independent stages of the integration step concurrently
+    ChTaskGraph step_graph;      ///< stages of the integration step
+    bool step_graph_concurrent;  ///< was the step graph built for concurrent execution?
+    int step_ncontacts_old;      ///< number of contacts at the beginning of the current step
+    bool step_update_meshes;     ///< were the meshes updated concurrently with the collision detection?
+
+    int num_islands;                                         ///< number of body islands at last step
+    int num_sleeping_islands;                                ///< number of sleeping body islands at last step
+    unsigned int sleep_island_counter;                       ///< counter for identifiers of sleeping islands
+    std::unordered_map<ChBody*, unsigned int> sleep_island;  ///< island identifier of each sleeping body
+
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< system descriptor
     std::shared_ptr<ChSolver> solver;                ///< solver for DVI or DAE problem
 
+    bool use_island_solve;                                        ///< if true, solve independent islands separately
+    std::shared_ptr<IslandSolverFactory> island_solver_factory;  ///< user-defined factory for island solvers
+    std::vector<std::shared_ptr<ChSolver>> island_solvers;       ///< solvers for independent islands
+    ChSystemDescriptorIslands solver_islands;                     ///< decomposition of the descriptor into islands
+    std::vector<int> island_signature;                            ///< sizes of the islands at the last solver call
+    int num_solver_islands;                                       ///< number of islands solved at the last solver call
+
     double min_bounce_speed;                ///< minimum speed for rebounce after impacts. Lower speeds are clamped to 0
     double max_penetration_recovery_speed;  ///< limit for the speed of penetration recovery (positive, speed of exiting)
 
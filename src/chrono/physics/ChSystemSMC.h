@@ -87,7 +87,8 @@ class ChApi ChSystemSMC : public ChSystem {
     AdhesionForceModel GetAdhesionForceModel() const { return m_adhesion_model; }
 
     /// Set the tangential displacement model.
-    /// Note that currently MultiStep falls back to OneStep.
+    /// With MultiStep, the tangential displacement of each contact is accumulated from contact initiation and stored
+    /// in the contact history of the contact container (see ChContactContainerSMC).
     void SetTangentialDisplacementModel(TangentialDisplacementModel model) { m_tdispl_model = model; }
     /// Get the current tangential displacement model.
     TangentialDisplacementModel GetTangentialDisplacementModel() const { return m_tdispl_model; }
@@ -116,6 +117,7 @@ class ChApi ChSystemSMC : public ChSystem {
 
         /// Calculate contact force (resultant of both normal and tangential components) for a contact between two
         /// objects, obj1 and obj2. Note that this function is always called with delta > 0.
+        /// With ChContactContainerPooledSMC, this function may be called concurrently for different contacts.
         virtual ChVector<> CalculateForce(
             const ChSystemSMC& sys,             ///< containing system
             const ChVector<>& normal_dir,       ///< normal contact direction (expressed in global frame)
@@ -129,6 +131,28 @@ class ChApi ChSystemSMC : public ChSystem {
             double mass1,                       ///< mass of obj1
             double mass2                        ///< mass of obj2
             ) const = 0;
+
+        /// Calculate contact force for a contact with history (used with the MultiStep tangential displacement
+        /// model). On input, delta_t is the tangential displacement of obj2 relative to obj1 accumulated since contact
+        /// initiation (including the current step and expressed in global frame). It can be modified by this function
+        /// (for example, to limit the stored displacement when the contact slides); the modified value is stored in the
+        /// contact history. The default implementation ignores the contact history.
+        virtual ChVector<> CalculateForceWithHistory(
+            const ChSystemSMC& sys,             ///< containing system
+            const ChVector<>& normal_dir,       ///< normal contact direction (expressed in global frame)
+            const ChVector<>& p1,               ///< most penetrated point on obj1 (expressed in global frame)
+            const ChVector<>& p2,               ///< most penetrated point on obj2 (expressed in global frame)
+            const ChVector<>& vel1,             ///< velocity of contact point on obj1 (expressed in global frame)
+            const ChVector<>& vel2,             ///< velocity of contact point on obj2 (expressed in global frame)
+            const ChMaterialCompositeSMC& mat,  ///< composite material for contact pair
+            double delta,                       ///< overlap in normal direction
+            double eff_radius,                  ///< effective radius of curvature at contact
+            double mass1,                       ///< mass of obj1
+            double mass2,                       ///< mass of obj2
+            ChVector<>& delta_t                 ///< [in/out] accumulated tangential displacement
+            ) const {
+            return CalculateForce(sys, normal_dir, p1, p2, vel1, vel2, mat, delta, eff_radius, mass1, mass2);
+        }
     };
 
     /// Change the default SMC contact force calculation.
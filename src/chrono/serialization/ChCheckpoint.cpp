@@ -0,0 +1,178 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Binary checkpoint files, for saving and restoring the full state of a system.
+//
+// =============================================================================
+
+#include <cassert>
+#include <cstring>
+
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "chrono/core/ChException.h"
+#include "chrono/serialization/ChCheckpoint.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+
+ChCheckpointOut::ChCheckpointOut(const std::string& filename) {
+    m_stream.open(filename, std::ios::binary | std::ios::out | std::ios::trunc);
+}
+
+ChCheckpointOut::~ChCheckpointOut() {
+    Close();
+}
+
+bool ChCheckpointOut::Close() {
+    if (!m_stream.is_open())
+        return false;
+    m_stream.write(m_data.data(), m_data.size());
+    m_stream.close();
+    bool success = !m_stream.fail();
+    m_data.clear();
+    m_data.shrink_to_fit();
+    return success;
+}
+
+void ChCheckpointOut::Write(const void* data, size_t nbytes) {
+    const char* bytes = static_cast<const char*>(data);
+    m_data.insert(m_data.end(), bytes, bytes + nbytes);
+}
+
+void ChCheckpointOut::Write(const ChVector<>& v) {
+    Write(v.data(), 3 * sizeof(double));
+}
+
+void ChCheckpointOut::Write(const ChQuaternion<>& q) {
+    Write(q.data(), 4 * sizeof(double));
+}
+
+void ChCheckpointOut::Write(const ChVectorDynamic<>& vec) {
+    Write((uint64_t)vec.size());
+    Write(vec.data(), vec.size() * sizeof(double));
+}
+
+void ChCheckpointOut::BeginBlock() {
+    // Reserve space for the block size
+    m_blocks.push_back(m_data.size());
+    Write((uint64_t)0);
+}
+
+void ChCheckpointOut::EndBlock() {
+    assert(!m_blocks.empty());
+    size_t start = m_blocks.back();
+    m_blocks.pop_back();
+
+    uint64_t size = (uint64_t)(m_data.size() - start - sizeof(uint64_t));
+    std::memcpy(m_data.data() + start, &size, sizeof(uint64_t));
+}
+
+// -----------------------------------------------------------------------------
+
+ChCheckpointIn::ChCheckpointIn(const std::string& filename) : m_data(nullptr), m_size(0), m_pos(0) {
+#if !defined(_WIN32)
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0)
+        return;
+    struct stat st;
+    if (fstat(fd, &st) == 0 && st.st_size > 0) {
+        void* addr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+            m_data = static_cast<const char*>(addr);
+            m_size = (size_t)st.st_size;
+        }
+    }
+    close(fd);
+#else
+    std::ifstream stream(filename, std::ios::binary | std::ios::ate);
+    if (!stream.good())
+        return;
+    m_size = (size_t)stream.tellg();
+    m_buffer.resize(m_size);
+    stream.seekg(0);
+    if (m_size > 0 && stream.read(m_buffer.data(), m_size))
+        m_data = m_buffer.data();
+#endif
+}
+
+ChCheckpointIn::~ChCheckpointIn() {
+#if !defined(_WIN32)
+    if (m_data)
+        munmap(const_cast<char*>(m_data), m_size);
+#endif
+}
+
+const char* ChCheckpointIn::Map(size_t nbytes) {
+    size_t end = m_blocks.empty() ? m_size : m_blocks.back();
+    if (!m_data || nbytes > end - m_pos)
+        throw ChException("Checkpoint data inconsistent with the system (read past end of data)");
+    const char* ptr = m_data + m_pos;
+    m_pos += nbytes;
+    return ptr;
+}
+
+void ChCheckpointIn::Read(void* data, size_t nbytes) {
+    if (nbytes > 0)
+        std::memcpy(data, Map(nbytes), nbytes);
+}
+
+void ChCheckpointIn::Read(ChVector<>& v) {
+    double d[3];
+    Read(d, sizeof(d));
+    v = ChVector<>(d[0], d[1], d[2]);
+}
+
+void ChCheckpointIn::Read(ChQuaternion<>& q) {
+    double d[4];
+    Read(d, sizeof(d));
+    q = ChQuaternion<>(d[0], d[1], d[2], d[3]);
+}
+
+void ChCheckpointIn::Read(ChVectorDynamic<>& vec) {
+    uint64_t size;
+    Read(size);
+    CheckArraySize(size, sizeof(double));
+    vec.resize(size);
+    Read(vec.data(), size * sizeof(double));
+}
+
+void ChCheckpointIn::CheckArraySize(uint64_t size, size_t elem_size) const {
+    size_t end = m_blocks.empty() ? m_size : m_blocks.back();
+    if (elem_size > 0 && size > (end - m_pos) / elem_size)
+        throw ChException("Checkpoint data inconsistent with the system (array size past end of data)");
+}
+
+void ChCheckpointIn::BeginBlock() {
+    uint64_t size;
+    Read(size);
+    Map(size);  // check that the block fits in the enclosing one
+    m_pos -= size;
+    m_blocks.push_back(m_pos + size);
+}
+
+void ChCheckpointIn::EndBlock() {
+    assert(!m_blocks.empty());
+    if (m_pos != m_blocks.back())
+        throw ChException("Checkpoint data inconsistent with the system (block not consumed)");
+    m_blocks.pop_back();
+}
+
+}  // end namespace chrono
@@ -0,0 +1,163 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Binary checkpoint files, for saving and restoring the full state of a system.
+//
+// =============================================================================
+
+#ifndef CH_CHECKPOINT_H
+#define CH_CHECKPOINT_H
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrix.h"
+#include "chrono/core/ChQuaternion.h"
+
+namespace chrono {
+
+/// Writer for binary checkpoint files.
+/// Data is accumulated in memory as raw bytes and written to the file with a single operation when the writer is
+/// closed. The format is not portable across platforms or builds: a checkpoint is meant to be restored by the same
+/// program, into the same model. Groups of data (e.g., the internal state of a physics item) can be framed in blocks,
+/// which store their size so that a reader can verify that a block was consumed exactly.
+class ChApi ChCheckpointOut {
+  public:
+    /// Create the checkpoint file (check IsOpen() for success).
+    ChCheckpointOut(const std::string& filename);
+
+    /// Close the checkpoint file, if not already done.
+    ~ChCheckpointOut();
+
+    /// Return true if the checkpoint file was successfully created.
+    bool IsOpen() const { return m_stream.is_open(); }
+
+    /// Write all data to the checkpoint file and close it. Return true on success.
+    bool Close();
+
+    /// Write the specified number of bytes.
+    void Write(const void* data, size_t nbytes);
+
+    /// Write a single value of arithmetic type.
+    template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+    void Write(const T& val) {
+        Write(&val, sizeof(T));
+    }
+
+    /// Write a 3D vector.
+    void Write(const ChVector<>& v);
+
+    /// Write a quaternion.
+    void Write(const ChQuaternion<>& q);
+
+    /// Write a dynamic vector (size, followed by its elements).
+    void Write(const ChVectorDynamic<>& vec);
+
+    /// Write an array of trivially copyable elements (size, followed by its elements).
+    template <typename T>
+    void WriteArray(const std::vector<T>& vec) {
+        static_assert(std::is_trivially_copyable<T>::value, "ChCheckpointOut::WriteArray requires a POD type");
+        Write((uint64_t)vec.size());
+        Write(vec.data(), vec.size() * sizeof(T));
+    }
+
+    /// Start a block of data (blocks can be nested).
+    void BeginBlock();
+
+    /// End the current block of data.
+    void EndBlock();
+
+  private:
+    std::ofstream m_stream;
+    std::vector<char> m_data;      ///< data to be written
+    std::vector<size_t> m_blocks;  ///< start positions of the open blocks
+};
+
+/// Reader for binary checkpoint files.
+/// The file is memory-mapped (on platforms which support it; otherwise it is read in memory at once), so that large
+/// blocks of data are copied directly from the file mapping. Any attempt to read past the end of the file or of the
+/// current block, or a block which is not consumed exactly, throws a ChException.
+class ChApi ChCheckpointIn {
+  public:
+    /// Open and map the checkpoint file (check IsOpen() for success).
+    ChCheckpointIn(const std::string& filename);
+
+    ~ChCheckpointIn();
+
+    /// Return true if the checkpoint file was successfully opened.
+    bool IsOpen() const { return m_data != nullptr; }
+
+    /// Return the size of the checkpoint file.
+    size_t GetSize() const { return m_size; }
+
+    /// Return the current read position.
+    size_t GetPosition() const { return m_pos; }
+
+    /// Return a pointer to the next specified number of bytes in the file, and advance the read position.
+    const char* Map(size_t nbytes);
+
+    /// Read the specified number of bytes.
+    void Read(void* data, size_t nbytes);
+
+    /// Read a single value of arithmetic type.
+    template <typename T, typename std::enable_if<std::is_arithmetic<T>::value, int>::type = 0>
+    void Read(T& val) {
+        Read(&val, sizeof(T));
+    }
+
+    /// Read a 3D vector.
+    void Read(ChVector<>& v);
+
+    /// Read a quaternion.
+    void Read(ChQuaternion<>& q);
+
+    /// Read a dynamic vector (resized as needed).
+    void Read(ChVectorDynamic<>& vec);
+
+    /// Read an array of trivially copyable elements (resized as needed).
+    template <typename T>
+    void ReadArray(std::vector<T>& vec) {
+        static_assert(std::is_trivially_copyable<T>::value, "ChCheckpointIn::ReadArray requires a POD type");
+        uint64_t size;
+        Read(size);
+        CheckArraySize(size, sizeof(T));
+        vec.resize(size);
+        Read(vec.data(), size * sizeof(T));
+    }
+
+    /// Start reading a block of data.
+    void BeginBlock();
+
+    /// End reading the current block of data (the block must be consumed exactly).
+    void EndBlock();
+
+  private:
+    /// Check that an array of the given size and element size fits in the rest of the current block (or file).
+    /// This is checked before resizing the array, so that a corrupted size cannot trigger a huge allocation.
+    void CheckArraySize(uint64_t size, size_t elem_size) const;
+
+    const char* m_data;            ///< mapped file contents
+    size_t m_size;                 ///< size of the file
+    size_t m_pos;                  ///< current read position
+    std::vector<size_t> m_blocks;  ///< end positions of the open blocks
+    std::vector<char> m_buffer;    ///< file contents (if memory mapping not available)
+};
+
+}  // end namespace chrono
+
+#endif
@@ -15,12 +15,16 @@
 #ifndef CHCONSTRAINT_H
 #define CHCONSTRAINT_H
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChClassFactory.h"
 #include "chrono/core/ChMatrix.h"
 
 namespace chrono {
 
+class ChVariables;
+
 /// Modes for constraint
 enum eChConstraintMode {
     CONSTRAINT_FREE = 0,        ///< the constraint does not enforce anything
@@ -280,6 +284,12 @@ class ChApi ChConstraint {
     /// Same as Build_Cq, but puts the _transposed_ jacobian row as a column.
     virtual void Build_CqT(ChSparseMatrix& storage, int inscol) = 0;
 
+    /// Append to 'vars' the ChVariables objects referenced by this constraint.
+    /// This connectivity information is used by solvers that process independent constraints in parallel (e.g.
+    /// ChSolverPSOR in parallel sweep mode). The default implementation does nothing, meaning that the connectivity is
+    /// unknown and the constraint will always be processed serially.
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) const {}
+
     /// Set offset in global q vector (set automatically by ChSystemDescriptor)
     void SetOffset(int moff) { offset = moff; }
 
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChConstraintColoring.h"
+
+namespace chrono {
+
+template <typename VarsFunction>
+void ChConstraintColoring::ColorBlocks(VarsFunction vars) {
+    // Greedy coloring. Inactive variables (e.g., fixed bodies) are never written by the solver, so they do not
+    // introduce dependencies between blocks.
+    const size_t nBlocks = m_unsorted.size();
+    std::fill(m_masks.begin(), m_masks.end(), 0);
+    m_colors.resize(nBlocks);
+
+    std::vector<unsigned int> count(MAX_COLORS + 1, 0);
+
+    for (size_t ib = 0; ib < nBlocks; ib++) {
+        const Block& block = m_unsorted[ib];
+        m_vars.clear();
+        vars(block, m_vars);
+
+        int color = -1;
+
+        if (!m_vars.empty()) {
+            uint64_t used = 0;
+            for (auto var : m_vars) {
+                if (!var || !var->IsActive())
+                    continue;
+                unsigned int id = var->GetOffset();
+                if (id >= m_masks.size())
+                    m_masks.resize(id + 1, 0);
+                used |= m_masks[id];
+            }
+
+            for (int c = 0; c < MAX_COLORS; c++) {
+                if (!(used & (uint64_t(1) << c))) {
+                    color = c;
+                    break;
+                }
+            }
+
+            if (color >= 0) {
+                for (auto var : m_vars) {
+                    if (var && var->IsActive())
+                        m_masks[var->GetOffset()] |= (uint64_t(1) << color);
+                }
+            }
+        }
+
+        m_colors[ib] = color;
+        count[color >= 0 ? color : MAX_COLORS]++;
+    }
+
+    // Sort blocks by color (counting sort, stable w.r.t. the original order).
+    // Serial blocks are placed at the end.
+    int nColors = 0;
+    for (int c = 0; c < MAX_COLORS; c++) {
+        if (count[c] > 0)
+            nColors = c + 1;
+    }
+
+    m_color_start.assign(nColors + 1, 0);
+    std::vector<unsigned int> pos(MAX_COLORS + 1, 0);
+    unsigned int offset = 0;
+    for (int c = 0; c < nColors; c++) {
+        m_color_start[c] = offset;
+        pos[c] = offset;
+        offset += count[c];
+    }
+    m_color_start[nColors] = offset;
+    pos[MAX_COLORS] = offset;
+
+    m_blocks.resize(nBlocks);
+    for (size_t ib = 0; ib < nBlocks; ib++) {
+        int c = m_colors[ib] >= 0 ? m_colors[ib] : MAX_COLORS;
+        m_blocks[pos[c]++] = m_unsorted[ib];
+    }
+}
+
+void ChConstraintColoring::Build(const std::vector<ChConstraint*>& constraints) {
+    const unsigned int nConstr = (unsigned int)constraints.size();
+
+    // 1) Group active constraints into blocks (contact triplets N,U,V are consecutive in the list)
+    m_unsorted.clear();
+    for (unsigned int ic = 0; ic < nConstr; ic++) {
+        if (!constraints[ic]->IsActive())
+            continue;
+        if (constraints[ic]->GetMode() == CONSTRAINT_FRIC && ic + 2 < nConstr) {
+            m_unsorted.push_back({ic, 3});
+            ic += 2;
+        } else {
+            m_unsorted.push_back({ic, 1});
+        }
+    }
+
+    // 2) Coloring of the constraint blocks
+    ColorBlocks([&](const Block& block, std::vector<ChVariables*>& vars) {
+        for (unsigned int k = 0; k < block.size; k++)
+            constraints[block.start + k]->AppendVariables(vars);
+    });
+}
+
+void ChConstraintColoring::Build(const std::vector<ChKblock*>& kblocks) {
+    const unsigned int nKblocks = (unsigned int)kblocks.size();
+
+    // 1) One block per stiffness block
+    m_unsorted.resize(nKblocks);
+    for (unsigned int ik = 0; ik < nKblocks; ik++)
+        m_unsorted[ik] = {ik, 1};
+
+    // 2) Coloring of the stiffness blocks
+    ColorBlocks(
+        [&](const Block& block, std::vector<ChVariables*>& vars) { kblocks[block.start]->AppendVariables(vars); });
+}
+
+}  // end namespace chrono
@@ -0,0 +1,97 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHCONSTRAINTCOLORING_H
+#define CHCONSTRAINTCOLORING_H
+
+#include <cstdint>
+#include <vector>
+
+#include "chrono/solver/ChConstraint.h"
+#include "chrono/solver/ChKblock.h"
+#include "chrono/solver/ChVariables.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Partition of a list of constraints into independent color classes.
+/// Constraints are first grouped into blocks, each being either a single constraint or the N,U,V triplet of a
+/// frictional contact. A greedy graph coloring then assigns different colors to any two blocks that act on a common
+/// active ChVariables object, so that all blocks within a color class can be processed concurrently by a
+/// Gauss-Seidel-like solver without races on the 'q' vector.
+/// Blocks with unknown connectivity (see ChConstraint::AppendVariables) and blocks that cannot be colored within the
+/// maximum number of colors are collected into a separate class, which must be processed serially.
+/// The same coloring can be applied to a list of stiffness blocks (ChKblock), each forming its own block, for the
+/// parallel assembly of the system matrix.
+class ChApi ChConstraintColoring {
+  public:
+    /// A group of consecutive constraints updated together (or a single stiffness block).
+    struct Block {
+        unsigned int start;  ///< index of the first constraint (or of the stiffness block) in the block
+        unsigned int size;   ///< number of constraints in the block (1, or 3 for a contact triplet)
+    };
+
+    ChConstraintColoring() {}
+
+    /// Build the constraint blocks and their coloring for the given list of constraints.
+    /// Only active constraints are included. The offsets of the ChVariables objects must be up-to-date.
+    void Build(const std::vector<ChConstraint*>& constraints);
+
+    /// Build the coloring for the given list of stiffness blocks (one block per ChKblock).
+    /// The offsets of the ChVariables objects must be up-to-date.
+    void Build(const std::vector<ChKblock*>& kblocks);
+
+    /// Return the number of color classes (not including the serial class).
+    int GetNumColors() const { return (int)m_color_start.size() - 1; }
+
+    /// Return the index of the first block in the specified color class.
+    unsigned int GetColorStart(int color) const { return m_color_start[color]; }
+
+    /// Return the index past the last block in the specified color class.
+    unsigned int GetColorEnd(int color) const { return m_color_start[color + 1]; }
+
+    /// Return the index of the first block that must be processed serially.
+    /// The serial blocks extend to the end of the block list.
+    unsigned int GetSerialStart() const { return m_color_start.back(); }
+
+    /// Return the total number of blocks.
+    unsigned int GetNumBlocks() const { return (unsigned int)m_blocks.size(); }
+
+    /// Access the list of blocks, sorted by color class.
+    const std::vector<Block>& GetBlocks() const { return m_blocks; }
+
+  private:
+    static const int MAX_COLORS = 64;
+
+    /// Greedy coloring of the blocks in m_unsorted and sorting by color.
+    /// The function 'vars' must append the variables of a given block to the provided list.
+    template <typename VarsFunction>
+    void ColorBlocks(VarsFunction vars);
+
+    std::vector<Block> m_blocks;              ///< constraint blocks, sorted by color
+    std::vector<unsigned int> m_color_start;  ///< start of each color class in m_blocks (plus start of serial blocks)
+
+    std::vector<uint64_t> m_masks;       ///< per-DOF-offset bitmask of colors already in use
+    std::vector<int> m_colors;           ///< color of each unsorted block (-1 for serial)
+    std::vector<Block> m_unsorted;       ///< blocks in constraint order
+    std::vector<ChVariables*> m_vars;    ///< scratch list of variables of current block
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
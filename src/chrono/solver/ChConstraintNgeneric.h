@@ -60,6 +60,11 @@ class ChApi ChConstraintNgeneric : public ChConstraint {
     /// automatically creating/resizing jacobians if needed.
     void SetVariables(std::vector<ChVariables*> mvars);
 
+    /// Append all constrained variable objects to 'vars'.
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) const override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+    }
+
     /// This function updates the following auxiliary data:
     ///  - the Eq  matrices
     ///  - the g_i product
@@ -12,6 +12,8 @@
 // Authors: Radu Serban
 // =============================================================================
 
+#include <algorithm>
+
 #include "chrono/solver/ChDirectSolverLS.h"
 #include "chrono/core/ChSparsityPatternLearner.h"
 
@@ -23,6 +25,7 @@ ChDirectSolverLS::ChDirectSolverLS()
     : m_lock(false),
       m_use_learner(true),
       m_force_update(true),
+      m_parallel_assembly(false),
       m_null_pivot_detection(false),
       m_use_rhs_sparsity(false),
       m_use_perm(false),
@@ -30,7 +33,14 @@ ChDirectSolverLS::ChDirectSolverLS()
       m_dim(0),
       m_sparsity(-1),
       m_solve_call(0),
-      m_setup_call(0) {}
+      m_setup_call(0),
+      m_reuse_symbolic(true),
+      m_analyze(true),
+      m_factorized(false),
+      m_max_reuse(0),
+      m_num_reuse(0),
+      m_analyze_call(0),
+      m_factorize_call(0) {}
 
 void ChDirectSolverLS::ResetTimers() {
     m_timer_setup_assembly.reset();
@@ -44,7 +54,22 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 
     // Calculate problem size.
     // Note that ChSystemDescriptor::UpdateCountsAndOffsets was already called at the beginning of the step.
-    m_dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
+    int dim = sysd.CountActiveVariables() + sysd.CountActiveConstraints();
+
+    // Reuse the current factorization if so requested and if the problem size did not change.
+    // In this case, there is no need to assemble the matrix either.
+    if (m_factorized && dim == m_dim && m_num_reuse < m_max_reuse) {
+        m_num_reuse++;
+        m_timer_setup_assembly.stop();
+        if (verbose) {
+            GetLog() << " Solver setup [" << m_setup_call << "] reuse factorization (" << m_num_reuse << "/"
+                     << m_max_reuse << ")\n";
+        }
+        m_setup_call++;
+        return true;
+    }
+
+    m_dim = dim;
 
     // If use of the sparsity pattern learner is enabled, call it if:
     // (a) an explicit update was requested (by default this is true at the first call), or
@@ -77,8 +102,13 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
         m_mat.reserve(Eigen::VectorXi::Constant(m_dim, static_cast<int>(m_dim * density)));
     }
 
-    // Let the system descriptor load the current matrix
-    sysd.ConvertToMatrixForm(&m_mat, nullptr);
+    // Let the system descriptor load the current matrix.
+    // If parallel assembly is enabled and the sparsity pattern was just learned, storage is reserved for all nonzeros
+    // and the matrix can be assembled in parallel.
+    if (call_learner && m_parallel_assembly && sysd.GetNumThreads() > 1)
+        sysd.ConvertToMatrixFormParallel(m_mat);
+    else
+        sysd.ConvertToMatrixForm(&m_mat, nullptr);
 
     // Allow the matrix to be compressed
     m_mat.makeCompressed();
@@ -90,7 +120,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 
     // Let the concrete solver perform the facorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = Factorize();
     m_timer_setup_solvercall.stop();
 
     if (write_matrix)
@@ -98,7 +128,7 @@ bool ChDirectSolverLS::Setup(ChSystemDescriptor& sysd) {
 
     if (verbose) {
         GetLog() << " Solver setup [" << m_setup_call << "] n = " << m_dim << "  nnz = " << (int)m_mat.nonZeros()
-                 << "\n";
+                 << "  analyze? " << m_analyze << "\n";
         GetLog() << "  assembly matrix:   " << m_timer_setup_assembly.GetTimeSecondsIntermediate() << "s\n"
                  << "  analyze+factorize: " << m_timer_setup_solvercall.GetTimeSecondsIntermediate() << "s\n";
     }
@@ -163,7 +193,7 @@ bool ChDirectSolverLS::SetupCurrent() {
 
     // Let the concrete solver perform the factorization
     m_timer_setup_solvercall.start();
-    bool result = FactorizeMatrix();
+    bool result = Factorize();
     m_timer_setup_solvercall.stop();
 
     if (verbose) {
@@ -210,6 +240,37 @@ double ChDirectSolverLS::SolveCurrent() {
     return result;
 }
 
+bool ChDirectSolverLS::Factorize() {
+    // Compare the sparsity pattern of the (compressed) matrix with the pattern at the last factorization
+    const int* outer = m_mat.outerIndexPtr();
+    const int* inner = m_mat.innerIndexPtr();
+    const int nrows = (int)m_mat.rows();
+    const int nnz = (int)m_mat.nonZeros();
+
+    bool same_pattern = m_mat.cols() == nrows && m_pattern_outer.size() == (size_t)nrows + 1 &&
+                        m_pattern_inner.size() == (size_t)nnz &&
+                        std::equal(outer, outer + nrows + 1, m_pattern_outer.begin()) &&
+                        std::equal(inner, inner + nnz, m_pattern_inner.begin());
+
+    // The symbolic analysis must be redone if reuse is disabled, if there is no valid factorization, or if the
+    // sparsity pattern changed
+    m_analyze = !m_reuse_symbolic || !m_factorized || !same_pattern;
+    if (!same_pattern) {
+        m_pattern_outer.assign(outer, outer + nrows + 1);
+        m_pattern_inner.assign(inner, inner + nnz);
+    }
+
+    bool result = FactorizeMatrix();
+
+    if (m_analyze)
+        m_analyze_call++;
+    m_factorize_call++;
+    m_factorized = result;
+    m_num_reuse = 0;
+
+    return result;
+}
+
 // ---------------------------------------------------------------------------
 
 void ChDirectSolverLS::WriteMatrix(const std::string& filename, const ChSparseMatrix& M) {
@@ -265,7 +326,9 @@ void ChDirectSolverLS::ArchiveIN(ChArchiveIn& marchive) {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseLU::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    if (m_analyze)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -294,7 +357,9 @@ void ChSolverSparseLU::PrintErrorMessage() {
 // ---------------------------------------------------------------------------
 
 bool ChSolverSparseQR::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    if (m_analyze)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
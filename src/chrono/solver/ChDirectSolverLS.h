@@ -19,6 +19,8 @@
 #include "chrono/core/ChTimer.h"
 #include "chrono/solver/ChSolverLS.h"
 
+#include <vector>
+
 #include <Eigen/SparseLU>
 
 namespace chrono {
@@ -56,6 +58,15 @@ to a fully dense matrix). This value is used if the sparsity pattern learner is
 space for matrix indices and nonzeros.
 See #SetSparsityEstimate();
 
+In addition, ChDirectSolverLS tracks changes in the nonzero structure of the problem matrix. If the sparsity pattern did
+not change since the last factorization, concrete solvers which support it reuse their symbolic analysis (fill-reducing
+ordering, elimination tree) and only perform the numeric factorization.\n
+See #ReuseSymbolicFactorization();
+
+Optionally, the numeric factorization itself can be reused for a number of subsequent calls to Setup (e.g., for a
+modified Newton scheme where the Jacobian is only updated every few iterations).\n
+See #SetFactorizationReuse();
+
 <br>
 
 <div class="ce-warning">
@@ -92,10 +103,29 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// or structure occurred. This function has no effect if the sparsity pattern learner is disabled.
     void ForceSparsityPatternUpdate() { m_force_update = true; }
 
+    /// Enable/disable parallel assembly of the problem matrix (default: false).\n
+    /// If enabled, the matrix is assembled with ChSystemDescriptor::ConvertToMatrixFormParallel, using the number of
+    /// threads set in the system descriptor, whenever the sparsity pattern learner was just called (so that storage
+    /// for all nonzeros is already reserved). Otherwise, the matrix is assembled serially.
+    void UseParallelAssembly(bool val) { m_parallel_assembly = val; }
+
     /// Set estimate for matrix sparsity, a value in [0,1], with 0 indicating a fully dense matrix (default: 0.9).\n
     /// Only used if the sparsity pattern learner is disabled.
     void SetSparsityEstimate(double sparsity) { m_sparsity = sparsity; }
 
+    /// Enable/disable reuse of the symbolic factorization (default: true).\n
+    /// If enabled, the matrix sparsity pattern is compared at each call to Setup with the pattern at the last
+    /// factorization and, if they are identical, the analysis phase (reordering and symbolic factorization) is
+    /// skipped and only the numeric factorization is performed.
+    /// A concrete direct sparse solver may or may not support this feature.
+    void ReuseSymbolicFactorization(bool val) { m_reuse_symbolic = val; }
+
+    /// Set the number of subsequent Setup calls which reuse the current numeric factorization (default: 0).\n
+    /// With a value n > 0, the problem matrix is assembled and factorized at one call to Setup and the resulting
+    /// factorization is then used, unchanged, for the next n calls (modified Newton). A new factorization is always
+    /// performed if the problem size changes.
+    void SetFactorizationReuse(int n) { m_max_reuse = n; }
+
     /// Set the matrix symmetry type (default: GENERAL).
     virtual void SetMatrixSymmetryType(MatrixSymmetryType symmetry) { m_symmetry = symmetry; }
 
@@ -127,6 +157,10 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     int GetNumSetupCalls() const { return m_setup_call; }
     /// Return the number of calls to the solver's Setup function.
     int GetNumSolveCalls() const { return m_solve_call; }
+    /// Return the number of symbolic analyses performed (i.e., factorizations with a new sparsity pattern).
+    int GetNumAnalyzeCalls() const { return m_analyze_call; }
+    /// Return the number of numeric factorizations performed.
+    int GetNumFactorizeCalls() const { return m_factorize_call; }
 
     /// Get a handle to the underlying matrix.
     ChSparseMatrix& GetMatrix() { return m_mat; }
@@ -173,6 +207,8 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     ChDirectSolverLS();
 
     /// Factorize the current sparse matrix and return true if successful.
+    /// If #m_analyze is false, the sparsity pattern is unchanged since the last successful factorization and the
+    /// concrete solver can reuse its symbolic analysis.
     virtual bool FactorizeMatrix() = 0;
 
     /// Solve the linear system using the current factorization and right-hand side vector.
@@ -183,6 +219,10 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     /// This function is only called if Factorize or Solve returned false.
     virtual void PrintErrorMessage() = 0;
 
+    /// Compare the current matrix sparsity pattern with the last factorized one, factorize the matrix, and update
+    /// counters.
+    bool Factorize();
+
     /// Indicate whether or not the #Solve() phase requires an up-to-date problem matrix.
     /// Typically, direct solvers only require the matrix for their #Setup() phase.
     virtual bool SolveRequiresMatrix() const override { return false; }
@@ -201,10 +241,22 @@ class ChApi ChDirectSolverLS : public ChSolverLS {
     bool m_use_learner;   ///< use the sparsity pattern learner?
     bool m_force_update;  ///< force a call to the sparsity pattern learner?
 
+    bool m_parallel_assembly;  ///< assemble the matrix in parallel after a call to the sparsity pattern learner?
+
     bool m_use_perm;              ///< use of the permutation vector?
     bool m_use_rhs_sparsity;      ///< leverage right-hand side sparsity?
     bool m_null_pivot_detection;  ///< enable detection of zero pivots?
 
+    bool m_reuse_symbolic;  ///< reuse symbolic analysis if the sparsity pattern is unchanged?
+    bool m_analyze;         ///< must the concrete solver perform the symbolic analysis at this factorization?
+    bool m_factorized;      ///< is there a valid factorization?
+    std::vector<int> m_pattern_outer;  ///< outer (row start) indices of the matrix at the last factorization
+    std::vector<int> m_pattern_inner;  ///< inner (column) indices of the matrix at the last factorization
+    int m_max_reuse;        ///< number of Setup calls for which a numeric factorization can be reused
+    int m_num_reuse;        ///< number of Setup calls for which the current factorization was reused
+    int m_analyze_call;     ///< counter for symbolic analyses
+    int m_factorize_call;   ///< counter for numeric factorizations
+
     ChTimer m_timer_setup_assembly;    ///< timer for matrix assembly
     ChTimer m_timer_setup_solvercall;  ///< timer for factorization
     ChTimer m_timer_solve_assembly;    ///< timer for RHS assembly
@@ -13,6 +13,7 @@
 // =============================================================================
 
 #include "chrono/solver/ChIterativeSolverVI.h"
+#include "chrono/core/ChMathematics.h"
 
 namespace chrono {
 
@@ -48,6 +49,95 @@ void ChIterativeSolverVI::AtIterationEnd(double mmaxviolation, double mdeltalamb
     dlambda_history.push_back(mdeltalambda);
 }
 
+double ChIterativeSolverVI::ProjectedBlockUpdate(ChConstraint** block, unsigned int size, double& maxdeltalambda) {
+    double old_lambda[3];
+    double violation = 0;
+
+    // compute the residuals  c_i = [Cq_i]*q + b_i + cfm_i*l_i  and the unprojected updates of all block multipliers
+    for (unsigned int k = 0; k < size; k++) {
+        double mresidual = block[k]->Compute_Cq_q() + block[k]->Get_b_i() + block[k]->Get_cfm_i() * block[k]->Get_l_i();
+
+        if (size == 3) {
+            // contact triplet: only the normal component contributes to the violation
+            if (k == 0)
+                violation = fabs(ChMin(0.0, mresidual));
+        } else {
+            violation = fabs(block[k]->Violation(mresidual));
+        }
+
+        // delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+        double deltal = (m_omega / block[k]->Get_g_i()) * (-mresidual);
+        old_lambda[k] = block[k]->Get_l_i();
+        block[k]->Set_l_i(old_lambda[k] + deltal);
+    }
+
+    // project onto the admissible set (for a triplet, the N normal component will take care of N,U,V)
+    block[0]->Project();
+
+    for (unsigned int k = 0; k < size; k++) {
+        double new_lambda = block[k]->Get_l_i();
+
+        // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+        if (m_shlambda != 1.0) {
+            new_lambda = m_shlambda * new_lambda + (1.0 - m_shlambda) * old_lambda[k];
+            block[k]->Set_l_i(new_lambda);
+        }
+
+        double true_delta = new_lambda - old_lambda[k];
+        block[k]->Increment_q(true_delta);
+
+        if (record_violation_history)
+            maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta));
+    }
+
+    return violation;
+}
+
+double ChIterativeSolverVI::ColoredSweep(std::vector<ChConstraint*>& constraints,
+                                         const ChConstraintColoring& coloring,
+                                         int nthreads,
+                                         bool backward,
+                                         double& maxdeltalambda) {
+    const std::vector<ChConstraintColoring::Block>& blocks = coloring.GetBlocks();
+    const int nColors = coloring.GetNumColors();
+
+    double maxviolation = 0;
+
+    for (int ic = 0; ic < nColors; ic++) {
+        int color = backward ? nColors - 1 - ic : ic;
+        int start = (int)coloring.GetColorStart(color);
+        int end = (int)coloring.GetColorEnd(color);
+
+        // Blocks in the same color class do not share any active variables, so they can be updated concurrently
+#pragma omp parallel num_threads(nthreads)
+        {
+            double thread_violation = 0;
+            double thread_deltalambda = 0;
+
+#pragma omp for schedule(static)
+            for (int ib = start; ib < end; ib++) {
+                double violation = ProjectedBlockUpdate(&constraints[blocks[ib].start], blocks[ib].size,
+                                                        thread_deltalambda);
+                thread_violation = ChMax(thread_violation, violation);
+            }
+
+#pragma omp critical
+            {
+                maxviolation = ChMax(maxviolation, thread_violation);
+                maxdeltalambda = ChMax(maxdeltalambda, thread_deltalambda);
+            }
+        }
+    }
+
+    // Blocks that could not be colored
+    for (unsigned int ib = coloring.GetSerialStart(); ib < coloring.GetNumBlocks(); ib++) {
+        double violation = ProjectedBlockUpdate(&constraints[blocks[ib].start], blocks[ib].size, maxdeltalambda);
+        maxviolation = ChMax(maxviolation, violation);
+    }
+
+    return maxviolation;
+}
+
 void ChIterativeSolverVI::ArchiveOUT(ChArchiveOut& marchive) {
     // version number
     marchive.VersionWrite<ChIterativeSolverVI>();
@@ -17,6 +17,7 @@
 
 #include "chrono/solver/ChSolverVI.h"
 #include "chrono/solver/ChIterativeSolver.h"
+#include "chrono/solver/ChConstraintColoring.h"
 
 namespace chrono {
 
@@ -97,6 +98,21 @@ class ChApi ChIterativeSolverVI : public ChIterativeSolver, public ChSolverVI {
     /// Note: 'iternum' starts at 0 for the first iteration.
     void AtIterationEnd(double mmaxviolation, double mdeltalambda, unsigned int iternum);
 
+    /// Perform a projected SOR update of one block of constraints (a single constraint or a N,U,V contact triplet)
+    /// and apply the resulting change in multipliers to the 'q' vector.
+    /// Return the constraint violation of the block and update 'maxdeltalambda' with the largest multiplier change.
+    double ProjectedBlockUpdate(ChConstraint** block, unsigned int size, double& maxdeltalambda);
+
+    /// Perform one projected SOR sweep over all constraints, processing the blocks within each color class of the
+    /// given coloring concurrently, on the specified number of threads. Blocks in the serial class are processed last.
+    /// If 'backward' is true, the color classes are visited in reverse order (for symmetric SOR).
+    /// Return the maximum constraint violation and update 'maxdeltalambda' with the largest multiplier change.
+    double ColoredSweep(std::vector<ChConstraint*>& constraints,
+                        const ChConstraintColoring& coloring,
+                        int nthreads,
+                        bool backward,
+                        double& maxdeltalambda);
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
 
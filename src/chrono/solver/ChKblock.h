@@ -15,8 +15,11 @@
 #ifndef CHKBLOCK_H
 #define CHKBLOCK_H
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/solver/ChVariables.h"
 
 namespace chrono {
 
@@ -53,6 +56,12 @@ class ChApi ChKblock {
     /// variables. Most solvers do not need this: the sparse 'storage' matrix is used for testing, for direct solvers,
     /// for dumping full matrix to Matlab for checks, etc.
     virtual void Build_K(ChSparseMatrix& storage, bool add = true) = 0;
+
+    /// Append to 'vars' the ChVariables objects referenced by this block.
+    /// This connectivity information is used to assemble independent K blocks in parallel (see
+    /// ChSystemDescriptor::ConvertToMatrixFormParallel). The default implementation does nothing, meaning that the
+    /// connectivity is unknown and the block will always be assembled serially.
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) const {}
 };
 
 }  // end namespace chrono
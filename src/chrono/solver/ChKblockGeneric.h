@@ -54,6 +54,11 @@ class ChApi ChKblockGeneric : public ChKblock {
     /// Access the m-th vector variable object
     ChVariables* GetVariableN(unsigned int m_var) const { return variables[m_var]; }
 
+    /// Append the referenced variable objects to 'vars'.
+    virtual void AppendVariables(std::vector<ChVariables*>& vars) const override {
+        vars.insert(vars.end(), variables.begin(), variables.end());
+    }
+
     /// Access the K stiffness matrix as a single block,
     /// referring only to the referenced ChVariable objects
     virtual ChMatrixRef Get_K() override { return K; }
@@ -84,6 +84,9 @@ double ChSolverAPGD::Solve(ChSystemDescriptor& sysd) {
     for (unsigned int ic = 0; ic < mconstraints.size(); ic++)
         mconstraints[ic]->Update_auxiliary();
 
+    // Pack constraints and variables in the compiled representation, if enabled
+    sysd.Compile();
+
     double L, t;
     double theta;
     double thetaNew;
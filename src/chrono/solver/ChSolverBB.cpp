@@ -31,6 +31,9 @@ double ChSolverBB::Solve(ChSystemDescriptor& sysd) {
         throw ChException("ChSolverBB: Do NOT use Barzilai-Borwein solver if there are stiffness matrices.");
     }
 
+    // Pack constraints and variables in the compiled representation, if enabled
+    sysd.Compile();
+
     // Tuning of the spectral gradient search
     double a_min = 1e-13;
     double a_max = 1e13;
@@ -34,6 +34,9 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
     if (sysd.GetKblocksList().size() > 0)
         return this->Solve_SupportingStiffness(sysd);
 
+    // Pack constraints and variables in the compiled representation, if enabled
+    sysd.Compile();
+
     // Allocate auxiliary vectors;
 
     int nc = sysd.CountActiveConstraints();
@@ -285,6 +288,9 @@ double ChSolverPMINRES::Solve(ChSystemDescriptor& sysd) {
 double ChSolverPMINRES::Solve_SupportingStiffness(ChSystemDescriptor& sysd) {
     m_iterations = 0;
 
+    // Pack constraints and variables in the compiled representation, if enabled
+    sysd.Compile();
+
     // Allocate auxiliary vectors;
 
     int nv = sysd.CountActiveVariables();
@@ -20,7 +20,7 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverPSOR)
 
-ChSolverPSOR::ChSolverPSOR() : maxviolation(0) {}
+ChSolverPSOR::ChSolverPSOR() : maxviolation(0), m_parallel_sweep(false) {}
 
 double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
@@ -78,6 +78,10 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
     // 4)  Perform the iteration loops
     //
 
+    // In parallel sweep mode, partition the constraints in independent color classes
+    if (m_parallel_sweep)
+        m_coloring.Build(mconstraints);
+
     for (int iter = 0; iter < m_max_iterations; iter++) {
         // The iteration on all constraints
         //
@@ -86,6 +90,20 @@ double ChSolverPSOR::Solve(ChSystemDescriptor& sysd) {
         maxdeltalambda = 0;
         i_friction_comp = 0;
 
+        if (m_parallel_sweep) {
+            maxviolation = ColoredSweep(mconstraints, m_coloring, sysd.GetNumThreads(), false, maxdeltalambda);
+
+            if (this->record_violation_history)
+                AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+            m_iterations++;
+
+            if (maxviolation < m_tolerance)
+                break;
+
+            continue;
+        }
+
         for (unsigned int ic = 0; ic < mconstraints.size(); ic++) {
             // skip computations if constraint not active.
             if (mconstraints[ic]->IsActive()) {
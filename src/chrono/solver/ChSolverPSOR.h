@@ -44,8 +44,20 @@ class ChApi ChSolverPSOR : public ChIterativeSolverVI {
     /// For the PSOR solver, this is the maximum constraint violation.
     virtual double GetError() const override { return maxviolation; }
 
+    /// Enable/disable the parallel sweep mode (default: false).
+    /// If enabled, constraints are partitioned in color classes such that no two constraints in a class act on the
+    /// same variables (see ChConstraintColoring); the constraints within a class are then processed concurrently,
+    /// using the number of threads set in the system descriptor (see ChSystem::SetNumThreads). Note that the order in
+    /// which constraints are visited differs from the serial sweep, so results are not identical.
+    void EnableParallelSweep(bool val) { m_parallel_sweep = val; }
+
+    /// Return true if the parallel sweep mode is enabled.
+    bool IsParallelSweep() const { return m_parallel_sweep; }
+
   private:
     double maxviolation;
+    bool m_parallel_sweep;
+    ChConstraintColoring m_coloring;
 };
 
 /// @} chrono_solver
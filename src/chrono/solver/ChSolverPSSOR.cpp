@@ -20,7 +20,7 @@ namespace chrono {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChSolverPSSOR)
 
-ChSolverPSSOR::ChSolverPSSOR() : maxviolation(0) {}
+ChSolverPSSOR::ChSolverPSSOR() : maxviolation(0), m_parallel_sweep(false) {}
 
 double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
@@ -74,7 +74,32 @@ double ChSolverPSSOR::Solve(ChSystemDescriptor& sysd) {
     }
 
     // 4)  Perform the iteration loops
+
+    // In parallel sweep mode, partition the constraints in independent color classes
+    if (m_parallel_sweep)
+        m_coloring.Build(mconstraints);
+
     for (int iter = 0; iter < m_max_iterations;) {
+        if (m_parallel_sweep) {
+            // Forward and backward sweeps over the color classes
+            maxdeltalambda = 0;
+            maxviolation = ColoredSweep(mconstraints, m_coloring, sysd.GetNumThreads(), false, maxdeltalambda);
+            if (this->record_violation_history)
+                AtIterationEnd(maxviolation, maxdeltalambda, iter);
+            iter++;
+
+            maxdeltalambda = 0;
+            maxviolation = ColoredSweep(mconstraints, m_coloring, sysd.GetNumThreads(), true, maxdeltalambda);
+            if (this->record_violation_history)
+                AtIterationEnd(maxviolation, maxdeltalambda, iter);
+
+            if (maxviolation < m_tolerance)
+                break;
+
+            iter++;
+            continue;
+        }
+
         //
         // Forward sweep, for symmetric SOR
         //
@@ -16,6 +16,7 @@
 #include "chrono/solver/ChConstraintTwoTuplesContactN.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/core/ChSparsityPatternLearner.h"
 
 namespace chrono {
 
@@ -25,7 +26,15 @@ CH_FACTORY_REGISTER(ChSystemDescriptor)
 
 #define CH_SPINLOCK_HASHSIZE 203
 
-ChSystemDescriptor::ChSystemDescriptor() : n_q(0), n_c(0), c_a(1.0), freeze_count(false) {
+ChSystemDescriptor::ChSystemDescriptor()
+    : n_q(0),
+      n_c(0),
+      c_a(1.0),
+      freeze_count(false),
+      num_threads(1),
+      use_compiled(false),
+      compiled_shur(false),
+      compiled_system(false) {
     vconstraints.clear();
     vvariables.clear();
     vstiffness.clear();
@@ -270,6 +279,84 @@ void ChSystemDescriptor::ConvertToMatrixForm(ChSparseMatrix* Z, ChVectorDynamic<
     }
 }
 
+void ChSystemDescriptor::ConvertToMatrixFormParallel(ChSparseMatrix& Z) {
+    // Count active variables and constraints, and set offsets
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+
+    Z.conservativeResize(n_q + n_c, n_q + n_c);
+    Z.setZeroValues();
+
+    const int nv = (int)vvariables.size();
+    const int nc = (int)vconstraints.size();
+
+    // Masses and inertias in upper-left block of Z.
+    // Each variable writes to its own rows.
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+    for (int iv = 0; iv < nv; iv++) {
+        if (vvariables[iv]->IsActive()) {
+            int offset = vvariables[iv]->GetOffset();
+            vvariables[iv]->Build_M(Z, offset, offset, c_a);
+        }
+    }
+
+    // If present, add stiffness matrix K to upper-left block of Z.
+    // K blocks within a color class write to disjoint rows.
+    if (!vstiffness.empty()) {
+        assembly_kcoloring.Build(vstiffness);
+        const auto& blocks = assembly_kcoloring.GetBlocks();
+        for (int c = 0; c < assembly_kcoloring.GetNumColors(); c++) {
+            const int kstart = (int)assembly_kcoloring.GetColorStart(c);
+            const int kend = (int)assembly_kcoloring.GetColorEnd(c);
+#pragma omp parallel for schedule(dynamic, 16) num_threads(num_threads)
+            for (int ib = kstart; ib < kend; ib++) {
+                vstiffness[blocks[ib].start]->Build_K(Z, true);
+            }
+        }
+        for (unsigned int ib = assembly_kcoloring.GetSerialStart(); ib < assembly_kcoloring.GetNumBlocks(); ib++) {
+            vstiffness[blocks[ib].start]->Build_K(Z, true);
+        }
+    }
+
+    // Constraint Jacobians in lower-left block of Z and E ( = cfm ) in lower-right block of Z.
+    // Each constraint writes to its own row.
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+    for (int ic = 0; ic < nc; ic++) {
+        if (vconstraints[ic]->IsActive()) {
+            int row = n_q + vconstraints[ic]->GetOffset();
+            vconstraints[ic]->Build_Cq(Z, row);
+            Z.SetElement(row, row, vconstraints[ic]->Get_cfm_i());
+        }
+    }
+
+    // Transposed constraint Jacobians in upper-right block of Z.
+    // Constraints write to the rows of their variables, so constraints within a color class write to disjoint rows.
+    if (nc > 0) {
+        assembly_coloring.Build(vconstraints);
+        const auto& blocks = assembly_coloring.GetBlocks();
+        const int ncolors = assembly_coloring.GetNumColors();
+        for (int c = 0; c < ncolors; c++) {
+            const int bstart = (int)assembly_coloring.GetColorStart(c);
+            const int bend = (int)assembly_coloring.GetColorEnd(c);
+#pragma omp parallel for schedule(dynamic, 64) num_threads(num_threads)
+            for (int ib = bstart; ib < bend; ib++) {
+                for (unsigned int k = 0; k < blocks[ib].size; k++) {
+                    ChConstraint* constraint = vconstraints[blocks[ib].start + k];
+                    if (constraint->IsActive())
+                        constraint->Build_CqT(Z, n_q + constraint->GetOffset());
+                }
+            }
+        }
+        for (unsigned int ib = assembly_coloring.GetSerialStart(); ib < assembly_coloring.GetNumBlocks(); ib++) {
+            for (unsigned int k = 0; k < blocks[ib].size; k++) {
+                ChConstraint* constraint = vconstraints[blocks[ib].start + k];
+                if (constraint->IsActive())
+                    constraint->Build_CqT(Z, n_q + constraint->GetOffset());
+            }
+        }
+    }
+}
+
 int ChSystemDescriptor::BuildFbVector(ChVectorDynamic<>& Fvector) {
     n_q = CountActiveVariables();
     Fvector.setZero(n_q);
@@ -481,6 +568,107 @@ int ChSystemDescriptor::FromVectorToUnknowns(const ChVectorDynamic<>& mvector) {
     return n_q + n_c;
 }
 
+// -----------------------------------------------------------------------------
+
+// Row-parallel sparse matrix-vector product, result (+)= A * x, with A in compressed row-major storage.
+static void CompiledProduct(const ChSparseMatrix& A, const double* x, double* result, bool add, int nthreads) {
+    const int* outer = A.outerIndexPtr();
+    const int* inner = A.innerIndexPtr();
+    const double* values = A.valuePtr();
+    const int nrows = (int)A.rows();
+
+#pragma omp parallel for schedule(static) num_threads(nthreads)
+    for (int i = 0; i < nrows; i++) {
+        double sum = add ? result[i] : 0.0;
+        for (int k = outer[i]; k < outer[i + 1]; k++)
+            sum += values[k] * x[inner[k]];
+        result[i] = sum;
+    }
+}
+
+// Number of non-zeros reserved in a row of [Cq] for a constraint that does not report the variables it acts on
+// (enough for a constraint between four 6-DOF bodies; Build_Cq reallocates if this is exceeded).
+static const int default_Cq_row_nnz = 4 * 6;
+
+void ChSystemDescriptor::Compile() {
+    compiled_shur = false;
+    compiled_system = false;
+
+    if (!use_compiled)
+        return;
+
+    n_q = CountActiveVariables();
+    n_c = CountActiveConstraints();
+
+    auto vv_size = vvariables.size();
+    auto vc_size = vconstraints.size();
+
+    // 1 - Jacobian [Cq] and cfm terms [E].
+    //     Reserve each row from the constraint connectivity (if known), so that Build_Cq inserts in place.
+    Eigen::VectorXi row_nnz(n_c);
+    std::vector<ChVariables*> vars;
+    for (size_t ic = 0; ic < vc_size; ic++) {
+        if (vconstraints[ic]->IsActive()) {
+            vars.clear();
+            vconstraints[ic]->AppendVariables(vars);
+            int nnz = 0;
+            for (auto var : vars) {
+                if (var && var->IsActive())
+                    nnz += var->Get_ndof();
+            }
+            row_nnz(vconstraints[ic]->GetOffset()) = vars.empty() ? default_Cq_row_nnz : nnz;
+        }
+    }
+
+    compiled_Cq.resize(n_c, n_q);
+    compiled_Cq.reserve(row_nnz);
+    compiled_E.setZero(n_c);
+    for (size_t ic = 0; ic < vc_size; ic++) {
+        if (vconstraints[ic]->IsActive()) {
+            vconstraints[ic]->Build_Cq(compiled_Cq, vconstraints[ic]->GetOffset());
+            compiled_E(vconstraints[ic]->GetOffset()) = vconstraints[ic]->Get_cfm_i();
+        }
+    }
+    compiled_Cq.makeCompressed();
+
+    // 2 - Block-diagonal inverse mass [M^(-1)], assembled column by column from its action on unit vectors,
+    //     and the product [M^(-1)][Cq'] used in the Shur complement.
+    Eigen::VectorXi Minv_nnz(n_q);
+    for (size_t iv = 0; iv < vv_size; iv++) {
+        if (vvariables[iv]->IsActive()) {
+            int ndof = vvariables[iv]->Get_ndof();
+            Minv_nnz.segment(vvariables[iv]->GetOffset(), ndof).setConstant(ndof);
+        }
+    }
+
+    ChSparseMatrix Minv(n_q, n_q);
+    Minv.reserve(Minv_nnz);
+    for (size_t iv = 0; iv < vv_size; iv++) {
+        if (vvariables[iv]->IsActive()) {
+            int offset = vvariables[iv]->GetOffset();
+            int ndof = vvariables[iv]->Get_ndof();
+            ChVectorDynamic<> unit(ndof);
+            ChVectorDynamic<> column(ndof);
+            for (int j = 0; j < ndof; j++) {
+                unit.setZero();
+                unit(j) = 1;
+                vvariables[iv]->Compute_invMb_v(column, unit);
+                for (int i = 0; i < ndof; i++) {
+                    if (column(i) != 0)
+                        Minv.insert(offset + i, offset + j) = column(i);
+                }
+            }
+        }
+    }
+    Minv.makeCompressed();
+
+    compiled_MinvCqT = Minv * compiled_Cq.transpose();
+    compiled_MinvCqT.makeCompressed();
+
+    compiled_tmp.resize(n_q);
+    compiled_shur = true;
+}
+
 void ChSystemDescriptor::ShurComplementProduct(ChVectorDynamic<>& result,
                                                const ChVectorDynamic<>& lvector,
                                                std::vector<bool>* enabled) {
@@ -488,6 +676,15 @@ void ChSystemDescriptor::ShurComplementProduct(ChVectorDynamic<>& result,
     assert(vstiffness.size() == 0);
     assert(lvector.size() == CountActiveConstraints());
 
+    // Compiled path: result = [Cq]*([M^(-1)][Cq']*l) + [E]*l
+    // (note that, unlike the default path below, the 'q' data in the ChVariables is not changed)
+    if (compiled_shur && !enabled) {
+        CompiledProduct(compiled_MinvCqT, lvector.data(), compiled_tmp.data(), false, num_threads);
+        result = compiled_E.cwiseProduct(lvector);
+        CompiledProduct(compiled_Cq, compiled_tmp.data(), result.data(), true, num_threads);
+        return;
+    }
+
     result.setZero(n_c);
 
     // Performs the sparse product    result = [N]*l = [ [Cq][M^(-1)][Cq'] - [E] ] *l
@@ -544,6 +741,48 @@ void ChSystemDescriptor::ShurComplementProduct(ChVectorDynamic<>& result,
 }
 
 void ChSystemDescriptor::SystemProduct(ChVectorDynamic<>& result, const ChVectorDynamic<>& x) {
+    // Compiled path: the [H] and [Cq'] matrices are assembled at the first product after Compile()
+    if (compiled_shur) {
+        if (!compiled_system) {
+            // Learn the sparsity pattern of [H] first, so that the values are then inserted in place
+            ChSparsityPatternLearner sparsity_pattern(n_q, n_q);
+            for (size_t iv = 0; iv < vvariables.size(); iv++) {
+                if (vvariables[iv]->IsActive()) {
+                    int offset = vvariables[iv]->GetOffset();
+                    vvariables[iv]->Build_M(sparsity_pattern, offset, offset, c_a);
+                }
+            }
+            for (size_t ik = 0; ik < vstiffness.size(); ik++) {
+                vstiffness[ik]->Build_K(sparsity_pattern, true);
+            }
+            sparsity_pattern.Apply(compiled_H);
+
+            for (size_t iv = 0; iv < vvariables.size(); iv++) {
+                if (vvariables[iv]->IsActive()) {
+                    int offset = vvariables[iv]->GetOffset();
+                    vvariables[iv]->Build_M(compiled_H, offset, offset, c_a);
+                }
+            }
+            for (size_t ik = 0; ik < vstiffness.size(); ik++) {
+                vstiffness[ik]->Build_K(compiled_H, true);
+            }
+            compiled_H.makeCompressed();
+            compiled_CqT = compiled_Cq.transpose();
+            compiled_system = true;
+        }
+
+        result.resize(n_q + n_c);
+
+        // result.q = [H]*x.q + [Cq']*x.l
+        CompiledProduct(compiled_H, x.data(), result.data(), false, num_threads);
+        CompiledProduct(compiled_CqT, x.data() + n_q, result.data(), true, num_threads);
+
+        // result.l = [Cq]*x.q + [E]*x.l
+        result.segment(n_q, n_c) = compiled_E.cwiseProduct(x.segment(n_q, n_c));
+        CompiledProduct(compiled_Cq, x.data(), result.data() + n_q, true, num_threads);
+        return;
+    }
+
     n_q = CountActiveVariables();
     n_c = CountActiveConstraints();
 
@@ -18,6 +18,7 @@
 #include <vector>
 
 #include "chrono/solver/ChConstraint.h"
+#include "chrono/solver/ChConstraintColoring.h"
 #include "chrono/solver/ChKblock.h"
 #include "chrono/solver/ChVariables.h"
 
@@ -81,6 +82,20 @@ class ChApi ChSystemDescriptor {
     int n_q;            ///< number of active variables
     int n_c;            ///< number of active constraints
     bool freeze_count;  ///< for optimization: avoid to re-count the number of active variables and constraints
+    int num_threads;    ///< number of threads available to solvers operating on this descriptor
+
+    bool use_compiled;                ///< use the compiled representation in ShurComplementProduct and SystemProduct
+    bool compiled_shur;               ///< compiled data for ShurComplementProduct is up to date
+    bool compiled_system;             ///< compiled data for SystemProduct is up to date
+    ChSparseMatrix compiled_Cq;       ///< compiled constraint Jacobian [Cq]
+    ChSparseMatrix compiled_MinvCqT;  ///< compiled [M^(-1)][Cq']
+    ChSparseMatrix compiled_CqT;      ///< compiled [Cq']
+    ChSparseMatrix compiled_H;        ///< compiled [H] = c_a*[M] + [K]
+    ChVectorDynamic<> compiled_E;     ///< compiled diagonal of [E] (cfm terms)
+    ChVectorDynamic<> compiled_tmp;   ///< scratch vector for compiled products
+
+    ChConstraintColoring assembly_coloring;   ///< coloring of constraints for parallel assembly of [Cq']
+    ChConstraintColoring assembly_kcoloring;  ///< coloring of K blocks for parallel assembly of [K]
 
   public:
     /// Constructor
@@ -102,6 +117,8 @@ class ChApi ChSystemDescriptor {
 
     /// Begin insertion of items
     virtual void BeginInsertion() {
+        compiled_shur = false;
+        compiled_system = false;
         vconstraints.clear();
         vvariables.clear();
         vstiffness.clear();
@@ -140,12 +157,24 @@ class ChApi ChSystemDescriptor {
 
     /// Sets the c_a coefficient (default=1) used for scaling the M masses of the vvariables
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
-    virtual void SetMassFactor(const double mc_a) { c_a = mc_a; }
+    /// Changing the factor invalidates the compiled system matrix (see Compile()).
+    virtual void SetMassFactor(const double mc_a) {
+        if (mc_a != c_a)
+            compiled_system = false;
+        c_a = mc_a;
+    }
 
     /// Gets the c_a coefficient (default=1) used for scaling the M masses of the vvariables
     /// when performing ShurComplementProduct(), SystemProduct(), ConvertToMatrixForm(),
     virtual double GetMassFactor() { return c_a; }
 
+    /// Set the number of threads that solvers may use for parallel operations on this descriptor (default: 1).
+    /// This is set automatically by the owning ChSystem (see ChSystem::SetNumThreads).
+    void SetNumThreads(int nthreads) { num_threads = nthreads; }
+
+    /// Get the number of threads that solvers may use for parallel operations on this descriptor.
+    int GetNumThreads() const { return num_threads; }
+
     // DATA <-> MATH.VECTORS FUNCTIONS
 
     /// Get a vector with all the 'fb' known terms ('forces'etc.) associated to all variables,
@@ -268,6 +297,23 @@ class ChApi ChSystemDescriptor {
                                const ChVectorDynamic<>& x  ///< vector to be multiplied
     );
 
+    /// Enable the use of a compiled representation of the system in ShurComplementProduct and SystemProduct
+    /// (default: false). When enabled, Compile() packs the constraint Jacobians, inverse mass blocks, stiffness blocks
+    /// and compliance terms in flat compressed sparse row storage, and the products are then carried out with
+    /// multithreaded sparse matrix-vector kernels instead of looping over the ChVariables and ChConstraint objects
+    /// through virtual calls. This pays off for iterative solvers that perform many products per solve.
+    void EnableCompiledProducts(bool val) { use_compiled = val; }
+
+    /// Return true if the compiled representation is used in ShurComplementProduct and SystemProduct.
+    bool IsCompiledProducts() const { return use_compiled; }
+
+    /// Pack the current state of the constraints and variables in the compiled representation.
+    /// No-op if the compiled representation is not enabled (see EnableCompiledProducts). This function must be called
+    /// after the Jacobians, masses and compliances were updated and before any product is performed; the iterative
+    /// solvers based on ShurComplementProduct and SystemProduct do this at the beginning of each solve. The compiled
+    /// data is invalidated by BeginInsertion().
+    virtual void Compile();
+
     /// Performs projection of constraint multipliers onto allowed set (in case
     /// of bilateral constraints it does not affect multipliers, but for frictional
     /// constraints, for example, it projects multipliers onto the friction cones)
@@ -325,6 +371,14 @@ class ChApi ChSystemDescriptor {
                                      ChVectorDynamic<>* rhs  ///< [out] assembled RHS vector
     );
 
+    /// Create the assembled system matrix, using multiple threads (see SetNumThreads).
+    /// Same as ConvertToMatrixForm(Z, nullptr), but the mass blocks, the constraint rows, and independent groups of K
+    /// blocks and of transposed constraint Jacobians are written concurrently. This requires that space was reserved in
+    /// Z for exactly the nonzeros of the system matrix, i.e. that its sparsity pattern was just set by applying a
+    /// ChSparsityPatternLearner filled by this descriptor: with such a matrix, concurrent writes to different rows never
+    /// trigger a reallocation of the matrix storage.
+    virtual void ConvertToMatrixFormParallel(ChSparseMatrix& Z);
+
     /// Write the current assembled system matrix and right-hand side vector.
     /// The system matrix is formed by calling ConvertToMatrixForm() as used with direct linear solvers.
     /// The following files are written in the directory specified by [path]:
@@ -0,0 +1,181 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#include <algorithm>
+#include <numeric>
+
+#include "chrono/solver/ChSystemDescriptorIslands.h"
+
+namespace chrono {
+
+int ChSystemDescriptorIslands::Find(int i) {
+    while (m_parent[i] != i) {
+        m_parent[i] = m_parent[m_parent[i]];
+        i = m_parent[i];
+    }
+    return i;
+}
+
+// Join all active variables in the scratch list.
+// Return the index of one of them, or -1 if none is active.
+int ChSystemDescriptorIslands::Join() {
+    int rep = -1;
+    for (auto var : m_vars) {
+        if (!var || !var->IsActive())
+            continue;
+        auto it = m_var_index.find(var);
+        if (it == m_var_index.end())
+            continue;
+        int i = it->second;
+        m_coupled[i] = 1;
+        if (rep < 0) {
+            rep = i;
+            continue;
+        }
+        int ri = Find(i);
+        int rr = Find(rep);
+        if (ri != rr)
+            m_parent[ri] = rr;
+    }
+    return rep;
+}
+
+bool ChSystemDescriptorIslands::Build(ChSystemDescriptor& sysd) {
+    m_num_islands = 0;
+
+    std::vector<ChVariables*>& vvariables = sysd.GetVariablesList();
+    std::vector<ChConstraint*>& vconstraints = sysd.GetConstraintsList();
+    std::vector<ChKblock*>& vstiffness = sysd.GetKblocksList();
+
+    // 1) Index the active variables
+    m_var_index.clear();
+    for (auto var : vvariables) {
+        if (var->IsActive())
+            m_var_index.emplace(var, (int)m_var_index.size());
+    }
+    const int nvars = (int)m_var_index.size();
+    if (nvars < 2)
+        return false;
+
+    m_parent.resize(nvars);
+    std::iota(m_parent.begin(), m_parent.end(), 0);
+    m_coupled.assign(nvars, 0);
+
+    // 2) Join the variables of all active constraints and of all K blocks.
+    //    Inactive constraints are only assigned to the island of their variables (if any), so that contact triplets
+    //    N,U,V stay consecutive in the island constraint lists.
+    m_constr_rep.resize(vconstraints.size());
+    for (size_t ic = 0; ic < vconstraints.size(); ic++) {
+        m_vars.clear();
+        vconstraints[ic]->AppendVariables(m_vars);
+        if (!vconstraints[ic]->IsActive()) {
+            m_constr_rep[ic] = -1;
+            for (auto var : m_vars) {
+                auto it = var ? m_var_index.find(var) : m_var_index.end();
+                if (it != m_var_index.end()) {
+                    m_constr_rep[ic] = it->second;
+                    break;
+                }
+            }
+            continue;
+        }
+        if (m_vars.empty())
+            return false;
+        m_constr_rep[ic] = Join();
+        if (m_constr_rep[ic] < 0)
+            return false;
+    }
+
+    m_kblock_rep.resize(vstiffness.size());
+    for (size_t ik = 0; ik < vstiffness.size(); ik++) {
+        m_vars.clear();
+        vstiffness[ik]->AppendVariables(m_vars);
+        if (m_vars.empty())
+            return false;
+        m_kblock_rep[ik] = Join();
+    }
+
+    // 3) Number the islands. All uncoupled variables are collected in a single island.
+    std::vector<int> size;
+    int free_island = -1;
+    m_island.assign(nvars, -1);
+    for (int i = 0; i < nvars; i++) {
+        int r = Find(i);
+        if (m_island[r] < 0) {
+            if (m_coupled[r]) {
+                m_island[r] = (int)size.size();
+                size.push_back(0);
+            } else {
+                if (free_island < 0) {
+                    free_island = (int)size.size();
+                    size.push_back(0);
+                }
+                m_island[r] = free_island;
+            }
+        }
+        size[m_island[r]]++;
+    }
+    for (auto rep : m_constr_rep) {
+        if (rep >= 0)
+            size[m_island[Find(rep)]]++;
+    }
+
+    const int nislands = (int)size.size();
+    if (nislands < 2)
+        return false;
+
+    // 4) Sort islands by decreasing size (for load balancing when solving them concurrently)
+    std::vector<int> order(nislands);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&size](int a, int b) { return size[a] > size[b]; });
+    std::vector<int> rank(nislands);
+    for (int k = 0; k < nislands; k++)
+        rank[order[k]] = k;
+    for (int i = 0; i < nvars; i++) {
+        if (m_parent[i] == i)
+            m_island[i] = rank[m_island[i]];
+    }
+
+    // 5) Fill the island descriptors, preserving the order of the original lists
+    while ((int)m_islands.size() < nislands)
+        m_islands.push_back(chrono_types::make_shared<ChSystemDescriptor>());
+
+    for (int k = 0; k < nislands; k++)
+        m_islands[k]->BeginInsertion();
+
+    for (auto var : vvariables) {
+        if (var->IsActive())
+            m_islands[m_island[Find(m_var_index[var])]]->InsertVariables(var);
+    }
+    for (size_t ic = 0; ic < vconstraints.size(); ic++) {
+        if (m_constr_rep[ic] >= 0)
+            m_islands[m_island[Find(m_constr_rep[ic])]]->InsertConstraint(vconstraints[ic]);
+    }
+    for (size_t ik = 0; ik < vstiffness.size(); ik++) {
+        if (m_kblock_rep[ik] >= 0)
+            m_islands[m_island[Find(m_kblock_rep[ik])]]->InsertKblock(vstiffness[ik]);
+    }
+
+    for (int k = 0; k < nislands; k++) {
+        m_islands[k]->EndInsertion();
+        m_islands[k]->SetMassFactor(sysd.GetMassFactor());
+        m_islands[k]->EnableCompiledProducts(sysd.IsCompiledProducts());
+        m_islands[k]->SetNumThreads(1);
+    }
+
+    m_num_islands = nislands;
+    return true;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,75 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+
+#ifndef CHSYSTEMDESCRIPTORISLANDS_H
+#define CHSYSTEMDESCRIPTORISLANDS_H
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/solver/ChSystemDescriptor.h"
+
+namespace chrono {
+
+/// @addtogroup chrono_solver
+/// @{
+
+/// Decomposition of a system descriptor into independent subproblems (islands).
+/// Two active ChVariables objects belong to the same island if they are coupled, directly or indirectly, by an active
+/// constraint or by a ChKblock. Inactive variables (e.g., fixed bodies) do not couple islands. Each island is
+/// collected into its own ChSystemDescriptor which references the same ChVariables, ChConstraint, and ChKblock objects
+/// as the original descriptor (in the same order), so that the islands can be solved separately and concurrently.
+/// Variables not coupled to any other object are all grouped in a single island.
+///
+/// Note that solving an island updates the offsets of its variables and constraints; call
+/// ChSystemDescriptor::UpdateCountsAndOffsets on the original descriptor before using it again.
+class ChApi ChSystemDescriptorIslands {
+  public:
+    ChSystemDescriptorIslands() : m_num_islands(0) {}
+
+    /// Split the given descriptor into independent islands.
+    /// Return false if the problem cannot be split, i.e., if it has a single island or if it contains constraints or
+    /// K blocks with unknown connectivity (see ChConstraint::AppendVariables and ChKblock::AppendVariables).
+    /// Islands are sorted by decreasing size. The island descriptors inherit the mass factor and the compiled products
+    /// setting of the given descriptor and are set to use a single thread.
+    bool Build(ChSystemDescriptor& sysd);
+
+    /// Return the number of islands found by the last call to Build.
+    int GetNumIslands() const { return m_num_islands; }
+
+    /// Access the descriptor of the specified island.
+    ChSystemDescriptor& GetIsland(int i) { return *m_islands[i]; }
+
+  private:
+    int Find(int i);
+    int Join();
+
+    int m_num_islands;                                           ///< number of islands
+    std::vector<std::shared_ptr<ChSystemDescriptor>> m_islands;  ///< island descriptors (reused between calls)
+
+    std::unordered_map<ChVariables*, int> m_var_index;  ///< index of each active variable
+    std::vector<int> m_parent;                          ///< union-find forest over active variables
+    std::vector<char> m_coupled;                        ///< flag for variables coupled by a constraint or K block
+    std::vector<int> m_island;                          ///< island index of each root variable
+    std::vector<int> m_constr_rep;                      ///< representative variable of each constraint
+    std::vector<int> m_kblock_rep;                      ///< representative variable of each K block
+    std::vector<ChVariables*> m_vars;                   ///< scratch list of variables of current object
+};
+
+/// @} chrono_solver
+
+}  // end namespace chrono
+
+#endif
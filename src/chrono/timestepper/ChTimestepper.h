@@ -19,6 +19,7 @@
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChMath.h"
 #include "chrono/serialization/ChArchive.h"
+#include "chrono/serialization/ChCheckpoint.h"
 #include "chrono/timestepper/ChIntegrable.h"
 #include "chrono/timestepper/ChState.h"
 
@@ -86,6 +87,13 @@ class ChApi ChTimestepper {
     /// Turn on/off clamping on the Qcterm.
     void SetQcClamping(double cl) { Qc_clamping = cl; }
 
+    /// Write the internal state of the integrator (if any) to a binary checkpoint.
+    /// Only data carried over from one step to the next (e.g., an adaptive internal step size) must be written here.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const {}
+
+    /// Read the internal state of the integrator (if any) from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) {}
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& archive);
 
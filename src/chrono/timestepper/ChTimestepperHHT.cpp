@@ -431,6 +431,16 @@ void ChTimestepperHHT::CalcErrorWeights(const ChVectorDynamic<>& x, double rtol,
     ewt = (rtol * x.cwiseAbs() + atol).cwiseInverse();
 }
 
+void ChTimestepperHHT::CheckpointOut(ChCheckpointOut& cp) const {
+    cp.Write(h);
+    cp.Write(num_successful_steps);
+}
+
+void ChTimestepperHHT::CheckpointIn(ChCheckpointIn& cp) {
+    cp.Read(h);
+    cp.Read(num_successful_steps);
+}
+
 // Trick to avoid putting the following mapper macro inside the class definition in .h file:
 // enclose macros in local 'my_enum_mappers', just to avoid avoiding cluttering of the parent class.
 class my_enum_mappers : public ChTimestepperHHT {
@@ -141,6 +141,12 @@ class ChApi ChTimestepperHHT : public ChTimestepperIIorder, public ChImplicitIte
     /// Get the threshold of norm of R, which is used to judge the trend of convergency.
     double GetThreshold_R() const { return threshold_R; }
 
+    /// Write the internal step size and the count of successful steps to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const override;
+
+    /// Read the internal step size and the count of successful steps from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     /// Method to allow serialization of transient data to archives.
     virtual void ArchiveOUT(ChArchiveOut& archive) override;
 
@@ -138,6 +138,8 @@ ChApi void WriteBodies(ChSystem* system,
                        const std::string& delim = ",");
 
 /// Create a CSV file with a checkpoint.
+/// Only bodies and their collision shapes are written. See ChSystem::SaveCheckpoint for a binary checkpoint of the
+/// full state of an already constructed model.
 ChApi bool WriteCheckpoint(ChSystem* system, const std::string& filename);
 
 /// Read a CSV file with a checkpoint.
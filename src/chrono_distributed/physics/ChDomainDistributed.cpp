@@ -22,8 +22,10 @@
 
 #include <mpi.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <numeric>
 
 using namespace chrono;
 
@@ -32,6 +34,13 @@ ChDomainDistributed::ChDomainDistributed(ChSystemDistributed* sys) {
     split_axis = 0;
     split = false;
     axis_set = false;
+
+    lb_interval = 0;
+    lb_metric = LoadMetric::BODY_COUNT;
+    lb_tolerance = 1.1;
+    lb_imbalance = 1;
+    lb_time = 0;
+    lb_steps = 0;
 }
 
 ChDomainDistributed::~ChDomainDistributed() {}
@@ -69,13 +78,21 @@ void ChDomainDistributed::SetSimDomain(const ChVector<>& lo, const ChVector<>& h
 }
 
 void ChDomainDistributed::SplitDomain() {
-    // Length of this subdomain along the long axis
-    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / my_sys->num_ranks;
+    int num_ranks = my_sys->num_ranks;
+    int my_rank = my_sys->my_rank;
+
+    // Length of the subdomains along the long axis
+    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / num_ranks;
+
+    boundaries.resize(num_ranks + 1);
+    for (int r = 0; r < num_ranks; r++)
+        boundaries[r] = boxlo[split_axis] + r * sub_len;
+    boundaries[num_ranks] = boxhi[split_axis];
 
     for (int i = 0; i < 3; i++) {
         if (split_axis == i) {
-            sublo[i] = boxlo[i] + my_sys->my_rank * sub_len;
-            subhi[i] = sublo[i] + sub_len;
+            sublo[i] = boundaries[my_rank];
+            subhi[i] = boundaries[my_rank + 1];
         } else {
             sublo[i] = boxlo[i];
             subhi[i] = boxhi[i];
@@ -85,10 +102,110 @@ void ChDomainDistributed::SplitDomain() {
 }
 
 int ChDomainDistributed::GetRank(const ChVector<double>& pos) const {
-    double sub_len = subhi[split_axis] - sublo[split_axis];
-    double pt = pos[split_axis] - boxlo[split_axis];
+    // Index of the sub-domain whose boundaries bracket the position along the split axis
+    auto next = std::upper_bound(boundaries.begin(), boundaries.end(), pos[split_axis]);
+
+    return (int)(next - boundaries.begin()) - 1;
+}
+
+void ChDomainDistributed::SetLoadBalancing(int interval, LoadMetric metric, double tolerance) {
+    lb_interval = std::max(interval, 0);
+    lb_metric = metric;
+    lb_tolerance = tolerance;
+    lb_time = 0;
+    lb_steps = 0;
+}
+
+double ChDomainDistributed::ComputeLoad() const {
+    if (lb_metric == LoadMetric::STEP_TIME)
+        return lb_time;
+
+    int num_bodies = 0;
+    for (auto status : my_sys->ddm->comm_status) {
+        if (status == distributed::OWNED || status == distributed::SHARED_UP || status == distributed::SHARED_DOWN)
+            num_bodies++;
+    }
+    return num_bodies;
+}
+
+bool ChDomainDistributed::Rebalance() {
+    int num_ranks = my_sys->num_ranks;
+    if (lb_interval == 0 || num_ranks == 1 || ++lb_steps < lb_interval)
+        return false;
+
+    // Gather the loads of all ranks (so that all ranks calculate the same new boundaries)
+    double load = ComputeLoad();
+    std::vector<double> loads(num_ranks);
+    MPI_Allgather(&load, 1, MPI_DOUBLE, loads.data(), 1, MPI_DOUBLE, my_sys->world);
+    lb_time = 0;
+    lb_steps = 0;
+
+    double total_load = std::accumulate(loads.begin(), loads.end(), 0.0);
+    if (total_load <= 0) {
+        lb_imbalance = 1;
+        return false;
+    }
+    lb_imbalance = *std::max_element(loads.begin(), loads.end()) * num_ranks / total_load;
+    if (lb_imbalance <= lb_tolerance)
+        return false;
+
+    if (!BalanceBoundaries(loads, my_sys->GetGhostLayer(), boundaries))
+        return false;
+
+    sublo[split_axis] = boundaries[my_sys->my_rank];
+    subhi[split_axis] = boundaries[my_sys->my_rank + 1];
+
+    return true;
+}
+
+bool ChDomainDistributed::BalanceBoundaries(const std::vector<double>& loads,
+                                            double ghost_layer,
+                                            std::vector<double>& boundaries) {
+    int num_ranks = (int)loads.size();
+    double max_shift = 0.5 * ghost_layer;  // maximum boundary motion
+    double min_len = 2 * ghost_layer;      // minimum sub-domain length
+
+    if (num_ranks < 2 || boundaries.size() != loads.size() + 1 ||
+        boundaries[num_ranks] - boundaries[0] < num_ranks * min_len)
+        return false;
+
+    // Cumulative load at the current boundaries
+    std::vector<double> cumul_load(num_ranks + 1, 0.0);
+    for (int r = 0; r < num_ranks; r++)
+        cumul_load[r + 1] = cumul_load[r] + loads[r];
+    double rank_load = cumul_load[num_ranks] / num_ranks;
+
+    // Largest admissible position of each boundary, such that all subsequent boundaries can still be placed
+    std::vector<double> max_pos(num_ranks + 1);
+    max_pos[num_ranks] = boundaries[num_ranks];
+    for (int k = num_ranks - 1; k > 0; k--)
+        max_pos[k] = std::min(boundaries[k] + max_shift, max_pos[k + 1] - min_len);
+
+    std::vector<double> old_boundaries = boundaries;
+    int r = 0;
+    for (int k = 1; k < num_ranks; k++) {
+        // Find the sub-domain where the cumulative load reaches k times the average rank load and locate the target
+        // boundary position within it, assuming a uniform load distribution in the sub-domain
+        double target_load = k * rank_load;
+        while (r < num_ranks - 1 && cumul_load[r + 1] < target_load)
+            r++;
+        double frac = loads[r] > 0 ? (target_load - cumul_load[r]) / loads[r] : 0.5;
+        frac = std::min(std::max(frac, 0.0), 1.0);
+        double target = old_boundaries[r] + frac * (old_boundaries[r + 1] - old_boundaries[r]);
+
+        // Limit the boundary motion and keep all sub-domains long enough.
+        // The range can only be empty if the current sub-domains are already shorter than the minimum length; in
+        // that case, leave all boundaries unchanged.
+        double lo = std::max(old_boundaries[k] - max_shift, boundaries[k - 1] + min_len);
+        double hi = max_pos[k];
+        if (lo > hi) {
+            boundaries = old_boundaries;
+            return false;
+        }
+        boundaries[k] = std::min(std::max(target, lo), hi);
+    }
 
-    return (int)(pt / sub_len);
+    return true;
 }
 
 distributed::COMM_STATUS ChDomainDistributed::GetRegion(double pos) const {
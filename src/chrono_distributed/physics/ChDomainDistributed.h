@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/core/ChVector.h"
 #include "chrono/physics/ChBody.h"
@@ -31,7 +32,9 @@ class ChSystemDistributed;
 /// @{
 
 /// This class maps sub-domains of the global simulation domain to each MPI rank.
-/// The global domain is split along the longest axis.
+/// The global domain is split along the longest axis, initially in sub-domains of equal length. If dynamic load
+/// balancing is enabled (see SetLoadBalancing), the boundaries between sub-domains are periodically moved along the
+/// split axis so as to equalize the load of all ranks.
 /// Within each sub-domain, there are layers of ownership:
 ///
 ///
@@ -105,8 +108,26 @@ class ChSystemDistributed;
 ///
 /// A body with a GHOST comm_status will become OWNED when it moves into the owned region of this rank.
 /// A body with a GHOST comm_status will be removed when it moves into the one of this rank's unowned regions.
+///
+///
+/// Load balancing:
+///
+/// The load of each rank (number of owned and shared bodies, or time spent in the integration steps) is gathered on
+/// all ranks and the cumulative load along the split axis is approximated assuming a uniform load distribution within
+/// each sub-domain. Each boundary between sub-domains is then moved towards the location which splits the total load
+/// in equal parts. Since the ranks only exchange bodies with their neighbors, and only with the transitions described
+/// above, a boundary moves by at most half of the ghost layer at each rebalancing (a boundary shift acts like a motion
+/// of the bodies relative to the sub-domain) and all sub-domains are kept at least two ghost layers long. Large
+/// imbalances are therefore corrected over several rebalancing intervals. Bodies are migrated by the regular exchange
+/// which follows the rebalancing.
 class CH_DISTR_API ChDomainDistributed {
   public:
+    /// Measure of the computational load of a rank, used for dynamic load balancing.
+    enum class LoadMetric {
+        BODY_COUNT,  ///< number of bodies owned or shared by the rank
+        STEP_TIME    ///< time spent by the rank in the integration steps since the last rebalancing
+    };
+
     ChDomainDistributed(ChSystemDistributed* sys);
     virtual ~ChDomainDistributed();
 
@@ -142,6 +163,36 @@ class CH_DISTR_API ChDomainDistributed {
     /// Returns true if the domain has been set.
     bool IsSplit() const { return split; }
 
+    /// Enable dynamic load balancing, with the sub-domains rebalanced every 'interval' steps (0 to disable).
+    /// The sub-domains are only modified if the load imbalance (maximum over average load) exceeds the given tolerance.
+    /// This function should be called on all ranks, with the same arguments.
+    void SetLoadBalancing(int interval, LoadMetric metric = LoadMetric::BODY_COUNT, double tolerance = 1.1);
+
+    /// Return the number of steps between load balancing (0 if load balancing is disabled).
+    int GetLoadBalancingInterval() const { return lb_interval; }
+
+    /// Return the load imbalance (maximum over average load) measured at the last rebalancing.
+    double GetLoadImbalance() const { return lb_imbalance; }
+
+    /// Return the boundaries of all sub-domains along the split axis (number of ranks + 1 values).
+    const std::vector<double>& GetSplitBoundaries() const { return boundaries; }
+
+    /// Record the time spent by this rank in an integration step (used with the STEP_TIME load metric).
+    void AddStepTime(double time) { lb_time += time; }
+
+    /// Move the sub-domain boundaries along the split axis (num_ranks + 1 values, the first and last being fixed)
+    /// towards the positions which equalize the given loads of all ranks, assuming a uniform load distribution within
+    /// each sub-domain. Each boundary moves by at most half a ghost layer and all sub-domains keep a length of at least
+    /// two ghost layers. Return false, with the boundaries unchanged, if this is not possible (domain too short, or
+    /// sub-domains already shorter than allowed).
+    static bool BalanceBoundaries(const std::vector<double>& loads,
+                                  double ghost_layer,
+                                  std::vector<double>& boundaries);
+
+    /// Rebalance the sub-domains, if due at the current step. Return true if the sub-domains were modified.
+    /// Called by the system at the end of each step, before the exchange of bodies between ranks (on all ranks).
+    virtual bool Rebalance();
+
     /// Prints basic information about the domain decomposition
     virtual void PrintDomain();
 
@@ -163,6 +214,18 @@ class CH_DISTR_API ChDomainDistributed {
     bool split;     ///< Flag indicating that the domain has been divided into sub-domains.
     bool axis_set;  ///< Flag indicating that the splitting axis has been set.
 
+    /// Calculate the load of this rank, according to the current load metric.
+    virtual double ComputeLoad() const;
+
+    std::vector<double> boundaries;  ///< sub-domain boundaries along the split axis (num_ranks + 1)
+
+    int lb_interval;       ///< number of steps between load balancing (0: disabled)
+    LoadMetric lb_metric;  ///< measure of rank loads
+    double lb_tolerance;   ///< maximum allowed load imbalance (maximum over average load)
+    double lb_imbalance;   ///< load imbalance at last rebalancing
+    double lb_time;        ///< time spent in integration steps since last rebalancing
+    int lb_steps;          ///< number of steps since last rebalancing
+
   private:
     /// Helper function that is called by the public GetRegion methods to get
     /// the region classification for a body based on the center position.
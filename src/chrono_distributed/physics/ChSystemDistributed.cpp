@@ -124,9 +124,14 @@ bool ChSystemDistributed::Integrate_Y() {
     assert(domain->IsSplit());
     ddm->initial_add = false;
 
+    double t_start = MPI_Wtime();
     bool ret = ChSystemMulticoreSMC::Integrate_Y();
+    domain->AddStepTime(MPI_Wtime() - t_start);
+
     if (num_ranks != 1) {
         data_manager->system_timer.start("Exchange");
+        // Rebalance the sub-domains (if due); bodies are migrated by the following exchange
+        domain->Rebalance();
         comm->Exchange();
         data_manager->system_timer.stop("Exchange");
     }
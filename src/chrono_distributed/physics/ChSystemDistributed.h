@@ -107,7 +107,7 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemMulticoreSMC {
     virtual void RemoveBody(std::shared_ptr<ChBody> body) override;
 
     /// Wraps the super-class Integrate_Y call and introduces a call that carries
-    /// out all inter-rank communication.
+    /// out all inter-rank communication (preceded by the rebalancing of the sub-domains, if enabled).
     virtual bool Integrate_Y() override;
 
     /// Wraps super-class UpdateRigidBodies and adds a gid update.
@@ -42,6 +42,7 @@ class collision_settings {
           bins_per_axis(vec3(10, 10, 10)),
           bin_size(real3(1, 1, 1)),
           grid_density(5),
+          broadphase_method(collision::ChBroadphase::Method::GRID),
           broadphase_grid(collision::ChBroadphase::GridType::FIXED_RESOLUTION),
           narrowphase_algorithm(collision::ChNarrowphase::Algorithm::HYBRID) {}
 
@@ -63,6 +64,11 @@ class collision_settings {
     /// Upper corner of the axis-aligned bounding box (if set to active).
     real3 aabb_max;
 
+    /// Broadphase algorithm (default: GRID).
+    /// A BVH broadphase is better suited for scenes mixing very large and very small collision shapes. Note that the
+    /// grid broadphase is always used if the system contains 3-dof particles.
+    collision::ChBroadphase::Method broadphase_method;
+
     /// Method for controlling granularity of the broadphase collision grid.
     collision::ChBroadphase::GridType broadphase_grid;
 
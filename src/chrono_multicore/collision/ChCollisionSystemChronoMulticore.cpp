@@ -71,6 +71,7 @@ void ChCollisionSystemChronoMulticore::PreProcess() {
     use_aabb_active = settings.use_aabb_active;
     active_aabb_min = settings.aabb_min;
     active_aabb_max = settings.aabb_max;
+    broadphase.method = settings.broadphase_method;
     broadphase.grid_type = settings.broadphase_grid;
     broadphase.grid_resolution = settings.bins_per_axis;
     broadphase.bin_size = settings.bin_size;
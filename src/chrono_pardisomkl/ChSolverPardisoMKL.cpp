@@ -23,7 +23,9 @@ ChSolverPardisoMKL::ChSolverPardisoMKL(int num_threads) {
 }
 
 bool ChSolverPardisoMKL::FactorizeMatrix() {
-    m_engine.compute(m_mat);
+    if (m_analyze)
+        m_engine.analyzePattern(m_mat);
+    m_engine.factorize(m_mat);
     return (m_engine.info() == Eigen::Success);
 }
 
@@ -55,7 +55,8 @@ bool ChSolverPardisoProject::Setup(ChSystemDescriptor& sysd) {
 bool ChSolverPardisoProject::FactorizeMatrix() {
     m_engine.SetMatrix(m_mat);
 
-    m_engine.PardisoProjectCall(ChPardisoProjectEngine::parproj_PHASE::ANALYZE_FACTORIZE);
+    m_engine.PardisoProjectCall(m_analyze ? ChPardisoProjectEngine::parproj_PHASE::ANALYZE_FACTORIZE
+                                          : ChPardisoProjectEngine::parproj_PHASE::FACTORIZE);
 
     
     if (verbose){
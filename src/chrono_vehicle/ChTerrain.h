@@ -19,6 +19,8 @@
 #ifndef CH_TERRAIN_H
 #define CH_TERRAIN_H
 
+#include <vector>
+
 #include "chrono/core/ChVector.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
@@ -57,6 +59,19 @@ class CH_VEHICLE_API ChTerrain {
     /// Get all terrain characteristics at the point below the specified location.
     virtual void GetProperties(const ChVector<>& loc, double& height, ChVector<>& normal, float& friction) const;
 
+    /// Get the terrain heights below the specified locations.
+    /// The default implementation calls GetHeight for each location. Derived classes may override this function to
+    /// amortize the cost of individual queries (e.g., for tire models which sample the terrain at many points).
+    virtual void GetHeightBatch(const std::vector<ChVector<>>& loc, std::vector<double>& height) const;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// The default implementation calls GetProperties for each location. Derived classes may override this function to
+    /// amortize the cost of individual queries.
+    virtual void GetPropertiesBatch(const std::vector<ChVector<>>& loc,
+                                    std::vector<double>& height,
+                                    std::vector<ChVector<>>& normal,
+                                    std::vector<float>& friction) const;
+
     /// Class to be used as a functor interface for location-dependent terrain height.
     class CH_VEHICLE_API HeightFunctor {
       public:
@@ -288,11 +288,14 @@ double CRGTerrain::GetHeight(const ChVector<>& loc) const {
 }
 
 ChVector<> CRGTerrain::GetNormal(const ChVector<>& loc) const {
+    return CalcNormal(loc, GetHeight(loc));
+}
+
+ChVector<> CRGTerrain::CalcNormal(const ChVector<>& loc, double z0) const {
     ChVector<> loc_ISO = ChWorldFrame::ToISO(loc);
     // to avoid 'jumping' of the normal vector, we take this smoothing approach
     const double delta = 0.05;
-    double z0, zfront, zleft;
-    z0 = GetHeight(loc);
+    double zfront, zleft;
     zfront = GetHeight(ChWorldFrame::FromISO(loc_ISO + ChVector<>(delta, 0, 0)));
     zleft = GetHeight(ChWorldFrame::FromISO(loc_ISO + ChVector<>(0, delta, 0)));
     ChVector<> p0(loc_ISO.x(), loc_ISO.y(), z0);
@@ -317,6 +320,12 @@ float CRGTerrain::GetCoefficientFriction(const ChVector<>& loc) const {
     return m_friction_fun ? (*m_friction_fun)(loc) : m_friction;
 }
 
+void CRGTerrain::GetProperties(const ChVector<>& loc, double& height, ChVector<>& normal, float& friction) const {
+    height = GetHeight(loc);
+    normal = CalcNormal(loc, height);
+    friction = GetCoefficientFriction(loc);
+}
+
 std::shared_ptr<ChBezierCurve> CRGTerrain::GetRoadCenterLine() {
     std::vector<ChVector<>> pathpoints;
 
@@ -92,6 +92,14 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value specified at construction.
     virtual float GetCoefficientFriction(const ChVector<>& loc) const override;
 
+    /// Get all terrain characteristics at the point below the specified location.
+    /// This is more efficient than calling GetHeight, GetNormal, and GetCoefficientFriction separately, as the terrain
+    /// height is evaluated only once.
+    virtual void GetProperties(const ChVector<>& loc,
+                               double& height,
+                               ChVector<>& normal,
+                               float& friction) const override;
+
     /// Get the road center line as a Bezier curve.
     std::shared_ptr<ChBezierCurve> GetRoadCenterLine();
 
@@ -149,6 +157,9 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     void GenerateCurves();
     void SetRoadsidePosts();
 
+    /// Calculate the terrain normal at the specified location, given the terrain height there.
+    ChVector<> CalcNormal(const ChVector<>& loc, double z0) const;
+
     double m_post_distance; // 0 means no posts
     std::string m_diffuse_texture_filename;
     bool m_use_diffuseTexture; // if set, use a textured mesh
@@ -19,7 +19,10 @@
 #include <limits>
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
+#include <fstream>
+#include <iostream>
 
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/assets/ChTexture.h"
@@ -49,6 +52,8 @@ RigidTerrain::RigidTerrain(ChSystem* system)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_hfield_type(HeightFieldType::NONE),
+      m_hfield_resolution(0),
       m_contact_callback(nullptr),
       m_collision_family(14) {}
 
@@ -59,6 +64,8 @@ RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
     : m_system(system),
       m_num_patches(0),
       m_use_friction_functor(false),
+      m_hfield_type(HeightFieldType::NONE),
+      m_hfield_resolution(0),
       m_contact_callback(nullptr),
       m_collision_family(14) {
     // Open and parse the input file
@@ -257,11 +264,15 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
                          patch->m_trimesh->getCoordsVertices().end(),                                        //
                          [](const ChVector<>& a, const ChVector<>& b) { return a.Length2() < b.Length2(); }  //
                          )
-            ->Length();
+            ->Length() +
+        sweep_sphere_radius;
 
     patch->m_mesh_name = mesh_name;
     patch->m_type = PatchType::MESH;
 
+    if (m_hfield_type != HeightFieldType::NONE)
+        patch->CreateHeightField(m_hfield_type, m_hfield_resolution, m_hfield_cache_dir);
+
     return patch;
 }
 
@@ -409,10 +420,14 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(std::shared_ptr<ChMa
     auto mesh_name = filesystem::path(heightmap_file).stem();
 
     // Cache patch parameters
-    patch->m_radius = ChVector<>(length, width, (hMax - hMin)).Length() / 2;
+    patch->m_radius = ChVector<>(length, width, 2 * std::max(std::abs(hMin), std::abs(hMax))).Length() / 2 +
+                      sweep_sphere_radius;
     patch->m_mesh_name = mesh_name;
     patch->m_type = PatchType::HEIGHT_MAP;
 
+    if (m_hfield_type != HeightFieldType::NONE)
+        patch->CreateHeightField(m_hfield_type, m_hfield_resolution, m_hfield_cache_dir);
+
     return patch;
 }
 
@@ -637,6 +652,92 @@ bool RigidTerrain::FindPoint(const ChVector<> loc, double& height, ChVector<>& n
     return hit;
 }
 
+void RigidTerrain::GetHeightBatch(const std::vector<ChVector<>>& loc, std::vector<double>& height) const {
+    if (m_height_fun) {
+        height.resize(loc.size());
+        for (size_t i = 0; i < loc.size(); i++)
+            height[i] = (*m_height_fun)(loc[i]);
+        return;
+    }
+
+    std::vector<ChVector<>> normal;
+    std::vector<float> friction;
+    std::vector<bool> hit;
+    FindPoints(loc, height, normal, friction, hit);
+
+    for (size_t i = 0; i < loc.size(); i++) {
+        if (!hit[i])
+            height[i] = 0.0;
+    }
+}
+
+void RigidTerrain::GetPropertiesBatch(const std::vector<ChVector<>>& loc,
+                                      std::vector<double>& height,
+                                      std::vector<ChVector<>>& normal,
+                                      std::vector<float>& friction) const {
+    if (m_height_fun && m_normal_fun && m_friction_fun) {
+        ChTerrain::GetPropertiesBatch(loc, height, normal, friction);
+        return;
+    }
+
+    std::vector<bool> hit;
+    FindPoints(loc, height, normal, friction, hit);
+
+    for (size_t i = 0; i < loc.size(); i++) {
+        if (!hit[i]) {
+            height[i] = 0;
+            normal[i] = ChWorldFrame::Vertical();
+            friction[i] = 0.8f;
+        }
+
+        if (m_height_fun)
+            height[i] = (*m_height_fun)(loc[i]);
+
+        if (m_normal_fun)
+            normal[i] = (*m_normal_fun)(loc[i]);
+
+        if (m_friction_fun)
+            friction[i] = (*m_friction_fun)(loc[i]);
+    }
+}
+
+void RigidTerrain::FindPoints(const std::vector<ChVector<>>& loc,
+                              std::vector<double>& height,
+                              std::vector<ChVector<>>& normal,
+                              std::vector<float>& friction,
+                              std::vector<bool>& hit) const {
+    const size_t n = loc.size();
+    height.assign(n, std::numeric_limits<double>::lowest());
+    normal.assign(n, ChWorldFrame::Vertical());
+    friction.assign(n, 0.8f);
+    hit.assign(n, false);
+
+    const ChVector<>& vertical = ChWorldFrame::Vertical();
+
+    for (auto patch : m_patches) {
+        const ChVector<>& center = patch->m_body->GetPos();
+        double radius2 = patch->m_radius * patch->m_radius;
+
+        for (size_t i = 0; i < n; i++) {
+            // Discard points whose vertical ray cannot intersect the patch bounding sphere
+            ChVector<> d = loc[i] - center;
+            d -= Vdot(d, vertical) * vertical;
+            if (d.Length2() > radius2)
+                continue;
+
+            double pheight;
+            ChVector<> pnormal;
+            bool phit = patch->FindPoint(loc[i], pheight, pnormal);
+            if (phit && pheight > height[i]) {
+                hit[i] = true;
+                height[i] = pheight;
+                normal[i] = pnormal;
+                friction[i] = patch->m_friction;
+            }
+        }
+    }
+}
+
 bool RigidTerrain::BoxPatch::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
     // Ray definition (in global frame)
     ChVector<> A = loc;                        // start point
@@ -654,6 +755,15 @@ bool RigidTerrain::BoxPatch::FindPoint(const ChVector<>& loc, double& height, Ch
 }
 
 bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    if (m_hfield) {
+        ChVector<> normal_iso;
+        int found = m_hfield->FindPoint(ChWorldFrame::ToISO(loc), height, normal_iso);
+        if (found >= 0) {
+            normal = ChWorldFrame::FromISO(normal_iso);
+            return found == 1;
+        }
+    }
+
     ChVector<> from = loc;
     ChVector<> to = loc - (m_radius + 1000) * ChWorldFrame::Vertical();
 
@@ -665,6 +775,347 @@ bool RigidTerrain::MeshPatch::FindPoint(const ChVector<>& loc, double& height, C
     return result.hit;
 }
 
+// -----------------------------------------------------------------------------
+// Cached height fields for mesh patches
+// -----------------------------------------------------------------------------
+
+void RigidTerrain::EnableHeightFieldCache(HeightFieldType type, double resolution, const std::string& cache_dir) {
+    if (type != HeightFieldType::NONE && resolution <= 0) {
+        std::cerr << "RigidTerrain::EnableHeightFieldCache - invalid resolution " << resolution << std::endl;
+        return;
+    }
+    m_hfield_type = type;
+    m_hfield_resolution = resolution;
+    m_hfield_cache_dir = cache_dir;
+}
+
+// FNV-1a hash of a block of memory.
+static uint64_t HashBytes(const void* data, size_t size, uint64_t hash) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void RigidTerrain::MeshPatch::CreateHeightField(HeightFieldType type,
+                                                double resolution,
+                                                const std::string& cache_dir) {
+    // Collect the mesh triangles, expressed in the ISO frame
+    const auto& coords = m_trimesh->getCoordsVertices();
+    const auto& indices = m_trimesh->getIndicesVertexes();
+    std::vector<ChVector<>> vertices;
+    vertices.reserve(3 * indices.size());
+    for (const auto& tri : indices) {
+        for (int k = 0; k < 3; k++)
+            vertices.push_back(ChWorldFrame::ToISO(m_body->TransformPointLocalToParent(coords[tri[k]])));
+    }
+
+    m_hfield = chrono_types::make_unique<HeightField>();
+
+    // Try loading a height field for the same triangles and settings from the cache directory
+    std::string filename;
+    if (!cache_dir.empty()) {
+        uint64_t hash = 14695981039346656037ULL;
+        hash = HashBytes(&type, sizeof(type), hash);
+        hash = HashBytes(&resolution, sizeof(resolution), hash);
+        hash = HashBytes(vertices.data(), vertices.size() * sizeof(ChVector<>), hash);
+        char hash_str[17];
+        std::snprintf(hash_str, sizeof(hash_str), "%016llx", (unsigned long long)hash);
+        filename = cache_dir + "/" + m_mesh_name + "_" + hash_str + ".hfc";
+        if (m_hfield->Load(filename, type, resolution))
+            return;
+        // Discard any partially loaded data and rebuild the height field
+        m_hfield = chrono_types::make_unique<HeightField>();
+    }
+
+    m_hfield->Build(type, resolution, vertices);
+
+    if (!filename.empty()) {
+        filesystem::create_subdirectory(filesystem::path(cache_dir));
+        if (!m_hfield->Save(filename))
+            std::cerr << "RigidTerrain: cannot write height field cache file " << filename << std::endl;
+    }
+}
+
+// Barycentric coordinates of the point (x,y) with respect to the horizontal projection of the triangle (v0,v1,v2).
+// Return false if the projected triangle is degenerate (vertical).
+static bool Barycentric(const ChVector<>& v0,
+                        const ChVector<>& v1,
+                        const ChVector<>& v2,
+                        double x,
+                        double y,
+                        double& a,
+                        double& b,
+                        double& c) {
+    double det = (v1.y() - v2.y()) * (v0.x() - v2.x()) + (v2.x() - v1.x()) * (v0.y() - v2.y());
+    if (std::abs(det) < 1e-14)
+        return false;
+    a = ((v1.y() - v2.y()) * (x - v2.x()) + (v2.x() - v1.x()) * (y - v2.y())) / det;
+    b = ((v2.y() - v0.y()) * (x - v2.x()) + (v0.x() - v2.x()) * (y - v2.y())) / det;
+    c = 1 - a - b;
+    return true;
+}
+
+// Upward unit normal of the triangle (v0,v1,v2).
+static ChVector<> UpwardNormal(const ChVector<>& v0, const ChVector<>& v1, const ChVector<>& v2) {
+    ChVector<> n = Vcross(v1 - v0, v2 - v0);
+    if (n.z() < 0)
+        n = -n;
+    return n.GetNormalized();
+}
+
+void RigidTerrain::HeightField::Build(HeightFieldType type,
+                                      double resolution,
+                                      const std::vector<ChVector<>>& vertices) {
+    m_type = type;
+    m_delta = resolution;
+
+    // Grid extent
+    double xmin = std::numeric_limits<double>::max();
+    double ymin = std::numeric_limits<double>::max();
+    double xmax = std::numeric_limits<double>::lowest();
+    double ymax = std::numeric_limits<double>::lowest();
+    for (const auto& v : vertices) {
+        xmin = std::min(xmin, v.x());
+        ymin = std::min(ymin, v.y());
+        xmax = std::max(xmax, v.x());
+        ymax = std::max(ymax, v.y());
+    }
+    m_x0 = std::floor(xmin / m_delta) * m_delta;
+    m_y0 = std::floor(ymin / m_delta) * m_delta;
+    m_nx = (int)std::ceil((xmax - m_x0) / m_delta) + 1;
+    m_ny = (int)std::ceil((ymax - m_y0) / m_delta) + 1;
+
+    size_t num_tris = vertices.size() / 3;
+
+    // Range of grid indices covered by the horizontal bounding box of a triangle
+    auto range = [this](const ChVector<>* v, int& i0, int& i1, int& j0, int& j1, bool nodes) {
+        double x0 = std::min({v[0].x(), v[1].x(), v[2].x()});
+        double x1 = std::max({v[0].x(), v[1].x(), v[2].x()});
+        double y0 = std::min({v[0].y(), v[1].y(), v[2].y()});
+        double y1 = std::max({v[0].y(), v[1].y(), v[2].y()});
+        if (nodes) {
+            i0 = (int)std::ceil((x0 - m_x0) / m_delta);
+            j0 = (int)std::ceil((y0 - m_y0) / m_delta);
+        } else {
+            i0 = (int)std::floor((x0 - m_x0) / m_delta);
+            j0 = (int)std::floor((y0 - m_y0) / m_delta);
+        }
+        i1 = (int)std::floor((x1 - m_x0) / m_delta);
+        j1 = (int)std::floor((y1 - m_y0) / m_delta);
+        i0 = std::max(i0, 0);
+        j0 = std::max(j0, 0);
+        i1 = std::min(i1, m_nx - 1);
+        j1 = std::min(j1, m_ny - 1);
+    };
+
+    if (type == HeightFieldType::GRID) {
+        // Rasterize all triangles at the grid nodes, keeping the highest surface
+        m_heights.assign((size_t)m_nx * m_ny, std::numeric_limits<float>::quiet_NaN());
+        m_normals.assign(3 * (size_t)m_nx * m_ny, 0.0f);
+        for (size_t it = 0; it < num_tris; it++) {
+            const ChVector<>* v = &vertices[3 * it];
+            int i0, i1, j0, j1;
+            range(v, i0, i1, j0, j1, true);
+            ChVector<> n = UpwardNormal(v[0], v[1], v[2]);
+            for (int j = j0; j <= j1; j++) {
+                for (int i = i0; i <= i1; i++) {
+                    double a, b, c;
+                    if (!Barycentric(v[0], v[1], v[2], m_x0 + i * m_delta, m_y0 + j * m_delta, a, b, c))
+                        continue;
+                    if (a < -1e-9 || b < -1e-9 || c < -1e-9)
+                        continue;
+                    float z = (float)(a * v[0].z() + b * v[1].z() + c * v[2].z());
+                    size_t k = (size_t)j * m_nx + i;
+                    if (std::isnan(m_heights[k]) || z > m_heights[k]) {
+                        m_heights[k] = z;
+                        m_normals[3 * k + 0] = (float)n.x();
+                        m_normals[3 * k + 1] = (float)n.y();
+                        m_normals[3 * k + 2] = (float)n.z();
+                    }
+                }
+            }
+        }
+    } else {
+        // Bin the triangles in the grid cells (conservatively, based on their bounding boxes)
+        m_nx = std::max(m_nx - 1, 1);
+        m_ny = std::max(m_ny - 1, 1);
+        size_t num_cells = (size_t)m_nx * m_ny;
+        m_vertices = vertices;
+        m_cell_start.assign(num_cells + 1, 0);
+        for (size_t it = 0; it < num_tris; it++) {
+            int i0, i1, j0, j1;
+            range(&vertices[3 * it], i0, i1, j0, j1, false);
+            for (int j = j0; j <= j1; j++)
+                for (int i = i0; i <= i1; i++)
+                    m_cell_start[(size_t)j * m_nx + i + 1]++;
+        }
+        for (size_t k = 0; k < num_cells; k++)
+            m_cell_start[k + 1] += m_cell_start[k];
+        m_cell_tris.resize(m_cell_start[num_cells]);
+        std::vector<unsigned int> fill(m_cell_start.begin(), m_cell_start.end() - 1);
+        for (size_t it = 0; it < num_tris; it++) {
+            int i0, i1, j0, j1;
+            range(&vertices[3 * it], i0, i1, j0, j1, false);
+            for (int j = j0; j <= j1; j++)
+                for (int i = i0; i <= i1; i++)
+                    m_cell_tris[fill[(size_t)j * m_nx + i]++] = (unsigned int)it;
+        }
+    }
+}
+
+int RigidTerrain::HeightField::FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    double x = (loc.x() - m_x0) / m_delta;
+    double y = (loc.y() - m_y0) / m_delta;
+    if (x < 0 || y < 0)
+        return -1;
+    int i = (int)x;
+    int j = (int)y;
+
+    if (m_type == HeightFieldType::GRID) {
+        // Bilinear interpolation of the node values (the last row and column are cell upper corners only)
+        if (i >= m_nx - 1 || j >= m_ny - 1)
+            return -1;
+        size_t k[4] = {(size_t)j * m_nx + i, (size_t)j * m_nx + i + 1, (size_t)(j + 1) * m_nx + i,
+                       (size_t)(j + 1) * m_nx + i + 1};
+        for (int c = 0; c < 4; c++) {
+            if (std::isnan(m_heights[k[c]]))
+                return -1;
+        }
+        double fx = x - i;
+        double fy = y - j;
+        double w[4] = {(1 - fx) * (1 - fy), fx * (1 - fy), (1 - fx) * fy, fx * fy};
+        height = 0;
+        normal = VNULL;
+        for (int c = 0; c < 4; c++) {
+            height += w[c] * m_heights[k[c]];
+            normal += w[c] * ChVector<>(m_normals[3 * k[c] + 0], m_normals[3 * k[c] + 1], m_normals[3 * k[c] + 2]);
+        }
+        normal.Normalize();
+
+        // Only the highest surface is stored. A query point below it may be above another (lower) surface, so let the
+        // caller cast a ray in that case.
+        if (height > loc.z())
+            return -1;
+        return 1;
+    }
+
+    // Exact search of the highest triangle below the query point
+    if (i >= m_nx || j >= m_ny)
+        return -1;
+    size_t cell = (size_t)j * m_nx + i;
+    bool hit = false;
+    for (unsigned int p = m_cell_start[cell]; p < m_cell_start[cell + 1]; p++) {
+        const ChVector<>* v = &m_vertices[3 * (size_t)m_cell_tris[p]];
+        double a, b, c;
+        if (!Barycentric(v[0], v[1], v[2], loc.x(), loc.y(), a, b, c))
+            continue;
+        if (a < -1e-9 || b < -1e-9 || c < -1e-9)
+            continue;
+        double z = a * v[0].z() + b * v[1].z() + c * v[2].z();
+        if (z > loc.z() || (hit && z <= height))
+            continue;
+        height = z;
+        normal = UpwardNormal(v[0], v[1], v[2]);
+        hit = true;
+    }
+
+    return hit ? 1 : 0;
+}
+
+// Cache file layout: header (magic, version, type, grid parameters, array sizes) followed by the raw arrays.
+static const char hfield_magic[4] = {'C', 'H', 'H', 'F'};
+static const int32_t hfield_version = 1;
+
+template <typename T>
+static void WriteArray(std::ofstream& ofile, const std::vector<T>& v) {
+    uint64_t n = v.size();
+    ofile.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    ofile.write(reinterpret_cast<const char*>(v.data()), n * sizeof(T));
+}
+
+template <typename T>
+static bool ReadArray(std::ifstream& ifile, std::vector<T>& v) {
+    uint64_t n = 0;
+    ifile.read(reinterpret_cast<char*>(&n), sizeof(n));
+    if (!ifile)
+        return false;
+    // Do not trust the array size before checking it against the remaining file size
+    auto pos = ifile.tellg();
+    ifile.seekg(0, std::ios::end);
+    uint64_t remaining = (uint64_t)(ifile.tellg() - pos);
+    ifile.seekg(pos);
+    if (n > remaining / sizeof(T))
+        return false;
+    v.resize(n);
+    ifile.read(reinterpret_cast<char*>(v.data()), n * sizeof(T));
+    return (bool)ifile;
+}
+
+bool RigidTerrain::HeightField::Save(const std::string& filename) const {
+    std::ofstream ofile(filename, std::ios::binary);
+    if (!ofile)
+        return false;
+    int32_t type = (int32_t)m_type;
+    int32_t nx = m_nx;
+    int32_t ny = m_ny;
+    ofile.write(hfield_magic, sizeof(hfield_magic));
+    ofile.write(reinterpret_cast<const char*>(&hfield_version), sizeof(hfield_version));
+    ofile.write(reinterpret_cast<const char*>(&type), sizeof(type));
+    ofile.write(reinterpret_cast<const char*>(&m_x0), sizeof(m_x0));
+    ofile.write(reinterpret_cast<const char*>(&m_y0), sizeof(m_y0));
+    ofile.write(reinterpret_cast<const char*>(&m_delta), sizeof(m_delta));
+    ofile.write(reinterpret_cast<const char*>(&nx), sizeof(nx));
+    ofile.write(reinterpret_cast<const char*>(&ny), sizeof(ny));
+    WriteArray(ofile, m_heights);
+    WriteArray(ofile, m_normals);
+    WriteArray(ofile, m_cell_start);
+    WriteArray(ofile, m_cell_tris);
+    WriteArray(ofile, m_vertices);
+    return (bool)ofile;
+}
+
+bool RigidTerrain::HeightField::Load(const std::string& filename, HeightFieldType type, double resolution) {
+    std::ifstream ifile(filename, std::ios::binary);
+    if (!ifile)
+        return false;
+    char magic[4];
+    int32_t version, ftype, nx, ny;
+    ifile.read(magic, sizeof(magic));
+    ifile.read(reinterpret_cast<char*>(&version), sizeof(version));
+    ifile.read(reinterpret_cast<char*>(&ftype), sizeof(ftype));
+    if (!ifile || !std::equal(magic, magic + 4, hfield_magic) || version != hfield_version || ftype != (int32_t)type)
+        return false;
+    ifile.read(reinterpret_cast<char*>(&m_x0), sizeof(m_x0));
+    ifile.read(reinterpret_cast<char*>(&m_y0), sizeof(m_y0));
+    ifile.read(reinterpret_cast<char*>(&m_delta), sizeof(m_delta));
+    ifile.read(reinterpret_cast<char*>(&nx), sizeof(nx));
+    ifile.read(reinterpret_cast<char*>(&ny), sizeof(ny));
+    if (!ifile || m_delta != resolution || nx <= 0 || ny <= 0)
+        return false;
+    m_type = type;
+    m_nx = nx;
+    m_ny = ny;
+    if (!ReadArray(ifile, m_heights) || !ReadArray(ifile, m_normals) || !ReadArray(ifile, m_cell_start) ||
+        !ReadArray(ifile, m_cell_tris) || !ReadArray(ifile, m_vertices))
+        return false;
+
+    // Consistency checks (a corrupted or stale file must not lead to out-of-range accesses in FindPoint)
+    size_t num_nodes = (size_t)m_nx * m_ny;
+    if (m_type == HeightFieldType::GRID)
+        return m_heights.size() == num_nodes && m_normals.size() == 3 * num_nodes;
+    if (m_cell_start.size() != num_nodes + 1 || m_cell_start.front() != 0 || m_cell_tris.size() != m_cell_start.back())
+        return false;
+    if (!std::is_sorted(m_cell_start.begin(), m_cell_start.end()))
+        return false;
+    if (m_vertices.size() % 3 != 0)
+        return false;
+    size_t num_tris = m_vertices.size() / 3;
+    return std::all_of(m_cell_tris.begin(), m_cell_tris.end(), [num_tris](unsigned int t) { return t < num_tris; });
+}
+
 // -----------------------------------------------------------------------------
 // Export all patch meshes
 // -----------------------------------------------------------------------------
@@ -19,6 +19,7 @@
 #ifndef RIGID_TERRAIN_H
 #define RIGID_TERRAIN_H
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -53,6 +54,13 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         HEIGHT_MAP  ///< triangular mesh (generated from a gray-scale heightmap image)
     };
 
+    /// Type of cached height field for mesh and height-map patches.
+    enum class HeightFieldType {
+        NONE,      ///< no cache (terrain queries cast rays into the patch collision model)
+        GRID,      ///< regular grid of heights and normals (approximate queries, with bilinear interpolation)
+        TRIANGLES  ///< regular grid of lists of mesh triangles (exact queries)
+    };
+
     /// Definition of a patch in a rigid terrain model.
     class CH_VEHICLE_API Patch {
       public:
@@ -143,6 +151,23 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         bool visualization = true                     ///< [in] enable/disable construction of visualization assets
     );
 
+    /// Enable a cached height field for the mesh and height-map patches added after this call (default: NONE).
+    /// The height field is a 2.5D acceleration structure over a regular grid with the specified resolution in the
+    /// horizontal plane of the world frame, built when the patch is added. It turns a terrain query into a grid lookup,
+    /// instead of a ray cast into the patch collision model:
+    /// - GRID: heights and normals are stored at the grid nodes and bilinearly interpolated. The accuracy is controlled
+    ///   by the grid resolution. Only the highest surface is stored, so queries from below that surface (e.g., under an
+    ///   overhang) fall back to ray casting.
+    /// - TRIANGLES: each grid cell stores the list of overlapping mesh triangles and queries are exact.
+    /// Queries outside the grid (or near the mesh boundary, for GRID) fall back to ray casting. Both types return the
+    /// first surface point below the query location, as ray casting does.
+    /// If a cache directory is specified, the height field is saved in a binary file in that directory and loaded back
+    /// (instead of being rebuilt) for subsequent patches with the same mesh, position, and cache settings.
+    void EnableHeightFieldCache(HeightFieldType type,               ///< [in] type of cached height field
+                                double resolution,                  ///< [in] grid resolution
+                                const std::string& cache_dir = ""  ///< [in] directory for cache files
+    );
+
     /// Initialize all defined terrain patches.
     void Initialize();
 
@@ -190,6 +215,17 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
                                ChVector<>& normal,
                                float& friction) const override;
 
+    /// Get the terrain heights below the specified locations.
+    /// Batched version of GetHeight (see FindPoints).
+    virtual void GetHeightBatch(const std::vector<ChVector<>>& loc, std::vector<double>& height) const override;
+
+    /// Get all terrain characteristics at the points below the specified locations.
+    /// Batched version of GetProperties (see FindPoints).
+    virtual void GetPropertiesBatch(const std::vector<ChVector<>>& loc,
+                                    std::vector<double>& height,
+                                    std::vector<ChVector<>>& normal,
+                                    std::vector<float>& friction) const override;
+
     /// Export all patch meshes as macros in PovRay include files.
     void ExportMeshPovray(const std::string& out_dir, bool smoothed = false);
 
@@ -202,6 +238,16 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     /// heigh=0, normal=world vertical, and friction=0.8).
     bool FindPoint(const ChVector<> loc, double& height, ChVector<>& normal, float& friction) const;
 
+    /// Find the terrain height, normal, and coefficient of friction at the points below the specified locations.
+    /// Batched version of FindPoint. The patches are processed in turn, each for all query points, and points outside
+    /// the horizontal footprint of a patch bounding sphere are discarded before casting any ray into that patch.
+    /// On return, 'hit' indicates for each point whether the ray intersection succeeded.
+    void FindPoints(const std::vector<ChVector<>>& loc,
+                    std::vector<double>& height,
+                    std::vector<ChVector<>>& normal,
+                    std::vector<float>& friction,
+                    std::vector<bool>& hit) const;
+
     /// Set common collision family for patches. Default: 14.
     /// Collision is disabled with all other objects in this family.
     void SetCollisionFamily(int family) { m_collision_family = family; }
@@ -218,11 +264,42 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
     };
 
+    /// Cached height field for a mesh patch.
+    /// All data is expressed in the ISO frame associated with the world frame (see ChWorldFrame).
+    struct HeightField {
+        HeightFieldType m_type;  ///< type of height field (GRID or TRIANGLES)
+        double m_x0;             ///< x coordinate of grid origin
+        double m_y0;             ///< y coordinate of grid origin
+        double m_delta;          ///< grid resolution
+        int m_nx;                ///< number of grid nodes (GRID) or cells (TRIANGLES) in x direction
+        int m_ny;                ///< number of grid nodes (GRID) or cells (TRIANGLES) in y direction
+
+        std::vector<float> m_heights;  ///< GRID: node heights (NaN if no mesh below node)
+        std::vector<float> m_normals;  ///< GRID: node normals (3 values per node)
+
+        std::vector<unsigned int> m_cell_start;  ///< TRIANGLES: start of each cell in the list of triangles
+        std::vector<unsigned int> m_cell_tris;   ///< TRIANGLES: triangles overlapping each cell
+        std::vector<ChVector<>> m_vertices;      ///< TRIANGLES: triangle vertices (3 per triangle)
+
+        /// Build the height field from the given triangles (3 vertices per triangle).
+        void Build(HeightFieldType type, double resolution, const std::vector<ChVector<>>& vertices);
+
+        /// Find the terrain height and normal below the given location (all in ISO frame).
+        /// Return 1 if a point was found, 0 if there is no mesh below the location, and -1 if the height field cannot
+        /// answer the query (in which case the caller must fall back to ray casting).
+        int FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const;
+
+        bool Save(const std::string& filename) const;
+        bool Load(const std::string& filename, HeightFieldType type, double resolution);
+    };
+
     /// Patch represented as a mesh.
     struct CH_VEHICLE_API MeshPatch : public Patch {
         std::shared_ptr<geometry::ChTriangleMeshConnected> m_trimesh;  ///< associated mesh (contact and visualization)
         std::shared_ptr<geometry::ChTriangleMeshSoup> m_trimesh_s;     ///< associated contact mesh soup
         std::string m_mesh_name;                                       ///< name of associated mesh
+        std::unique_ptr<HeightField> m_hfield;                         ///< optional cached height field
+        void CreateHeightField(HeightFieldType type, double resolution, const std::string& cache_dir);
         virtual void Initialize() override;
         virtual bool FindPoint(const ChVector<>& loc, double& height, ChVector<>& normal) const override;
         virtual void ExportMeshPovray(const std::string& out_dir, bool smoothed = false) override;
@@ -233,6 +310,9 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
     bool m_use_friction_functor;
+    HeightFieldType m_hfield_type;
+    double m_hfield_resolution;
+    std::string m_hfield_cache_dir;
     std::shared_ptr<ChContactContainer::AddContactCallback> m_contact_callback;
 
     void AddPatch(std::shared_ptr<Patch> patch,
@@ -17,6 +17,8 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cassert>
 #include <cstdio>
 #include <cmath>
 #include <queue>
@@ -75,6 +77,12 @@ float SCMTerrain::GetCoefficientFriction(const ChVector<>& loc) const {
     return m_friction_fun ? (*m_friction_fun)(loc) : 0.8f;
 }
 
+// Get all terrain characteristics at the point below the specified location.
+void SCMTerrain::GetProperties(const ChVector<>& loc, double& height, ChVector<>& normal, float& friction) const {
+    m_loader->GetHeightNormal(loc, height, normal);
+    friction = m_friction_fun ? (*m_friction_fun)(loc) : 0.8f;
+}
+
 // Get SCM information at the node closest to the specified location.
 SCMTerrain::NodeInfo SCMTerrain::GetNodeInfo(const ChVector<>& loc) const {
     return m_loader->GetNodeInfo(loc);
@@ -174,6 +182,10 @@ double SCMTerrain::GetTestHeight() const {
     return m_loader->m_test_offset_up;
 }
 
+void SCMTerrain::SetContactDetectionType(ContactDetectionType type) {
+    m_loader->m_contact_detection = type;
+}
+
 // Set the color plot type.
 void SCMTerrain::SetPlotType(DataPlotType plot_type, double min_val, double max_val) {
     m_loader->m_plot_type = plot_type;
@@ -306,6 +318,8 @@ void SCMTerrain::PrintStepStatistics(std::ostream& os) const {
     os << "   Number ray hits:         " << m_loader->m_num_ray_hits << std::endl;
     os << "   Number contact patches:  " << m_loader->m_num_contact_patches << std::endl;
     os << "   Number erosion nodes:    " << m_loader->m_num_erosion_nodes << std::endl;
+    os << "   Number modified nodes:   " << m_loader->m_grid.size() << std::endl;
+    os << "   Number grid tiles:       " << m_loader->m_grid.GetNumTiles() << std::endl;
 }
 
 // -----------------------------------------------------------------------------
@@ -364,6 +378,9 @@ SCMLoader::SCMLoader(ChSystem* system, bool visualization_mesh) : m_soil_fun(nul
     m_test_offset_up = 0.1;
     m_test_offset_down = 0.5;
 
+    m_contact_detection = SCMTerrain::ContactDetectionType::RAY_CASTING;
+    m_raster_stamp = 0;
+
     m_moving_patch = false;
 }
 
@@ -377,6 +394,9 @@ void SCMLoader::Initialize(double sizeX, double sizeY, double delta) {
     m_delta = sizeX / (2 * m_nx);   // grid spacing
     m_area = std::pow(m_delta, 2);  // area of a cell
 
+    // Tiled storage for modified grid nodes
+    m_grid.Initialize(m_nx, m_ny);
+
     // Return now if no visualization
     if (!m_trimesh_shape)
         return;
@@ -413,6 +433,9 @@ void SCMLoader::Initialize(const std::string& heightmap_file,
     m_delta = sizeX / (2.0 * m_nx);                           // grid spacing
     m_area = std::pow(m_delta, 2);                            // area of a cell
 
+    // Tiled storage for modified grid nodes
+    m_grid.Initialize(m_nx, m_ny);
+
     double dx_grid = 0.5 / m_nx;
     double dy_grid = 0.5 / m_ny;
 
@@ -511,6 +534,9 @@ void SCMLoader::Initialize(const std::string& mesh_file, double delta) {
     m_ny = static_cast<int>(std::ceil((sizeY / 2) / delta));  // number of divisions in Y direction
     m_delta = sizeX / (2.0 * m_nx);                           // grid spacing
     m_area = std::pow(m_delta, 2);                            // area of a cell
+
+    // Tiled storage for modified grid nodes
+    m_grid.Initialize(m_nx, m_ny);
     int nvx = 2 * m_nx + 1;                                   // number of grid vertices in X direction
     int nvy = 2 * m_ny + 1;                                   // number of grid vertices in Y direction
 
@@ -667,6 +693,100 @@ bool SCMLoader::CheckMeshBounds(const ChVector2<int>& loc) const {
     return loc.x() >= -m_nx && loc.x() <= m_nx && loc.y() >= -m_ny && loc.y() <= m_ny;
 }
 
+// -----------------------------------------------------------------------------
+// Tiled storage for node records
+// -----------------------------------------------------------------------------
+
+SCMLoader::NodeGrid::NodeGrid() : m_dir_min(0, 0), m_dir_nx(0), m_dir_ny(0), m_size(0) {}
+
+void SCMLoader::NodeGrid::Initialize(int nx, int ny) {
+    clear();
+    m_dir_min = TileCoords(ChVector2<int>(-nx, -ny));
+    ChVector2<int> dir_max = TileCoords(ChVector2<int>(nx, ny));
+    m_dir_nx = dir_max.x() - m_dir_min.x() + 1;
+    m_dir_ny = dir_max.y() - m_dir_min.y() + 1;
+    m_directory.assign((size_t)m_dir_nx * m_dir_ny, nullptr);
+}
+
+void SCMLoader::NodeGrid::clear() {
+    std::fill(m_directory.begin(), m_directory.end(), nullptr);
+    m_outer.clear();
+    m_tiles.clear();
+    m_size = 0;
+}
+
+SCMLoader::NodeGrid::Tile* SCMLoader::NodeGrid::GetTile(const ChVector2<int>& t) const {
+    int ix = t.x() - m_dir_min.x();
+    int iy = t.y() - m_dir_min.y();
+    if (ix >= 0 && ix < m_dir_nx && iy >= 0 && iy < m_dir_ny)
+        return m_directory[ix + (size_t)m_dir_nx * iy];
+
+    auto p = m_outer.find(t);
+    return (p == m_outer.end()) ? nullptr : p->second;
+}
+
+SCMLoader::NodeGrid::Tile* SCMLoader::NodeGrid::GetOrAddTile(const ChVector2<int>& t) {
+    Tile* tile = GetTile(t);
+    if (tile)
+        return tile;
+
+    m_tiles.push_back(std::unique_ptr<Tile>(new Tile));
+    tile = m_tiles.back().get();
+    tile->origin = ChVector2<int>(t.x() * TILE_SIZE, t.y() * TILE_SIZE);
+    tile->records.resize(TILE_SIZE * TILE_SIZE);
+    tile->used.resize(TILE_SIZE * TILE_SIZE, 0);
+
+    int ix = t.x() - m_dir_min.x();
+    int iy = t.y() - m_dir_min.y();
+    if (ix >= 0 && ix < m_dir_nx && iy >= 0 && iy < m_dir_ny)
+        m_directory[ix + (size_t)m_dir_nx * iy] = tile;
+    else
+        m_outer.insert(std::make_pair(t, tile));
+
+    return tile;
+}
+
+SCMLoader::NodeRecord* SCMLoader::NodeGrid::find(const ChVector2<int>& ij) {
+    Tile* tile = GetTile(TileCoords(ij));
+    if (!tile)
+        return nullptr;
+    int k = NodeIndex(ij);
+    return tile->used[k] ? &tile->records[k] : nullptr;
+}
+
+const SCMLoader::NodeRecord* SCMLoader::NodeGrid::find(const ChVector2<int>& ij) const {
+    const Tile* tile = GetTile(TileCoords(ij));
+    if (!tile)
+        return nullptr;
+    int k = NodeIndex(ij);
+    return tile->used[k] ? &tile->records[k] : nullptr;
+}
+
+SCMLoader::NodeRecord& SCMLoader::NodeGrid::at(const ChVector2<int>& ij) {
+    auto nr = find(ij);
+    assert(nr);
+    return *nr;
+}
+
+const SCMLoader::NodeRecord& SCMLoader::NodeGrid::at(const ChVector2<int>& ij) const {
+    auto nr = find(ij);
+    assert(nr);
+    return *nr;
+}
+
+std::pair<SCMLoader::NodeRecord*, bool> SCMLoader::NodeGrid::insert(const ChVector2<int>& ij, const NodeRecord& nr) {
+    Tile* tile = GetOrAddTile(TileCoords(ij));
+    int k = NodeIndex(ij);
+    if (tile->used[k])
+        return std::make_pair(&tile->records[k], false);
+    tile->records[k] = nr;
+    tile->used[k] = 1;
+    m_size++;
+    return std::make_pair(&tile->records[k], true);
+}
+
+// -----------------------------------------------------------------------------
+
 SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector<>& loc) const {
     SCMTerrain::NodeInfo ni;
 
@@ -678,16 +798,15 @@ SCMTerrain::NodeInfo SCMLoader::GetNodeInfo(const ChVector<>& loc) const {
     int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
     ChVector2<int> ij(i, j);
 
-    // First query the hash-map
-    auto p = m_grid_map.find(ij);
-    if (p != m_grid_map.end()) {
-        ni.sinkage = p->second.sinkage;
-        ni.sinkage_plastic = p->second.sinkage_plastic;
-        ni.sinkage_elastic = p->second.sinkage_elastic;
-        ni.sigma = p->second.sigma;
-        ni.sigma_yield = p->second.sigma_yield;
-        ni.kshear = p->second.kshear;
-        ni.tau = p->second.tau;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid.find(ij)) {
+        ni.sinkage = nr->sinkage;
+        ni.sinkage_plastic = nr->sinkage_plastic;
+        ni.sinkage_elastic = nr->sinkage_elastic;
+        ni.sigma = nr->sigma;
+        ni.sigma_yield = nr->sigma_yield;
+        ni.kshear = nr->kshear;
+        ni.tau = nr->tau;
         return ni;
     }
 
@@ -771,10 +890,9 @@ ChVector<> SCMLoader::GetInitNormal(const ChVector2<int>& loc) const {
 
 // Get the terrain height (relative to the SCM plane) at the specified grid vertex.
 double SCMLoader::GetHeight(const ChVector2<int>& loc) const {
-    // First query the hash-map
-    auto p = m_grid_map.find(loc);
-    if (p != m_grid_map.end())
-        return p->second.level;
+    // First query the grid of modified nodes
+    if (auto nr = m_grid.find(loc))
+        return nr->level;
 
     // Else return undeformed height
     return GetInitHeight(loc);
@@ -858,6 +976,23 @@ ChVector<> SCMLoader::GetNormal(const ChVector<>& loc) const {
     return ChWorldFrame::FromISO(nrm_abs);
 }
 
+// Get the terrain height and normal below the specified location.
+void SCMLoader::GetHeightNormal(const ChVector<>& loc, double& height, ChVector<>& normal) const {
+    // Express location in the SCM frame
+    ChVector<> loc_loc = m_plane.TransformPointParentToLocal(loc);
+
+    // Get height and normal (relative to SCM plane) at closest grid vertex (approximation)
+    int i = static_cast<int>(std::round(loc_loc.x() / m_delta));
+    int j = static_cast<int>(std::round(loc_loc.y() / m_delta));
+    loc_loc.z() = GetHeight(ChVector2<int>(i, j));
+    auto nrm_loc = GetNormal(ChVector2<int>(i, j));
+
+    // Express in global frame
+    ChVector<> loc_abs = m_plane.TransformPointLocalToParent(loc_loc);
+    height = ChWorldFrame::Height(loc_abs);
+    normal = ChWorldFrame::FromISO(m_plane.TransformDirectionLocalToParent(nrm_loc));
+}
+
 // Synchronize information for a moving patch
 void SCMLoader::UpdateMovingPatch(MovingPatchInfo& p, const ChVector<>& Z) {
     ChVector2<> p_min(+std::numeric_limits<double>::max());
@@ -897,6 +1032,8 @@ void SCMLoader::UpdateMovingPatch(MovingPatchInfo& p, const ChVector<>& Z) {
             p.m_range[j * n_x + i] = ChVector2<int>(i + x_min, j + y_min);
         }
     }
+    p.m_range_min = ChVector2<int>(x_min, y_min);
+    p.m_range_max = ChVector2<int>(x_max, y_max);
 
     // Calculate inverse of SCM normal expressed in body frame (for optimization of ray-OBB test)
     ChVector<> dir = p.m_body->TransformDirectionParentToLocal(Z);
@@ -947,6 +1084,8 @@ void SCMLoader::UpdateFixedPatch(MovingPatchInfo& p) {
             p.m_range[j * n_x + i] = ChVector2<int>(i + x_min, j + y_min);
         }
     }
+    p.m_range_min = ChVector2<int>(x_min, y_min);
+    p.m_range_max = ChVector2<int>(x_max, y_max);
 }
 
 // Ray-OBB intersection test
@@ -972,6 +1111,367 @@ bool SCMLoader::RayOBBtest(const MovingPatchInfo& p, const ChVector<>& from, con
     return true;
 }
 
+// Collision shape expressed in the SCM frame, for rasterization over a patch range
+struct ScmShape {
+    ChBody* body;                            // associated rigid body
+    collision::ChCollisionShape::Type type;  // shape type
+    ChVector<> dims;                         // shape half-dimensions (box) or radii (other primitives)
+    ChVector<> q;                            // SCM frame origin, expressed in shape frame
+    ChVector<> ax, ay, az;                   // SCM frame axes, expressed in shape frame
+    ChVector<> v[3];                         // triangle vertices, expressed in SCM frame
+    ChVector2<int> ij_min;                   // lower-left grid node covered by the shape
+    ChVector2<int> ij_max;                   // upper-right grid node covered by the shape
+};
+
+// Clip the interval of a line q + t * a (in shape frame) to the slab |x| <= h.
+static bool ClipSlab(double q, double a, double h, double& t_lo, double& t_hi) {
+    if (std::abs(a) < 1e-12)
+        return std::abs(q) <= h;
+    double t1 = (-h - q) / a;
+    double t2 = (+h - q) / a;
+    t_lo = std::max(t_lo, std::min(t1, t2));
+    t_hi = std::min(t_hi, std::max(t1, t2));
+    return t_lo <= t_hi;
+}
+
+// Clip the interval of a line q + t * a (in scaled shape frame) to the unit ball (q.q = qq, q.a = qa, a.a = aa).
+static bool ClipQuadric(double qq, double qa, double aa, double& t_lo, double& t_hi) {
+    if (aa < 1e-12)
+        return qq <= 1;
+    double disc = qa * qa - aa * (qq - 1);
+    if (disc < 0)
+        return false;
+    double sdisc = std::sqrt(disc);
+    t_lo = std::max(t_lo, (-qa - sdisc) / aa);
+    t_hi = std::min(t_hi, (-qa + sdisc) / aa);
+    return t_lo <= t_hi;
+}
+
+// Intersect the vertical line through the point (x, y) of the SCM plane with the given shape.
+// On success, [t_lo, t_hi] is the range of SCM heights inside the shape along this line.
+static bool IntersectVertical(const ScmShape& s, double x, double y, double& t_lo, double& t_hi) {
+    t_lo = -std::numeric_limits<double>::max();
+    t_hi = +std::numeric_limits<double>::max();
+
+    if (s.type == collision::ChCollisionShape::Type::TRIANGLE) {
+        // Barycentric coordinates of the point in the triangle projection onto the SCM plane
+        const ChVector<>& v0 = s.v[0];
+        const ChVector<>& v1 = s.v[1];
+        const ChVector<>& v2 = s.v[2];
+        double det = (v1.y() - v2.y()) * (v0.x() - v2.x()) + (v2.x() - v1.x()) * (v0.y() - v2.y());
+        if (std::abs(det) < 1e-16)
+            return false;
+        double w0 = ((v1.y() - v2.y()) * (x - v2.x()) + (v2.x() - v1.x()) * (y - v2.y())) / det;
+        double w1 = ((v2.y() - v0.y()) * (x - v2.x()) + (v0.x() - v2.x()) * (y - v2.y())) / det;
+        double w2 = 1 - w0 - w1;
+        if (w0 < 0 || w1 < 0 || w2 < 0)
+            return false;
+        t_lo = t_hi = w0 * v0.z() + w1 * v1.z() + w2 * v2.z();
+        return true;
+    }
+
+    // Line q + t * a, expressed in the shape frame
+    ChVector<> q = s.q + x * s.ax + y * s.ay;
+    const ChVector<>& a = s.az;
+    const ChVector<>& d = s.dims;
+
+    switch (s.type) {
+        case collision::ChCollisionShape::Type::SPHERE:
+        case collision::ChCollisionShape::Type::ELLIPSOID: {
+            ChVector<> qs = q / d;
+            ChVector<> as = a / d;
+            return ClipQuadric(qs.Length2(), Vdot(qs, as), as.Length2(), t_lo, t_hi);
+        }
+        case collision::ChCollisionShape::Type::BOX:
+            return ClipSlab(q.x(), a.x(), d.x(), t_lo, t_hi) &&  //
+                   ClipSlab(q.y(), a.y(), d.y(), t_lo, t_hi) &&  //
+                   ClipSlab(q.z(), a.z(), d.z(), t_lo, t_hi);
+        case collision::ChCollisionShape::Type::CYLINDER: {
+            double qx = q.x() / d.x(), qz = q.z() / d.z();
+            double ax = a.x() / d.x(), az = a.z() / d.z();
+            return ClipQuadric(qx * qx + qz * qz, qx * ax + qz * az, ax * ax + az * az, t_lo, t_hi) &&
+                   ClipSlab(q.y(), a.y(), d.y(), t_lo, t_hi);
+        }
+        case collision::ChCollisionShape::Type::CAPSULE: {
+            // Union of the cylindrical part and the two end spheres (an interval, since the capsule is convex)
+            double r = d.x();
+            double hl = d.y();
+            bool hit = false;
+            double lo = t_lo;
+            double hi = t_hi;
+            double c_lo = lo, c_hi = hi;
+            double qx = q.x() / r, qz = q.z() / r;
+            double ax = a.x() / r, az = a.z() / r;
+            if (ClipQuadric(qx * qx + qz * qz, qx * ax + qz * az, ax * ax + az * az, c_lo, c_hi) &&
+                ClipSlab(q.y(), a.y(), hl, c_lo, c_hi)) {
+                t_lo = c_lo;
+                t_hi = c_hi;
+                hit = true;
+            }
+            for (int side = -1; side <= 1; side += 2) {
+                ChVector<> qs = (q - ChVector<>(0, side * hl, 0)) / r;
+                ChVector<> as = a / r;
+                double s_lo = lo, s_hi = hi;
+                if (ClipQuadric(qs.Length2(), Vdot(qs, as), as.Length2(), s_lo, s_hi)) {
+                    t_lo = hit ? std::min(t_lo, s_lo) : s_lo;
+                    t_hi = hit ? std::max(t_hi, s_hi) : s_hi;
+                    hit = true;
+                }
+            }
+            return hit;
+        }
+        default:
+            return false;
+    }
+}
+
+// Get the collision geometry of the specified body (extracted from its collision model at first use, and again if
+// the collision model was rebuilt).
+const SCMLoader::RasterBody& SCMLoader::GetRasterBody(ChBody* body) {
+    auto model = body->GetCollisionModel();
+    auto& rb = m_raster_bodies[model.get()];
+    if (rb.stamp == m_raster_stamp)
+        return rb;
+    rb.stamp = m_raster_stamp;
+
+    // The cached geometry is valid if it was extracted from this same model (and not from a destroyed one at the same
+    // address) and if the model still has the same shapes (rebuilding a model creates new shapes)
+    int num_shapes = model->GetNumShapes();
+    bool valid = rb.model.lock() == model && (int)rb.source.size() == num_shapes;
+    for (int i = 0; i < num_shapes && valid; i++)
+        valid = rb.source[i].lock() == model->GetShape(i);
+    if (valid)
+        return rb;
+
+    rb.model = model;
+    rb.source.assign(model->GetShapes().begin(), model->GetShapes().end());
+    rb.supported = true;
+    rb.shapes.clear();
+
+    // Extract rasterizable shapes and accumulate their AABB (in the collision model frame)
+    ChVector<> aabb_min(+std::numeric_limits<double>::max());
+    ChVector<> aabb_max(-std::numeric_limits<double>::max());
+
+    for (int i = 0; i < num_shapes && rb.supported; i++) {
+        auto dims = model->GetShapeDimensions(i);
+
+        RasterShape shape;
+        shape.type = model->GetShape(i)->GetType();
+        ChVector<> hdims;  // half-dimensions of the shape bounding box
+        switch (shape.type) {
+            case collision::ChCollisionShape::Type::SPHERE:
+                rb.supported = dims.size() >= 1;
+                if (rb.supported)
+                    shape.dims = hdims = ChVector<>(dims[0]);
+                break;
+            case collision::ChCollisionShape::Type::ELLIPSOID:
+            case collision::ChCollisionShape::Type::BOX:
+                rb.supported = dims.size() >= 3;
+                if (rb.supported)
+                    shape.dims = hdims = ChVector<>(dims[0], dims[1], dims[2]);
+                break;
+            case collision::ChCollisionShape::Type::CYLINDER:
+                rb.supported = dims.size() >= 3;
+                if (rb.supported)
+                    shape.dims = hdims = ChVector<>(dims[0], dims[2], dims[1]);
+                break;
+            case collision::ChCollisionShape::Type::CAPSULE:
+                rb.supported = dims.size() >= 2;
+                if (rb.supported) {
+                    shape.dims = ChVector<>(dims[0], dims[1], dims[0]);
+                    hdims = ChVector<>(dims[0], dims[1] + dims[0], dims[0]);
+                }
+                break;
+            case collision::ChCollisionShape::Type::TRIANGLE:
+                rb.supported = dims.size() >= 9;
+                if (rb.supported) {
+                    for (int iv = 0; iv < 3; iv++) {
+                        shape.v[iv] = ChVector<>(dims[3 * iv + 0], dims[3 * iv + 1], dims[3 * iv + 2]);
+                        aabb_min = Vmin(aabb_min, shape.v[iv]);
+                        aabb_max = Vmax(aabb_max, shape.v[iv]);
+                    }
+                }
+                break;
+            default:
+                rb.supported = false;
+                break;
+        }
+
+        if (!rb.supported)
+            break;
+
+        if (shape.type != collision::ChCollisionShape::Type::TRIANGLE) {
+            shape.frame = ChFrame<>(model->GetShapePos(i));
+            const ChMatrix33<>& R = shape.frame.GetA();
+            ChVector<> ext = R.cwiseAbs() * hdims.eigen();
+            aabb_min = Vmin(aabb_min, shape.frame.GetPos() - ext);
+            aabb_max = Vmax(aabb_max, shape.frame.GetPos() + ext);
+        }
+
+        rb.shapes.push_back(shape);
+    }
+
+    if (rb.supported && !rb.shapes.empty()) {
+        rb.center = 0.5 * (aabb_min + aabb_max);
+        rb.radius = 0.5 * (aabb_max - aabb_min).Length();
+    }
+
+    return rb;
+}
+
+// Rasterize the collision shapes of all rigid bodies over the range of the specified patch.
+bool SCMLoader::RasterizePatch(const MovingPatchInfo& p, std::vector<HitRecord>& p_hits) {
+    const ChVector2<int>& ij0 = p.m_range_min;
+    int n_x = p.m_range_max.x() - ij0.x() + 1;
+    int n_y = p.m_range_max.y() - ij0.y() + 1;
+    if (n_x <= 0 || n_y <= 0)
+        return true;
+
+    // Patch range in the SCM plane
+    double x_min = ij0.x() * m_delta;
+    double y_min = ij0.y() * m_delta;
+    double x_max = p.m_range_max.x() * m_delta;
+    double y_max = p.m_range_max.y() * m_delta;
+
+    ChFrame<> plane_inv = ChFrame<>(m_plane).GetInverse();
+
+    // Collect the collision shapes overlapping the patch range, expressed in the SCM frame
+    std::vector<ScmShape> shapes;
+    for (const auto& body : GetSystem()->Get_bodylist()) {
+        if (!body->GetCollide() || !body->GetCollisionModel() || body->GetCollisionModel()->GetNumShapes() == 0)
+            continue;
+
+        const auto& rb = GetRasterBody(body.get());
+
+        // Collision model frame, expressed in the SCM frame (the Chrono collision system uses the body COG frame)
+        bool cog_frame = body->GetCollisionModel()->GetType() == collision::ChCollisionSystemType::CHRONO;
+        ChFrame<> model_frame = cog_frame ? ChFrame<>(body->GetCoord()) : ChFrame<>(body->GetFrame_REF_to_abs());
+        model_frame = plane_inv * model_frame;
+
+        // Quick rejection of the body bounding sphere
+        ChVector<> c = model_frame.TransformPointLocalToParent(rb.center);
+        if (c.x() + rb.radius < x_min || c.x() - rb.radius > x_max || c.y() + rb.radius < y_min ||
+            c.y() - rb.radius > y_max)
+            continue;
+
+        // Fall back to ray casting if this body has shapes which cannot be rasterized
+        if (!rb.supported)
+            return false;
+
+        for (const auto& rs : rb.shapes) {
+            ScmShape s;
+            s.body = body.get();
+            s.type = rs.type;
+            s.dims = rs.dims;
+
+            // Shape AABB in SCM frame
+            ChVector<> aabb_min;
+            ChVector<> aabb_max;
+            if (rs.type == collision::ChCollisionShape::Type::TRIANGLE) {
+                for (int iv = 0; iv < 3; iv++)
+                    s.v[iv] = model_frame.TransformPointLocalToParent(rs.v[iv]);
+                aabb_min = Vmin(Vmin(s.v[0], s.v[1]), s.v[2]);
+                aabb_max = Vmax(Vmax(s.v[0], s.v[1]), s.v[2]);
+            } else {
+                ChFrame<> shape_frame = model_frame * rs.frame;
+                s.q = shape_frame.TransformPointParentToLocal(VNULL);
+                s.ax = shape_frame.TransformDirectionParentToLocal(VECT_X);
+                s.ay = shape_frame.TransformDirectionParentToLocal(VECT_Y);
+                s.az = shape_frame.TransformDirectionParentToLocal(VECT_Z);
+                ChVector<> hdims = rs.dims;
+                if (rs.type == collision::ChCollisionShape::Type::CAPSULE)
+                    hdims.y() += rs.dims.x();
+                ChVector<> ext = shape_frame.GetA().cwiseAbs() * hdims.eigen();
+                aabb_min = shape_frame.GetPos() - ext;
+                aabb_max = shape_frame.GetPos() + ext;
+            }
+
+            // Range of grid nodes covered by the shape, clipped to the patch range
+            s.ij_min.x() = std::max(static_cast<int>(std::ceil(aabb_min.x() / m_delta)), ij0.x());
+            s.ij_min.y() = std::max(static_cast<int>(std::ceil(aabb_min.y() / m_delta)), ij0.y());
+            s.ij_max.x() = std::min(static_cast<int>(std::floor(aabb_max.x() / m_delta)), p.m_range_max.x());
+            s.ij_max.y() = std::min(static_cast<int>(std::floor(aabb_max.y() / m_delta)), p.m_range_max.y());
+            if (s.ij_min.x() > s.ij_max.x() || s.ij_min.y() > s.ij_max.y())
+                continue;
+
+            shapes.push_back(s);
+        }
+    }
+
+    // Bin shapes by the rows of grid nodes they cover, so that each row can be processed independently
+    std::vector<std::vector<int>> row_shapes(n_y);
+    for (int is = 0; is < (int)shapes.size(); is++) {
+        for (int j = shapes[is].ij_min.y(); j <= shapes[is].ij_max.y(); j++)
+            row_shapes[j - ij0.y()].push_back(is);
+    }
+
+    // Scan-convert shapes row by row, keeping the lowest body surface within the test range at each node
+    std::vector<double> p_level(p_hits.size());
+    std::vector<char> p_skip(p_hits.size());
+    std::vector<double> p_z(p_hits.size(), std::numeric_limits<double>::max());
+    std::vector<ChBody*> p_body(p_hits.size(), nullptr);
+
+    const int nthreads = GetSystem()->GetNumThreadsChrono();
+
+#pragma omp parallel for num_threads(nthreads) schedule(dynamic)
+    for (int j = 0; j < n_y; j++) {
+        if (row_shapes[j].empty())
+            continue;
+
+        double y = (j + ij0.y()) * m_delta;
+
+        // Current node heights along this row (evaluated on demand)
+        for (int i = 0; i < n_x; i++)
+            p_level[j * n_x + i] = std::numeric_limits<double>::quiet_NaN();
+
+        for (int is : row_shapes[j]) {
+            const auto& s = shapes[is];
+            for (int i = s.ij_min.x(); i <= s.ij_max.x(); i++) {
+                double t_lo, t_hi;
+                if (!IntersectVertical(s, i * m_delta, y, t_lo, t_hi))
+                    continue;
+
+                int k = j * n_x + (i - ij0.x());
+                if (std::isnan(p_level[k])) {
+                    p_level[k] = GetHeight(p.m_range[k]);
+                    // Discard nodes whose test ray misses the moving patch OBB (as done for ray casting)
+                    if (m_moving_patch) {
+                        ChVector<> to = m_plane.TransformPointLocalToParent(ChVector<>(i * m_delta, y, p_level[k])) +
+                                        m_Z * m_test_offset_up;
+                        ChVector<> from = to - m_Z * m_test_offset_down;
+                        p_skip[k] = !RayOBBtest(p, from, m_Z);
+                    }
+                }
+                if (p_skip[k])
+                    continue;
+
+                // Test range along the vertical (as for a ray cast from below)
+                double z_to = p_level[k] + m_test_offset_up;
+                double z_from = z_to - m_test_offset_down;
+                if (t_hi < z_from || t_lo > z_to)
+                    continue;
+
+                double z = std::max(t_lo, z_from);
+                if (z < p_z[k]) {
+                    p_z[k] = z;
+                    p_body[k] = s.body;
+                }
+            }
+        }
+    }
+
+    for (int k = 0; k < (int)p_hits.size(); k++) {
+        p_hits[k].contactable = p_body[k];
+        if (!p_body[k])
+            continue;
+        const auto& ij = p.m_range[k];
+        ChVector<> point(ij.x() * m_delta, ij.y() * m_delta, p_z[k]);
+        p_hits[k] = {ij, p_body[k], m_plane.TransformPointLocalToParent(point), -1};
+    }
+
+    return true;
+}
+
 // Offsets for the 8 neighbors of a grid vertex
 static const std::vector<ChVector2<int>> neighbors8{
     ChVector2<int>(-1, -1),  // SW
@@ -991,10 +1491,6 @@ static const std::vector<ChVector2<int>> neighbors4{
     ChVector2<int>(0, 1)    // N
 };
 
-// Default implementation uses Map-Reduce for collecting ray intersection hits.
-// The alternative is to simultaenously load the global map of hits while ray casting (using a critical section).
-////#define RAY_CASTING_WITH_CRITICAL_SECTION
-
 // Reset the list of forces, and fills it with forces from a soil contact model.
 void SCMLoader::ComputeInternalForces() {
     // Initialize list of modified visualization mesh vertices (use any externally modified vertices)
@@ -1004,7 +1500,7 @@ void SCMLoader::ComputeInternalForces() {
     // Reset quantities at grid nodes modified over previous step
     // (required for bulldozing effects and for proper visualization coloring)
     for (const auto& ij : m_modified_nodes) {
-        auto& nr = m_grid_map.at(ij);
+        auto& nr = m_grid.at(ij);
         nr.sigma = 0;
         nr.sinkage_elastic = 0;
         nr.step_plastic_flow = 0;
@@ -1058,115 +1554,62 @@ void SCMLoader::ComputeInternalForces() {
     // Perform ray casting tests
     // -------------------------
 
-    // Information of vertices with ray-cast hits
-    struct HitRecord {
-        ChContactable* contactable;  // pointer to hit object
-        ChVector<> abs_point;        // hit point, expressed in global frame
-        int patch_id;                // index of associated patch id
-    };
-
-    // Hash-map for vertices with ray-cast hits
-    std::unordered_map<ChVector2<int>, HitRecord, CoordHash> hits;
+    // List of vertices with ray-cast hits (the record of a hit node stores its index in this list)
+    std::vector<HitRecord> hits;
 
     m_num_ray_casts = 0;
     m_num_ray_hits = 0;
 
     m_timer_ray_casting.start();
 
-#ifdef RAY_CASTING_WITH_CRITICAL_SECTION
-
-    int nthreads = GetSystem()->GetNumThreadsChrono();
-
-    // Loop through all moving patches (user-defined or default one)
-    for (auto& p : m_patches) {
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            ChVector2<int> ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z;
-    #pragma omp critical(SCM_ray_casting)
-            z = GetHeight(ij);
-
-            ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
-
-            // Create ray at current grid location
-            collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector<> from = to - m_Z * m_test_offset_down;
-
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
-
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
-
-            if (mrayhit_result.hit) {
-    #pragma omp critical(SCM_ray_casting)
-                {
-                    // If this is the first hit from this node, initialize the node record
-                    if (m_grid_map.find(ij) == m_grid_map.end()) {
-                        m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, GetInitNormal(ij))));
-                    }
-
-                    // Add to our map of hits to process
-                    HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                    hits.insert(std::make_pair(ij, record));
-                    m_num_ray_hits++;
-                }
-            }
-        }
-        m_num_ray_casts += num_ray_casts;
-    }
-
-#else
-
-    // Map-reduce approach (to eliminate critical section)
-
     const int nthreads = GetSystem()->GetNumThreadsChrono();
-    std::vector<std::unordered_map<ChVector2<int>, HitRecord, CoordHash>> t_hits(nthreads);
+
+    m_raster_stamp++;
 
     // Loop through all moving patches (user-defined or default one)
     for (auto& p : m_patches) {
         m_timer_ray_testing.start();
 
-        // Loop through all vertices in the patch range
-        int num_ray_casts = 0;
-    #pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
-        for (int k = 0; k < p.m_range.size(); k++) {
-            int t_num = ChOMP::GetThreadNum();
-            ChVector2<int> ij = p.m_range[k];
-
-            // Move from (i, j) to (x, y, z) representation in the world frame
-            double x = ij.x() * m_delta;
-            double y = ij.y() * m_delta;
-            double z = GetHeight(ij);
-
-            ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
+        // Contact detection results for all vertices in the patch range.
+        // Each ray writes only its own entry, so no critical section or merging of per-thread results is needed.
+        std::vector<HitRecord> p_hits(p.m_range.size());
 
-            // Create ray at current grid location
-            collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
-            ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
-            ChVector<> from = to - m_Z * m_test_offset_down;
+        // Rasterize collision shapes onto the patch range (if requested and possible)
+        bool rasterized = false;
+        if (m_contact_detection == SCMTerrain::ContactDetectionType::RASTERIZATION)
+            rasterized = RasterizePatch(p, p_hits);
 
-            // Ray-OBB test (quick rejection)
-            if (m_moving_patch && !RayOBBtest(p, from, m_Z))
-                continue;
+        // Otherwise, loop through all vertices in the patch range
+        int num_ray_casts = 0;
+        if (!rasterized) {
+#pragma omp parallel for num_threads(nthreads) reduction(+ : num_ray_casts)
+            for (int k = 0; k < p.m_range.size(); k++) {
+                ChVector2<int> ij = p.m_range[k];
+                p_hits[k].contactable = nullptr;
+
+                // Move from (i, j) to (x, y, z) representation in the world frame
+                double x = ij.x() * m_delta;
+                double y = ij.y() * m_delta;
+                double z = GetHeight(ij);
+
+                ChVector<> vertex_abs = m_plane.TransformPointLocalToParent(ChVector<>(x, y, z));
+
+                // Create ray at current grid location
+                collision::ChCollisionSystem::ChRayhitResult mrayhit_result;
+                ChVector<> to = vertex_abs + m_Z * m_test_offset_up;
+                ChVector<> from = to - m_Z * m_test_offset_down;
+
+                // Ray-OBB test (quick rejection)
+                if (m_moving_patch && !RayOBBtest(p, from, m_Z))
+                    continue;
 
-            // Cast ray into collision system
-            GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
-            num_ray_casts++;
+                // Cast ray into collision system
+                GetSystem()->GetCollisionSystem()->RayHit(from, to, mrayhit_result);
+                num_ray_casts++;
 
-            if (mrayhit_result.hit) {
-                // Add to our map of hits to process
-                HitRecord record = {mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
-                t_hits[t_num].insert(std::make_pair(ij, record));
+                if (mrayhit_result.hit) {
+                    p_hits[k] = {ij, mrayhit_result.hitModel->GetContactable(), mrayhit_result.abs_hitPoint, -1};
+                }
             }
         }
 
@@ -1174,24 +1617,31 @@ void SCMLoader::ComputeInternalForces() {
 
         m_num_ray_casts += num_ray_casts;
 
-        // Sequential insertion in global hits
-        for (int t_num = 0; t_num < nthreads; t_num++) {
-            for (auto& h : t_hits[t_num]) {
-                // If this is the first hit from this node, initialize the node record
-                if (m_grid_map.find(h.first) == m_grid_map.end()) {
-                    double z = GetInitHeight(h.first);
-                    m_grid_map.insert(std::make_pair(h.first, NodeRecord(z, z, GetInitNormal(h.first))));
-                }
-                ////hits.insert(h);
+        // Sequential collection of hits (a node covered by multiple patches is only recorded once, for its lowest hit)
+        for (const auto& h : p_hits) {
+            if (!h.contactable)
+                continue;
+            // If this is the first hit from this node, initialize the node record
+            double z = GetInitHeight(h.ij);
+            auto& nr = *m_grid.insert(h.ij, NodeRecord(z, z, GetInitNormal(h.ij))).first;
+            if (nr.hit_id != -1) {
+                if (Vdot(h.abs_point - hits[nr.hit_id].abs_point, m_Z) < 0)
+                    hits[nr.hit_id] = h;
+                continue;
             }
-
-            hits.insert(t_hits[t_num].begin(), t_hits[t_num].end());
-            t_hits[t_num].clear();
+            nr.hit_id = (int)hits.size();
+            hits.push_back(h);
         }
         m_num_ray_hits = (int)hits.size();
     }
 
-#endif
+    // Evict the collision geometry of bodies which were not rasterized at this step (e.g., removed from the system)
+    for (auto it = m_raster_bodies.begin(); it != m_raster_bodies.end();) {
+        if (it->second.stamp != m_raster_stamp)
+            it = m_raster_bodies.erase(it);
+        else
+            ++it;
+    }
 
     m_timer_ray_casting.stop();
 
@@ -1215,13 +1665,13 @@ void SCMLoader::ComputeInternalForces() {
     // Use a queue-based flood-filling algorithm based on the neighbors of each hit node.
     m_num_contact_patches = 0;
     for (auto& h : hits) {
-        if (h.second.patch_id != -1)
+        if (h.patch_id != -1)
             continue;
 
-        ChVector2<int> ij = h.first;
+        ChVector2<int> ij = h.ij;
 
         // Make a new contact patch and add this hit node to it
-        h.second.patch_id = m_num_contact_patches++;
+        h.patch_id = m_num_contact_patches++;
         ContactPatchRecord patch;
         patch.nodes.push_back(ij);
         patch.points.push_back(ChVector2<>(m_delta * ij.x(), m_delta * ij.y()));
@@ -1231,24 +1681,24 @@ void SCMLoader::ComputeInternalForces() {
         todo.push(ij);
 
         while (!todo.empty()) {
-            auto crt = hits.find(todo.front());  // Current hit node is first element in queue
-            todo.pop();                          // Remove first element from queue
+            ChVector2<int> crt_ij = todo.front();  // Current hit node is first element in queue
+            todo.pop();                            // Remove first element from queue
 
-            ChVector2<int> crt_ij = crt->first;
-            int crt_patch = crt->second.patch_id;
+            int crt_patch = h.patch_id;
 
             // Loop through the neighbors of the current hit node
             for (int k = 0; k < 4; k++) {
                 ChVector2<int> nbr_ij = crt_ij + neighbors4[k];
                 // If neighbor is not a hit node, move on
-                auto nbr = hits.find(nbr_ij);
-                if (nbr == hits.end())
+                auto nbr_nr = m_grid.find(nbr_ij);
+                if (!nbr_nr || nbr_nr->hit_id == -1)
                     continue;
                 // If neighbor already assigned to a contact patch, move on
-                if (nbr->second.patch_id != -1)
+                auto& nbr = hits[nbr_nr->hit_id];
+                if (nbr.patch_id != -1)
                     continue;
                 // Assign neighbor to the same contact patch
-                nbr->second.patch_id = crt_patch;
+                nbr.patch_id = crt_patch;
                 // Add neighbor point to patch lists
                 patch.nodes.push_back(nbr_ij);
                 patch.points.push_back(ChVector2<>(m_delta * nbr_ij.x(), m_delta * nbr_ij.y()));
@@ -1292,14 +1742,16 @@ void SCMLoader::ComputeInternalForces() {
 
     // Process only hit nodes
     for (auto& h : hits) {
-        ChVector2<> ij = h.first;
+        ChVector2<> ij = h.ij;
 
-        auto& nr = m_grid_map.at(ij);      // node record
+        auto& nr = m_grid.at(h.ij);        // node record
         const double& ca = nr.normal.z();  // cosine of angle between local normal and SCM plane vertical
 
-        ChContactable* contactable = h.second.contactable;
-        const ChVector<>& hit_point_abs = h.second.abs_point;
-        int patch_id = h.second.patch_id;
+        ChContactable* contactable = h.contactable;
+        const ChVector<>& hit_point_abs = h.abs_point;
+        int patch_id = h.patch_id;
+
+        nr.hit_id = -1;  // reset for next step
 
         auto hit_point_loc = m_plane.TransformPointParentToLocal(hit_point_abs);
 
@@ -1454,7 +1906,7 @@ void SCMLoader::ComputeInternalForces() {
             // Calculate the displaced material from all touched nodes and identify boundary
             double tot_step_flow = 0;
             for (const auto& ij : p.nodes) {                     // for each node in contact patch
-                const auto& nr = m_grid_map.at(ij);              //   get node record
+                const auto& nr = m_grid.at(ij);                  //   get node record
                 if (nr.sigma <= 0)                               //   if node not touched
                     continue;                                    //     skip (not in effective patch)
                 tot_step_flow += nr.step_plastic_flow;           //   accumulate displaced material
@@ -1462,9 +1914,10 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //     neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                     //     if neighbor out of bounds
                     ////    continue;                                     //       skip neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end())  //     if neighbor not yet recorded
+                    auto nbr_nr = m_grid.find(nbr_ij);                //     neighbor record
+                    if (!nbr_nr)                                      //     if neighbor not yet recorded
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
-                    else if (m_grid_map.at(nbr_ij).sigma <= 0)        //     if neighbor not touched
+                    else if (nbr_nr->sigma <= 0)                      //     if neighbor not touched
                         p_boundary.insert(nbr_ij);                    //       set neighbor as boundary
                 }
             }
@@ -1476,13 +1929,14 @@ void SCMLoader::ComputeInternalForces() {
             // Raise boundary (create a sharp spike which will be later smoothed out with erosion)
             for (const auto& ij : p_boundary) {                                  // for each node in bndry
                 m_modified_nodes.push_back(ij);                                  //   mark as modified
-                if (m_grid_map.find(ij) == m_grid_map.end()) {                   //   if not yet recorded
+                auto nr_ptr = m_grid.find(ij);                                   //   node record
+                if (!nr_ptr) {                                                   //   if not yet recorded
                     double z = GetInitHeight(ij);                                //     undeformed height
                     const ChVector<>& n = GetInitNormal(ij);                     //     terrain normal
-                    m_grid_map.insert(std::make_pair(ij, NodeRecord(z, z, n)));  //     add new node record
+                    nr_ptr = m_grid.insert(ij, NodeRecord(z, z, n)).first;       //     add new node record
                     m_modified_nodes.push_back(ij);                              //     mark as modified
                 }                                                                //
-                auto& nr = m_grid_map.at(ij);                                    //   node record
+                auto& nr = *nr_ptr;                                              //   node record
                 nr.erosion = true;                                               //   add to erosion domain
                 AddMaterialToNode(diff, nr);                                     //   add raise amount
             }
@@ -1506,16 +1960,17 @@ void SCMLoader::ComputeInternalForces() {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];  //   neighbor node coordinates
                     ////if (!CheckMeshBounds(nbr_ij))                       //   if out of bounds
                     ////    continue;                                       //     ignore neighbor
-                    if (m_grid_map.find(nbr_ij) == m_grid_map.end()) {  //   if neighbor not yet recorded
+                    auto nbr_nr = m_grid.find(nbr_ij);                  //   neighbor record
+                    if (!nbr_nr) {                                      //   if neighbor not yet recorded
                         double z = GetInitHeight(nbr_ij);               //     undeformed height at neighbor location
                         const ChVector<>& n = GetInitNormal(nbr_ij);    //     terrain normal at neighbor location
                         NodeRecord nr(z, z, n);                         //     create new record
                         nr.erosion = true;                              //     include in erosion domain
-                        m_grid_map.insert(std::make_pair(nbr_ij, nr));  //     add new node record
+                        m_grid.insert(nbr_ij, nr);                      //     add new node record
                         front.insert(nbr_ij);                           //     add neighbor to new front
                         m_modified_nodes.push_back(nbr_ij);             //     mark as modified
                     } else {                                            //   if neighbor previously recorded
-                        NodeRecord& nr = m_grid_map.at(nbr_ij);         //     get existing record
+                        NodeRecord& nr = *nbr_nr;                       //     get existing record
                         if (!nr.erosion && nr.sigma <= 0) {             //     if neighbor not touched
                             nr.erosion = true;                          //       include in erosion domain
                             front.insert(nbr_ij);                       //       add neighbor to new front
@@ -1536,13 +1991,13 @@ void SCMLoader::ComputeInternalForces() {
 
         for (int iter = 0; iter < m_erosion_iterations; iter++) {
             for (const auto& ij : erosion_domain) {
-                auto& nr = m_grid_map.at(ij);
+                auto& nr = m_grid.at(ij);
                 for (int k = 0; k < 4; k++) {
                     ChVector2<int> nbr_ij = ij + neighbors4[k];
-                    auto rec = m_grid_map.find(nbr_ij);
-                    if (rec == m_grid_map.end())
+                    auto rec = m_grid.find(nbr_ij);
+                    if (!rec)
                         continue;
-                    auto& nbr_nr = rec->second;
+                    auto& nbr_nr = *rec;
 
                     // (3.1) Flow remaining material to neighbor
                     double diff = 0.5 * (nr.massremainder - nbr_nr.massremainder) / 4;  //// TODO: rethink this!
@@ -1587,7 +2042,7 @@ void SCMLoader::ComputeInternalForces() {
         for (const auto& ij : m_modified_nodes) {
             if (!CheckMeshBounds(ij))                 // if node outside mesh
                 continue;                             //   do nothing
-            const auto& nr = m_grid_map.at(ij);       // grid node record
+            const auto& nr = m_grid.at(ij);           // grid node record
             int iv = GetMeshVertexIndex(ij);          // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);  // update vertex coordinates and color
             modified_vertices.push_back(iv);          // cache in list of modified mesh vertices
@@ -1710,14 +2165,14 @@ void SCMLoader::UpdateMeshVertexNormal(const ChVector2<int> ij, int iv) {
 std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) const {
     std::vector<SCMTerrain::NodeLevel> nodes;
     if (all_nodes) {
-        for (const auto& nr : m_grid_map) {
-            nodes.push_back(std::make_pair(nr.first, nr.second.level));
-        }
+        m_grid.for_each([&nodes](const ChVector2<int>& ij, const NodeRecord& nr) {
+            nodes.push_back(std::make_pair(ij, nr.level));
+        });
     } else {
         for (const auto& ij : m_modified_nodes) {
-            auto rec = m_grid_map.find(ij);
-            assert(rec != m_grid_map.end());
-            nodes.push_back(std::make_pair(ij, rec->second.level));
+            auto rec = m_grid.find(ij);
+            assert(rec);
+            nodes.push_back(std::make_pair(ij, rec->level));
         }
     }
     return nodes;
@@ -1728,8 +2183,11 @@ std::vector<SCMTerrain::NodeLevel> SCMLoader::GetModifiedNodes(bool all_nodes) c
 //       As such, some plot types may be incorrect at these nodes.
 void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes) {
     for (const auto& n : nodes) {
-        // Modify existing entry in grid map or insert new one
-        m_grid_map[n.first] = SCMLoader::NodeRecord(n.second, n.second, GetInitNormal(n.first));
+        // Modify existing node record or insert new one
+        SCMLoader::NodeRecord nr(n.second, n.second, GetInitNormal(n.first));
+        auto rec = m_grid.insert(n.first, nr);
+        if (!rec.second)
+            *rec.first = nr;
     }
 
     // Update visualization
@@ -1738,7 +2196,7 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
             auto ij = n.first;                           // grid location
             if (!CheckMeshBounds(ij))                    // if outside mesh
                 continue;                                //   do nothing
-            const auto& nr = m_grid_map.at(ij);          // grid node record
+            const auto& nr = m_grid.at(ij);              // grid node record
             int iv = GetMeshVertexIndex(ij);             // mesh vertex index
             UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
             if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
@@ -1748,5 +2206,104 @@ void SCMLoader::SetModifiedNodes(const std::vector<SCMTerrain::NodeLevel>& nodes
     }
 }
 
+// -----------------------------------------------------------------------------
+
+void SCMLoader::CheckpointOut(ChCheckpointOut& cp) {
+    cp.Write((uint64_t)m_grid.size());
+    m_grid.for_each([&cp](const ChVector2<int>& ij, const NodeRecord& nr) {
+        cp.Write(ij.x());
+        cp.Write(ij.y());
+        cp.Write(nr.level_initial);
+        cp.Write(nr.level);
+        cp.Write(nr.hit_level);
+        cp.Write(nr.normal.x());
+        cp.Write(nr.normal.y());
+        cp.Write(nr.normal.z());
+        cp.Write(nr.sinkage);
+        cp.Write(nr.sinkage_plastic);
+        cp.Write(nr.sinkage_elastic);
+        cp.Write(nr.sigma);
+        cp.Write(nr.sigma_yield);
+        cp.Write(nr.kshear);
+        cp.Write(nr.tau);
+        cp.Write((uint8_t)nr.erosion);
+        cp.Write(nr.massremainder);
+        cp.Write(nr.step_plastic_flow);
+        cp.Write(nr.hit_id);
+    });
+
+    cp.Write((uint64_t)m_modified_nodes.size());
+    for (const auto& ij : m_modified_nodes) {
+        cp.Write(ij.x());
+        cp.Write(ij.y());
+    }
+}
+
+void SCMLoader::CheckpointIn(ChCheckpointIn& cp) {
+    // Nodes recorded before restoring (the corresponding mesh vertices may have to be reset)
+    std::vector<ChVector2<int>> old_nodes;
+    if (m_trimesh_shape)
+        m_grid.for_each([&old_nodes](const ChVector2<int>& ij, const NodeRecord& nr) { old_nodes.push_back(ij); });
+
+    // Insert the node records in the order in which they were written (this reproduces the order of their tiles)
+    m_grid.clear();
+    uint64_t num_nodes;
+    cp.Read(num_nodes);
+    for (uint64_t k = 0; k < num_nodes; k++) {
+        ChVector2<int> ij;
+        NodeRecord nr;
+        uint8_t erosion;
+        cp.Read(ij.x());
+        cp.Read(ij.y());
+        cp.Read(nr.level_initial);
+        cp.Read(nr.level);
+        cp.Read(nr.hit_level);
+        cp.Read(nr.normal.x());
+        cp.Read(nr.normal.y());
+        cp.Read(nr.normal.z());
+        cp.Read(nr.sinkage);
+        cp.Read(nr.sinkage_plastic);
+        cp.Read(nr.sinkage_elastic);
+        cp.Read(nr.sigma);
+        cp.Read(nr.sigma_yield);
+        cp.Read(nr.kshear);
+        cp.Read(nr.tau);
+        cp.Read(erosion);
+        cp.Read(nr.massremainder);
+        cp.Read(nr.step_plastic_flow);
+        cp.Read(nr.hit_id);
+        nr.erosion = (erosion != 0);
+        m_grid.insert(ij, nr);
+    }
+
+    uint64_t num_modified;
+    cp.Read(num_modified);
+    m_modified_nodes.resize(num_modified);
+    for (auto& ij : m_modified_nodes) {
+        cp.Read(ij.x());
+        cp.Read(ij.y());
+    }
+
+    // Update visualization
+    if (m_trimesh_shape) {
+        auto update_vertex = [this](const ChVector2<int>& ij, const NodeRecord& nr) {
+            if (!CheckMeshBounds(ij))                    // if outside mesh
+                return;                                  //   do nothing
+            int iv = GetMeshVertexIndex(ij);             // mesh vertex index
+            UpdateMeshVertexCoordinates(ij, iv, nr);     // update vertex coordinates and color
+            if (!m_trimesh_shape->IsWireframe())         // if not in wireframe mode
+                UpdateMeshVertexNormal(ij, iv);          //   update vertex normal
+            m_external_modified_vertices.push_back(iv);  // cache in list
+        };
+        for (const auto& ij : old_nodes) {
+            if (!m_grid.find(ij)) {
+                double init_height = GetInitHeight(ij);
+                update_vertex(ij, NodeRecord(init_height, init_height, GetInitNormal(ij)));
+            }
+        }
+        m_grid.for_each(update_vertex);
+    }
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
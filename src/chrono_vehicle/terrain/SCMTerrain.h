@@ -22,7 +22,9 @@
 
 #include <string>
 #include <ostream>
+#include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/assets/ChTriangleMeshShape.h"
 #include "chrono/physics/ChBody.h"
@@ -67,6 +69,12 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
         PLOT_MASSREMAINDER
     };
 
+    /// Method for detecting contact between the SCM grid and collision shapes.
+    enum class ContactDetectionType {
+        RAY_CASTING,   ///< a vertical ray is cast into the collision system at each grid node
+        RASTERIZATION  ///< collision shapes of rigid bodies are rasterized onto the grid
+    };
+
     /// Information at SCM node.
     struct NodeInfo {
         double sinkage;          ///< sinkage, along local normal direction
@@ -133,6 +141,15 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     ///  Return the current test height level.
     double GetTestHeight() const;
 
+    /// Set the method used to detect contact between grid nodes and collision shapes (default: RAY_CASTING).
+    /// With RASTERIZATION, the collision shapes of the rigid bodies in the system are scan-converted onto the SCM
+    /// grid from below, which provides the lowest body surface over each grid node in the test range without casting
+    /// rays. Supported shapes are spheres, ellipsoids, boxes, cylinders, capsules, and triangles (e.g., the faces of a
+    /// triangle mesh with the Chrono collision system). Contact detection falls back to ray casting over any patch
+    /// which overlaps a body with other collision shapes. Note that only rigid bodies (and not FEA contact surfaces)
+    /// are rasterized.
+    void SetContactDetectionType(ContactDetectionType type);
+
     /// Set the color plot type for the soil mesh.
     /// When a scalar plot is used, also define the range in the pseudo-color colormap.
     void SetPlotType(DataPlotType plot_type, double min_val, double max_val);
@@ -148,8 +165,8 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
 
     /// Add a new moving patch.
     /// Multiple calls to this function can be made, each of them adding a new active patch area.
-    /// If no patches are defined, ray-casting is performed for every single node of the underlying SCM grid.
-    /// If at least one patch is defined, ray-casting is performed only for mesh nodes within the AABB of the
+    /// If no patches are defined, contact detection is performed for every single node of the underlying SCM grid.
+    /// If at least one patch is defined, contact detection is performed only for mesh nodes within the AABB of the
     /// body OOBB projection onto the SCM plane.
     void AddMovingPatch(std::shared_ptr<ChBody> body,   ///< [in] monitored body
                         const ChVector<>& OOBB_center,  ///< [in] OOBB center, relative to body
@@ -202,6 +219,14 @@ class CH_VEHICLE_API SCMTerrain : public ChTerrain {
     /// Otherwise, it returns the constant value of 0.8.
     virtual float GetCoefficientFriction(const ChVector<>& loc) const override;
 
+    /// Get all terrain characteristics at the point below the specified location.
+    /// This is more efficient than calling GetHeight, GetNormal, and GetCoefficientFriction separately, as the location
+    /// is mapped to the SCM grid only once.
+    virtual void GetProperties(const ChVector<>& loc,
+                               double& height,
+                               ChVector<>& normal,
+                               float& friction) const override;
+
     /// Get SCM information at the node closest to the specified location.
     NodeInfo GetNodeInfo(const ChVector<>& loc) const;
 
@@ -357,6 +382,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         ChVector<> m_center;                  // OOBB center, relative to body
         ChVector<> m_hdims;                   // OOBB half-dimensions
         std::vector<ChVector2<int>> m_range;  // current grid nodes covered by the patch
+        ChVector2<int> m_range_min;           // current lower-left grid node of the patch range
+        ChVector2<int> m_range_max;           // current upper-right grid node of the patch range
         ChVector<> m_ooN;                     // current inverse of SCM normal in body frame
     };
 
@@ -376,6 +403,7 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         bool erosion;              // for bulldozing
         double massremainder;      // for bulldozing
         double step_plastic_flow;  // for bulldozing
+        int hit_id;                // index in list of ray hits over current step (-1 if no hit)
 
         NodeRecord() : NodeRecord(0, 0, ChVector<>(0, 0, 1)) {}
         ~NodeRecord() {}
@@ -394,7 +422,35 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
               tau(0),
               erosion(false),
               massremainder(0),
-              step_plastic_flow(0) {}
+              step_plastic_flow(0),
+              hit_id(-1) {}
+    };
+
+    // Information of vertices with ray-cast hits
+    struct HitRecord {
+        ChVector2<int> ij;           // grid coordinates of hit node
+        ChContactable* contactable;  // pointer to hit object
+        ChVector<> abs_point;        // hit point, expressed in global frame
+        int patch_id;                // index of associated patch id
+    };
+
+    // Collision shape of a rigid body, for rasterization onto the SCM grid
+    struct RasterShape {
+        collision::ChCollisionShape::Type type;  // shape type
+        ChFrame<> frame;                         // shape frame, relative to the collision model frame
+        ChVector<> dims;                         // shape half-dimensions (box) or radii (other primitives)
+        ChVector<> v[3];                         // triangle vertices, relative to the collision model frame
+    };
+
+    // Collision geometry of a rigid body, extracted at first use and whenever its collision model is rebuilt
+    struct RasterBody {
+        std::weak_ptr<collision::ChCollisionModel> model;                // collision model at extraction
+        std::vector<std::weak_ptr<collision::ChCollisionShape>> source;  // model shapes at extraction
+        int stamp;                        // last step at which the body was rasterized
+        bool supported;                   // true if all collision shapes can be rasterized
+        std::vector<RasterShape> shapes;  // rasterizable collision shapes
+        ChVector<> center;                // center of bounding sphere, relative to the collision model frame
+        double radius;                    // radius of bounding sphere
     };
 
     // Hash function for a pair of integer grid coordinates
@@ -404,6 +460,87 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
         std::size_t operator()(const ChVector2<int>& p) const { return p.x() * 31 + p.y(); }
     };
 
+    // Sparse tiled storage for the records of modified grid nodes.
+    // Grid nodes are grouped in square tiles of TILE_SIZE x TILE_SIZE nodes. The records of all nodes in a tile are
+    // allocated in one contiguous array the first time a node in that tile is recorded, so memory is proportional to
+    // the disturbed terrain area. Tiles are found through a dense directory covering the SCM patch (tiles outside the
+    // patch, if any, are kept in a hash map), so locating a node record requires no hashing of node coordinates and
+    // neighboring nodes in the same tile are adjacent in memory. Node records are never moved once allocated.
+    class NodeGrid {
+      public:
+        NodeGrid();
+
+        // Set the range of grid indices, [-nx, +nx] x [-ny, +ny], covered by the tile directory.
+        // Any existing node records are discarded.
+        void Initialize(int nx, int ny);
+
+        // Return a pointer to the record of the specified node or nullptr if the node was not recorded.
+        NodeRecord* find(const ChVector2<int>& ij);
+        const NodeRecord* find(const ChVector2<int>& ij) const;
+
+        // Return the record of the specified node (which must have been recorded).
+        NodeRecord& at(const ChVector2<int>& ij);
+        const NodeRecord& at(const ChVector2<int>& ij) const;
+
+        // Record the specified node with the given record, unless already recorded.
+        // Return a pointer to the node record and a flag indicating whether a new record was inserted.
+        std::pair<NodeRecord*, bool> insert(const ChVector2<int>& ij, const NodeRecord& nr);
+
+        // Return the number of recorded nodes.
+        size_t size() const { return m_size; }
+
+        // Return the number of allocated tiles.
+        size_t GetNumTiles() const { return m_tiles.size(); }
+
+        // Discard all node records.
+        void clear();
+
+        // Invoke the given function, as f(ij, nr), for each recorded node (in order of allocation of their tiles).
+        template <typename Function>
+        void for_each(Function f) const {
+            for (const auto& tile : m_tiles) {
+                for (int k = 0; k < TILE_SIZE * TILE_SIZE; k++) {
+                    if (tile->used[k])
+                        f(tile->origin + ChVector2<int>(k % TILE_SIZE, k / TILE_SIZE), tile->records[k]);
+                }
+            }
+        }
+
+      private:
+        static const int TILE_BITS = 6;
+        static const int TILE_SIZE = 1 << TILE_BITS;
+
+        struct Tile {
+            ChVector2<int> origin;            // grid coordinates of first node in tile
+            std::vector<NodeRecord> records;  // node records, row-major
+            std::vector<char> used;           // flags for recorded nodes
+        };
+
+        // Tile coordinates of the specified node.
+        static ChVector2<int> TileCoords(const ChVector2<int>& ij) {
+            return ChVector2<int>(ij.x() >> TILE_BITS, ij.y() >> TILE_BITS);
+        }
+
+        // Index of the specified node in its tile.
+        static int NodeIndex(const ChVector2<int>& ij) {
+            return (ij.x() & (TILE_SIZE - 1)) + TILE_SIZE * (ij.y() & (TILE_SIZE - 1));
+        }
+
+        // Return the tile with specified tile coordinates (nullptr if not allocated).
+        Tile* GetTile(const ChVector2<int>& t) const;
+
+        // Return the tile with specified tile coordinates, allocating it if needed.
+        Tile* GetOrAddTile(const ChVector2<int>& t);
+
+        ChVector2<int> m_dir_min;                                      // tile coordinates of first directory entry
+        int m_dir_nx;                                                  // number of directory entries in X direction
+        int m_dir_ny;                                                  // number of directory entries in Y direction
+        std::vector<Tile*> m_directory;                                // directory of tiles covering the SCM patch
+        std::unordered_map<ChVector2<int>, Tile*, CoordHash> m_outer;  // tiles outside the directory range
+        std::vector<std::unique_ptr<Tile>> m_tiles;                    // allocated tiles
+        size_t m_size;                                                 // number of recorded nodes
+    };
+
     // Create visualization mesh
     void CreateVisualizationMesh(double sizeX, double sizeY);
 
@@ -431,6 +568,9 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Get the terrain normal (expressed in World frame) at the point below the specified location.
     ChVector<> GetNormal(const ChVector<>& loc) const;
 
+    // Get the terrain height and normal (expressed in World frame) at the point below the specified location.
+    void GetHeightNormal(const ChVector<>& loc, double& height, ChVector<>& normal) const;
+
     // Get index of trimesh vertex corresponding to the specified grid node.
     int GetMeshVertexIndex(const ChVector2<int>& loc);
 
@@ -446,6 +586,12 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Complete setup before first simulation step.
     virtual void SetupInitial() override;
 
+    // Write the records of all modified grid nodes to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) override;
+
+    // Read the records of all modified grid nodes from a binary checkpoint (replacing any existing records).
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     // Update the forces and the geometry, at the beginning of each timestep.
     virtual void Setup() override {
         ComputeInternalForces();
@@ -470,6 +616,14 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     // Ray-OBB intersection test
     bool RayOBBtest(const MovingPatchInfo& p, const ChVector<>& from, const ChVector<>& Z);
 
+    // Get the collision geometry of the specified body (extracted from its collision model at first use, and again if
+    // the collision model was rebuilt).
+    const RasterBody& GetRasterBody(ChBody* body);
+
+    // Rasterize the collision shapes of all rigid bodies over the range of the specified patch.
+    // Returns false (and no hits) if a body overlapping the patch has collision shapes which cannot be rasterized.
+    bool RasterizePatch(const MovingPatchInfo& p, std::vector<HitRecord>& p_hits);
+
     // Reset the list of forces and fill it with forces from the soil contact model.
     // This is called automatically during timestepping (only at the beginning of each step).
     void ComputeInternalForces();
@@ -512,8 +666,8 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
 
     ChMatrixDynamic<> m_heights;  // (base) grid heights (when initializing from height-field map)
 
-    std::unordered_map<ChVector2<int>, NodeRecord, CoordHash> m_grid_map;  // modified grid nodes (persistent)
-    std::vector<ChVector2<int>> m_modified_nodes;                          // modified grid nodes (current)
+    NodeGrid m_grid;                               // modified grid nodes (persistent)
+    std::vector<ChVector2<int>> m_modified_nodes;  // modified grid nodes (current)
 
     std::vector<MovingPatchInfo> m_patches;  // set of active moving patches
     bool m_moving_patch;                     // user-specified moving patches?
@@ -521,6 +675,10 @@ class CH_VEHICLE_API SCMLoader : public ChLoadContainer {
     double m_test_offset_down;  // offset for ray start
     double m_test_offset_up;    // offset for ray end
 
+    SCMTerrain::ContactDetectionType m_contact_detection;  // contact detection method
+    std::unordered_map<collision::ChCollisionModel*, RasterBody> m_raster_bodies;  // geometry of rasterized bodies
+    int m_raster_stamp;                                                             // current rasterization step
+
     std::shared_ptr<ChTriangleMeshShape> m_trimesh_shape;  // mesh visualization asset
 
     // SCM parameters
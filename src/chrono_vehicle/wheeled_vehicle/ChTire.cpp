@@ -261,26 +261,20 @@ bool ChTire::DiscTerrainCollision4pt(
     longitudinal.Normalize();
     ChVector<> lateral = Vcross(normal, longitudinal);
 
-    // Calculate four contact points in the contact patch
+    // Calculate four contact points in the contact patch (single batched terrain query)
     ChVector<> ptQ1 = wheel_bottom_location + dx * longitudinal;
-    double hQ1 = terrain.GetHeight(ptQ1 + voffset);
-    double ptQ1_height = ChWorldFrame::Height(ptQ1);
-    ptQ1 = ptQ1 - (ptQ1_height - hQ1) * ChWorldFrame::Vertical();
-
     ChVector<> ptQ2 = wheel_bottom_location - dx * longitudinal;
-    double hQ2 = terrain.GetHeight(ptQ2 + voffset);
-    double ptQ2_height = ChWorldFrame::Height(ptQ2);
-    ptQ2 = ptQ2 - (ptQ2_height - hQ2) * ChWorldFrame::Vertical();
-
     ChVector<> ptQ3 = wheel_bottom_location + dy * lateral;
-    double hQ3 = terrain.GetHeight(ptQ3 + voffset);
-    double ptQ3_height = ChWorldFrame::Height(ptQ3);
-    ptQ3 = ptQ3 - (ptQ3_height - hQ3) * ChWorldFrame::Vertical();
-
     ChVector<> ptQ4 = wheel_bottom_location - dy * lateral;
-    double hQ4 = terrain.GetHeight(ptQ4 + voffset);
-    double ptQ4_height = ChWorldFrame::Height(ptQ4);
-    ptQ4 = ptQ4 - (ptQ4_height - hQ4) * ChWorldFrame::Vertical();
+
+    std::vector<ChVector<>> query = {ptQ1 + voffset, ptQ2 + voffset, ptQ3 + voffset, ptQ4 + voffset};
+    std::vector<double> hQ;
+    terrain.GetHeightBatch(query, hQ);
+
+    ptQ1 = ptQ1 - (ChWorldFrame::Height(ptQ1) - hQ[0]) * ChWorldFrame::Vertical();
+    ptQ2 = ptQ2 - (ChWorldFrame::Height(ptQ2) - hQ[1]) * ChWorldFrame::Vertical();
+    ptQ3 = ptQ3 - (ChWorldFrame::Height(ptQ3) - hQ[2]) * ChWorldFrame::Vertical();
+    ptQ4 = ptQ4 - (ChWorldFrame::Height(ptQ4) - hQ[3]) * ChWorldFrame::Vertical();
 
     // Calculate a smoothed road surface normal
     ChVector<> rQ2Q1 = ptQ1 - ptQ2;
@@ -342,13 +336,22 @@ bool ChTire::DiscTerrainCollisionEnvelope(
     ChVector<> longitudinal = Vcross(disc_normal, normal);
     longitudinal.Normalize();
 
+    // Sample the terrain height along the disc (single batched terrain query)
     const size_t n_div = 180;
     double x_step = 2.0 * disc_radius / n_div;
+    std::vector<ChVector<>> query(n_div - 1);
+    for (size_t i = 1; i < n_div; i++) {
+        double x = -disc_radius + x_step * double(i);
+        query[i - 1] = disc_center + x * longitudinal + voffset;
+    }
+    std::vector<double> heights;
+    terrain.GetHeightBatch(query, heights);
+
     double A = 0;  // overlapping area of tire disc and road surface contour
     for (size_t i = 1; i < n_div; i++) {
         double x = -disc_radius + x_step * double(i);
         ChVector<> pTest = disc_center + x * longitudinal;
-        double q = terrain.GetHeight(pTest + voffset);
+        double q = heights[i - 1];
         double a = ChWorldFrame::Height(pTest) - sqrt(disc_radius * disc_radius - x * x);
         if (q > a) {
             A += q - a;
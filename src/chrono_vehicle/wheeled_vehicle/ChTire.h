@@ -27,6 +27,7 @@
 #include "chrono/core/ChVector.h"
 #include "chrono/assets/ChTriangleMeshShape.h"
 #include "chrono/motion_functions/ChFunction_Recorder.h"
+#include "chrono/serialization/ChCheckpoint.h"
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChPart.h"
 #include "chrono_vehicle/ChTerrain.h"
@@ -126,6 +127,14 @@ class CH_VEHICLE_API ChTire : public ChPart {
     /// Advance the state of this tire by the specified time step.
     virtual void Advance(double step) {}
 
+    /// Write the internal state of this tire to a binary checkpoint (see ChWheeledVehicle::SaveTireCheckpoint).
+    /// Only tires with states not included in the underlying Chrono system (e.g., force element tires) write data.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const {}
+
+    /// Read the internal state of this tire from a binary checkpoint.
+    /// This must read exactly the data written by CheckpointOut.
+    virtual void CheckpointIn(ChCheckpointIn& cp) {}
+
   protected:
     /// Construct a tire subsystem with given name.
     ChTire(const std::string& name);
@@ -115,6 +115,61 @@ void ChWheeledVehicle::Advance(double step) {
     ChVehicle::Advance(step);
 }
 
+// -----------------------------------------------------------------------------
+// Checkpointing of the tire states (one block per wheel, empty if the wheel has no tire).
+// -----------------------------------------------------------------------------
+bool ChWheeledVehicle::SaveTireCheckpoint(const std::string& filename) const {
+    ChCheckpointOut cp(filename);
+    if (!cp.IsOpen())
+        return false;
+
+    uint64_t num_wheels = 0;
+    for (auto& axle : m_axles)
+        num_wheels += axle->GetWheels().size();
+    cp.Write(num_wheels);
+
+    for (auto& axle : m_axles) {
+        for (auto& wheel : axle->GetWheels()) {
+            cp.BeginBlock();
+            if (wheel->m_tire)
+                wheel->m_tire->CheckpointOut(cp);
+            cp.EndBlock();
+        }
+    }
+
+    return cp.Close();
+}
+
+bool ChWheeledVehicle::RestoreTireCheckpoint(const std::string& filename) {
+    ChCheckpointIn cp(filename);
+    if (!cp.IsOpen())
+        return false;
+
+    try {
+        uint64_t num_wheels = 0;
+        for (auto& axle : m_axles)
+            num_wheels += axle->GetWheels().size();
+        uint64_t num_wheels_cp;
+        cp.Read(num_wheels_cp);
+        if (num_wheels_cp != num_wheels)
+            throw ChException("Checkpoint data inconsistent with the vehicle (number of wheels)");
+
+        for (auto& axle : m_axles) {
+            for (auto& wheel : axle->GetWheels()) {
+                cp.BeginBlock();
+                if (wheel->m_tire)
+                    wheel->m_tire->CheckpointIn(cp);
+                cp.EndBlock();
+            }
+        }
+    } catch (const ChException& e) {
+        GetLog() << "Cannot restore tire checkpoint " << filename << ": " << e.what() << "\n";
+        return false;
+    }
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // Enable/disable differential locking.
 // -----------------------------------------------------------------------------
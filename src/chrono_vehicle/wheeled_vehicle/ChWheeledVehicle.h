@@ -199,6 +199,16 @@ class CH_VEHICLE_API ChWheeledVehicle : public ChVehicle {
     /// function also advances the state of the associated powertrain and the states of all associated tires.
     virtual void Advance(double step) override final;
 
+    /// Save the internal states of all tires to a binary checkpoint file.
+    /// Tire states are not part of the underlying Chrono system, so this function complements ChSystem::SaveCheckpoint
+    /// and must be called at the same time (between simulation steps). Return false if the file cannot be written.
+    bool SaveTireCheckpoint(const std::string& filename) const;
+
+    /// Restore the internal states of all tires from a binary checkpoint file created with SaveTireCheckpoint.
+    /// The vehicle must have the same wheels and tire types as the one which was checkpointed. Return false if the
+    /// file cannot be read or its data is inconsistent with the vehicle tires.
+    bool RestoreTireCheckpoint(const std::string& filename);
+
     /// Lock/unlock the differential on the specified axle.
     /// By convention, axles are counted front to back, starting with index 0.
     void LockAxleDifferential(int axle, bool lock);
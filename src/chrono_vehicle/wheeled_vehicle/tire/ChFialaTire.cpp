@@ -217,6 +217,34 @@ void ChFialaTire::Advance(double step) {
     m_tireforce.moment = ChVector<>(0, My, Mz);
 }
 
+void ChFialaTire::CheckpointOut(ChCheckpointOut& cp) const {
+    ChForceElementTire::CheckpointOut(cp);
+    cp.Write(m_states.kappa);
+    cp.Write(m_states.alpha);
+    cp.Write(m_states.abs_vx);
+    cp.Write(m_states.abs_vt);
+    cp.Write(m_states.vsx);
+    cp.Write(m_states.vsy);
+    cp.Write(m_states.omega);
+    cp.Write(m_states.Fx_l);
+    cp.Write(m_states.Fy_l);
+    cp.Write(m_states.disc_normal);
+}
+
+void ChFialaTire::CheckpointIn(ChCheckpointIn& cp) {
+    ChForceElementTire::CheckpointIn(cp);
+    cp.Read(m_states.kappa);
+    cp.Read(m_states.alpha);
+    cp.Read(m_states.abs_vx);
+    cp.Read(m_states.abs_vt);
+    cp.Read(m_states.vsx);
+    cp.Read(m_states.vsy);
+    cp.Read(m_states.omega);
+    cp.Read(m_states.Fx_l);
+    cp.Read(m_states.Fy_l);
+    cp.Read(m_states.disc_normal);
+}
+
 void ChFialaTire::CombinedCoulombForces(double& fx, double& fy, double fz, double muscale) {
     ChVector2<> F;
     F.x() = tanh(-2.0 * m_states.vsx) * fz * muscale;
@@ -128,6 +128,12 @@ class CH_VEHICLE_API ChFialaTire : public ChForceElementTire {
     /// Advance the state of this tire by the specified time step.
     virtual void Advance(double step) override;
 
+    /// Write the tire states to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const override;
+
+    /// Read the tire states from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     struct TireStates {
         double kappa;   // Contact Path - Stationary Longitudinal Slip State (Kappa)
         double alpha;   // Contact Path - Stationary Side Slip State (Alpha)
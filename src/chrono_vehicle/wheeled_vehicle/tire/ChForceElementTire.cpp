@@ -76,5 +76,34 @@ TerrainForce ChForceElementTire::ReportTireForce(ChTerrain* terrain, ChCoordsys<
 }
 
 
+void ChForceElementTire::CheckpointOut(ChCheckpointOut& cp) const {
+    cp.Write((uint8_t)m_data.in_contact);
+    cp.Write(m_data.frame.pos);
+    cp.Write(m_data.frame.rot);
+    cp.Write(m_data.vel);
+    cp.Write(m_data.normal_force);
+    cp.Write(m_data.depth);
+
+    // The tire force is applied to the wheel at the next step
+    cp.Write(m_tireforce.force);
+    cp.Write(m_tireforce.point);
+    cp.Write(m_tireforce.moment);
+}
+
+void ChForceElementTire::CheckpointIn(ChCheckpointIn& cp) {
+    uint8_t in_contact;
+    cp.Read(in_contact);
+    m_data.in_contact = in_contact != 0;
+    cp.Read(m_data.frame.pos);
+    cp.Read(m_data.frame.rot);
+    cp.Read(m_data.vel);
+    cp.Read(m_data.normal_force);
+    cp.Read(m_data.depth);
+
+    cp.Read(m_tireforce.force);
+    cp.Read(m_tireforce.point);
+    cp.Read(m_tireforce.moment);
+}
+
 }  // namespace vehicle
 }  // namespace chrono
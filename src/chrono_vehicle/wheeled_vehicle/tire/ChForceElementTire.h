@@ -41,6 +41,13 @@ class CH_VEHICLE_API ChForceElementTire : public ChTire {
     /// If the tire is not in contact, the tire frame is not set and the function returns zero force and moment.
     virtual TerrainForce ReportTireForce(ChTerrain* terrain, ChCoordsys<>& tire_frame) const override;
 
+    /// Write the tire-terrain contact data and the tire force to a binary checkpoint.
+    /// Derived classes must also write their tire states.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const override;
+
+    /// Read the tire-terrain contact data and the tire force from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
   protected:
     struct ContactData {
         bool in_contact;      // true if disc in contact with terrain
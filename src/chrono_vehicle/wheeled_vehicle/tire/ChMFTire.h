@@ -473,6 +473,12 @@ class CH_VEHICLE_API ChMFTire : public ChForceElementTire {
     /// Advance the state of this tire by the specified time step.
     virtual void Advance(double step) override;
 
+    /// Write the tire states to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const override;
+
+    /// Read the tire states from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     struct ContactData {
         bool in_contact;      // true if disc in contact with terrain
         ChCoordsys<> frame;   // contact frame (x: long, y: lat, z: normal)
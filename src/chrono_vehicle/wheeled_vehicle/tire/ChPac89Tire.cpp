@@ -255,6 +255,30 @@ void ChPac89Tire::Advance(double step) {
     m_tireforce.moment = ChVector<>(Mx, -My, -Mz);
 }
 
+void ChPac89Tire::CheckpointOut(ChCheckpointOut& cp) const {
+    ChForceElementTire::CheckpointOut(cp);
+    cp.Write(m_states.cp_long_slip);
+    cp.Write(m_states.cp_side_slip);
+    cp.Write(m_states.vx);
+    cp.Write(m_states.vsx);
+    cp.Write(m_states.vsy);
+    cp.Write(m_states.omega);
+    cp.Write(m_states.R_eff);
+    cp.Write(m_states.disc_normal);
+}
+
+void ChPac89Tire::CheckpointIn(ChCheckpointIn& cp) {
+    ChForceElementTire::CheckpointIn(cp);
+    cp.Read(m_states.cp_long_slip);
+    cp.Read(m_states.cp_side_slip);
+    cp.Read(m_states.vx);
+    cp.Read(m_states.vsx);
+    cp.Read(m_states.vsy);
+    cp.Read(m_states.omega);
+    cp.Read(m_states.R_eff);
+    cp.Read(m_states.disc_normal);
+}
+
 // -----------------------------------------------------------------------------
 
 void ChPac89Tire::AddVisualizationAssets(VisualizationType vis) {
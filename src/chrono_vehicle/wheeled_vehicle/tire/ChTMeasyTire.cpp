@@ -435,6 +435,54 @@ void ChTMeasyTire::Advance(double step) {
     }
 }
 
+void ChTMeasyTire::CheckpointOut(ChCheckpointOut& cp) const {
+    ChForceElementTire::CheckpointOut(cp);
+    cp.Write(m_states.sx);
+    cp.Write(m_states.sy);
+    cp.Write(m_states.vta);
+    cp.Write(m_states.vsx);
+    cp.Write(m_states.vsy);
+    cp.Write(m_states.omega);
+    cp.Write(m_states.R_eff);
+    cp.Write(m_states.Fx_dyn);
+    cp.Write(m_states.Fy_dyn);
+    cp.Write(m_states.Mb_dyn);
+    cp.Write(m_states.xe);
+    cp.Write(m_states.ye);
+    cp.Write(m_states.xe_dot);
+    cp.Write(m_states.ye_dot);
+    cp.Write(m_states.Fx_struct);
+    cp.Write(m_states.Fy_struct);
+    cp.Write(m_states.Fx);
+    cp.Write(m_states.Fy);
+    cp.Write(m_states.Mb);
+    cp.Write(m_states.disc_normal);
+}
+
+void ChTMeasyTire::CheckpointIn(ChCheckpointIn& cp) {
+    ChForceElementTire::CheckpointIn(cp);
+    cp.Read(m_states.sx);
+    cp.Read(m_states.sy);
+    cp.Read(m_states.vta);
+    cp.Read(m_states.vsx);
+    cp.Read(m_states.vsy);
+    cp.Read(m_states.omega);
+    cp.Read(m_states.R_eff);
+    cp.Read(m_states.Fx_dyn);
+    cp.Read(m_states.Fy_dyn);
+    cp.Read(m_states.Mb_dyn);
+    cp.Read(m_states.xe);
+    cp.Read(m_states.ye);
+    cp.Read(m_states.xe_dot);
+    cp.Read(m_states.ye_dot);
+    cp.Read(m_states.Fx_struct);
+    cp.Read(m_states.Fy_struct);
+    cp.Read(m_states.Fx);
+    cp.Read(m_states.Fy);
+    cp.Read(m_states.Mb);
+    cp.Read(m_states.disc_normal);
+}
+
 // -----------------------------------------------------------------------------
 
 double ChTMeasyTire::GetNormalStiffnessForce(double depth) const {
@@ -293,6 +293,12 @@ class CH_VEHICLE_API ChTMeasyTire : public ChForceElementTire {
     /// Advance the state of this tire by the specified time step.
     virtual void Advance(double step) override;
 
+    /// Write the tire states to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const override;
+
+    /// Read the tire states from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     std::vector<double> m_tire_test_defl;  // set, when test data are used for vertical
     std::vector<double> m_tire_test_frc;   // stiffness calculation
 
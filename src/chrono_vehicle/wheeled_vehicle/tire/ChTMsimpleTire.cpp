@@ -193,6 +193,38 @@ void ChTMsimpleTire::Advance(double step) {
     m_tireforce.moment = startup * ChVector<>(Mx, My, Mz);
 }
 
+void ChTMsimpleTire::CheckpointOut(ChCheckpointOut& cp) const {
+    ChForceElementTire::CheckpointOut(cp);
+    cp.Write(m_states.sx);
+    cp.Write(m_states.sy);
+    cp.Write(m_states.vta);
+    cp.Write(m_states.vsx);
+    cp.Write(m_states.vsy);
+    cp.Write(m_states.omega);
+    cp.Write(m_states.R_eff);
+    cp.Write(m_states.P_len);
+    cp.Write(m_states.nL0);
+    cp.Write(m_states.sq0);
+    cp.Write(m_states.sqe);
+    cp.Write(m_states.disc_normal);
+}
+
+void ChTMsimpleTire::CheckpointIn(ChCheckpointIn& cp) {
+    ChForceElementTire::CheckpointIn(cp);
+    cp.Read(m_states.sx);
+    cp.Read(m_states.sy);
+    cp.Read(m_states.vta);
+    cp.Read(m_states.vsx);
+    cp.Read(m_states.vsy);
+    cp.Read(m_states.omega);
+    cp.Read(m_states.R_eff);
+    cp.Read(m_states.P_len);
+    cp.Read(m_states.nL0);
+    cp.Read(m_states.sq0);
+    cp.Read(m_states.sqe);
+    cp.Read(m_states.disc_normal);
+}
+
 void ChTMsimpleTire::CombinedCoulombForces(double& fx, double& fy, double fz, double muscale) {
     ChVector2<> F;
     F.x() = tanh(-2.0 * m_states.vsx / m_vcoulomb) * fz * muscale;
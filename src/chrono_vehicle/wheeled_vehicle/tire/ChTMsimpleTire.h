@@ -214,6 +214,12 @@ class CH_VEHICLE_API ChTMsimpleTire : public ChForceElementTire {
     /// Advance the state of this tire by the specified time step.
     virtual void Advance(double step) override;
 
+    /// Write the tire states to a binary checkpoint.
+    virtual void CheckpointOut(ChCheckpointOut& cp) const override;
+
+    /// Read the tire states from a binary checkpoint.
+    virtual void CheckpointIn(ChCheckpointIn& cp) override;
+
     void TMcombinedForces(double& fx, double& fy, double sx, double sy, double fz, double muscale);
     void CombinedCoulombForces(double& fx, double& fy, double fz, double muscale);
     
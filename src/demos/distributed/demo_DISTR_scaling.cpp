@@ -190,6 +190,7 @@ int main(int argc, char* argv[]) {
     cli.AddOption<double>("Demo", "z,zsize", "Patch dimension in Z direction");
     cli.AddOption<double>("Demo", "t,end_time", "Simulation length");
     cli.AddOption<std::string>("Demo", "o,outdir", "Output directory (must not exist)", "");
+    cli.AddOption<int>("Demo", "b,balance", "Load balancing interval in steps (0 to disable)", "0");
     cli.AddOption<bool>("Demo", "m,perf_mon", "Enable performance monitoring", "false");
     cli.AddOption<bool>("Demo", "v,verbose", "Enable verbose output", "false");
 
@@ -206,6 +207,7 @@ int main(int argc, char* argv[]) {
     const double time_end = cli.GetAsType<double>("end_time");
     std::string outdir = cli.GetAsType<std::string>("outdir");
     const bool output_data = outdir.compare("") != 0;
+    const int balance = cli.GetAsType<int>("balance");
     const bool monitor = cli.GetAsType<bool>("m");
     const bool verbose = cli.GetAsType<bool>("v");
 
@@ -242,6 +244,7 @@ int main(int argc, char* argv[]) {
         std::cout << "Number of threads:          " << num_threads << std::endl;
         std::cout << "Domain:                     " << 2 * hx << " x " << 2 * hy << " x " << 2 * height << std::endl;
         std::cout << "Simulation length:          " << time_end << std::endl;
+        std::cout << "Load balancing interval:    " << balance << std::endl;
         std::cout << "Monitor?                    " << monitor << std::endl;
         std::cout << "Output?                     " << output_data << std::endl;
         if (output_data)
@@ -266,6 +269,7 @@ int main(int argc, char* argv[]) {
     ChVector<double> domhi(hx + spacing, hy + spacing, height + 3.0 * spacing);
     my_sys.GetDomain()->SetSplitAxis(0);  // Split along the x-axis
     my_sys.GetDomain()->SetSimDomain(domlo, domhi);
+    my_sys.GetDomain()->SetLoadBalancing(balance);
 
     if (verbose)
         my_sys.GetDomain()->PrintDomain();
@@ -523,6 +523,34 @@ int main(int argc, char* argv[]) {
                 }
             }
         }
+
+        // Thread scaling study of the internal force assembly (1 to 32 threads, with and without batched element
+        // evaluation) on a larger mesh
+        std::cout << "=====================================" << std::endl;
+        std::cout << "Internal force scaling - Num_Elements: " << 2 * 16 * 16 << std::endl;
+        std::cout << "Batched Threads FEA_InternalFrc_ms Speedup Efficiency" << std::endl;
+        double time_serial = 0;
+        for (int NumThreads = 1; NumThreads <= 32; NumThreads *= 2) {
+            for (bool batched : {false, true}) {
+                ANCFShellTest test(16, SolverType::SparseLU, NumThreads, true);
+                test.GetSystem()->Get_meshlist()[0]->SetBatchedInternalForces(batched);
+                for (int i = 0; i < NUM_SKIP_STEPS; i++)
+                    test.ExecuteStep();
+                for (auto& Mesh : test.GetSystem()->Get_meshlist()) {
+                    Mesh->ResetTimers();
+                    Mesh->ResetCounters();
+                }
+                for (int i = 0; i < NUM_SIM_STEPS; i++)
+                    test.ExecuteStep();
+                double time = 0;
+                for (auto& Mesh : test.GetSystem()->Get_meshlist())
+                    time += Mesh->GetTimeInternalForces();
+                if (NumThreads == 1 && !batched)
+                    time_serial = time;
+                std::cout << batched << " " << NumThreads << " " << time * 1e3 << " " << time_serial / time << " "
+                          << time_serial / (time * NumThreads) << std::endl;
+            }
+        }
     }
 
     return (0);
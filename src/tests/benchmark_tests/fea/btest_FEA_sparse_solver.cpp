@@ -14,7 +14,7 @@
 //
 // Benchmark test for sparse matrix setup (assembly of system matrix).
 // This provides a measure of the effect and performance of using the "sparsity
-// learner".
+// learner" and of the multithreaded assembly of the system matrix.
 //
 // =============================================================================
 
@@ -109,6 +109,8 @@ class SystemFixture : public ::benchmark::Fixture {
         st.counters["LS_Setup_call"] = solver->GetTimeSetup_SolverCall() * 1e3 / num_it;
         st.counters["LS_Solve_assembly"] = solver->GetTimeSolve_Assembly() * 1e3 / num_it;
         st.counters["LS_Solve_call"] = solver->GetTimeSolve_SolverCall() * 1e3 / num_it;
+        st.counters["LS_Analyze_calls"] = solver->GetNumAnalyzeCalls();
+        st.counters["LS_Factorize_calls"] = solver->GetNumFactorizeCalls();
     }
 
   protected:
@@ -175,6 +177,25 @@ class SystemFixture : public ::benchmark::Fixture {
     }                                                                                 \
     BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
 
+// Matrix assembly with the specified number of threads. With the sparsity pattern learner and parallel assembly
+// enabled, the system matrix is assembled in parallel (compare LS_Setup_assembly for 1 and more threads).
+#define BM_ASSEMBLY_QR(TEST_NAME, N, NUM_THREADS)                                     \
+    BENCHMARK_TEMPLATE_DEFINE_F(SystemFixture, TEST_NAME, N)(benchmark::State & st) { \
+        auto solver = chrono_types::make_shared<ChSolverSparseQR>();                  \
+        solver->UseSparsityPatternLearner(true);                                      \
+        solver->UseParallelAssembly(true);                                            \
+        solver->LockSparsityPattern(true);                                            \
+        solver->SetVerbose(false);                                                    \
+        m_system->SetSolver(solver);                                                  \
+        m_system->SetNumThreads(NUM_THREADS);                                         \
+        while (st.KeepRunning()) {                                                    \
+            solver->ForceSparsityPatternUpdate();                                     \
+            m_system->DoStaticLinear();                                               \
+        }                                                                             \
+        Report(st);                                                                   \
+    }                                                                                 \
+    BENCHMARK_REGISTER_F(SystemFixture, TEST_NAME)->Unit(benchmark::kMillisecond);
+
 #ifdef CHRONO_PARDISO_MKL
 BM_SOLVER_MKL(MKL_learner_500, 500, true)
 BM_SOLVER_MKL(MKL_no_learner_500, 500, false)
@@ -225,6 +246,11 @@ BM_SOLVER_QR(QR_no_learner_4000, 4000, false)
 BM_SOLVER_QR(QR_learner_8000, 8000, true)
 BM_SOLVER_QR(QR_no_learner_8000, 8000, false)
 
+BM_ASSEMBLY_QR(QR_assembly_1thread_4000, 4000, 1)
+BM_ASSEMBLY_QR(QR_assembly_4threads_4000, 4000, 4)
+BM_ASSEMBLY_QR(QR_assembly_1thread_8000, 8000, 1)
+BM_ASSEMBLY_QR(QR_assembly_4threads_8000, 8000, 4)
+
 int main(int argc, char* argv[]) {
     ::benchmark::Initialize(&argc, argv);
     ::benchmark::RunSpecifiedBenchmarks();
@@ -99,4 +99,52 @@ BENCHMARK_DEFINE_F(SystemFixture, SingleLoop)(benchmark::State& st) {
 BENCHMARK_REGISTER_F(SystemFixture, SingleLoop)->Unit(benchmark::kMicrosecond);
 ////BENCHMARK_REGISTER_F(SystemFixture, SingleLoop)->Unit(benchmark::kMicrosecond)->Iterations(1);
 
+// Benchmarking fixture for the assembly state functions: create system with the specified number of bodies
+// (range 0) and the specified number of threads (range 1)
+class AssemblyFixture : public ::benchmark::Fixture {
+public:
+    void SetUp(const ::benchmark::State& st) override {
+        const int num_bodies = (int)st.range(0);
+        sys = new ChSystemNSC();
+        sys->SetNumThreads((int)st.range(1));
+        for (int i = 0; i < num_bodies; i++) {
+            auto body = chrono_types::make_shared<ChBody>();
+            body->SetPos(ChVector<>(rand() % 1000 / 1000.0, rand() % 1000 / 1000.0, rand() % 1000 / 1000.0));
+            sys->AddBody(body);
+        }
+        sys->Setup();
+        sys->Update();
+        x.setZero(sys->GetNcoords_x(), sys);
+        v.setZero(sys->GetNcoords_v(), sys);
+        R.setZero(sys->GetNcoords_v());
+    }
+
+    void TearDown(const ::benchmark::State&) override {
+        delete sys;
+    }
+
+    ChSystemNSC* sys;
+    ChState x;
+    ChStateDelta v;
+    ChVectorDynamic<> R;
+};
+
+// Benchmark a timestepper stage: state gather, increment, scatter (with update), and residual loading
+BENCHMARK_DEFINE_F(AssemblyFixture, StateStage)(benchmark::State& st) {
+    double T;
+    for (auto _ : st) {
+        sys->StateGather(x, v, T);
+        sys->StateIncrementX(x, x, v);
+        sys->StateScatter(x, v, T, true);
+        sys->LoadResidual_F(R, 1.0);
+    }
+    st.SetItemsProcessed(st.iterations() * sys->Get_bodylist().size());
+}
+static void AssemblyArgs(benchmark::internal::Benchmark* b) {
+    for (int num_bodies : {100, 1000, 10000, 100000})
+        for (int num_threads : {1, 2, 4, 8})
+            b->Args({num_bodies, num_threads});
+}
+BENCHMARK_REGISTER_F(AssemblyFixture, StateStage)->Unit(benchmark::kMicrosecond)->Apply(AssemblyArgs);
+
 ////BENCHMARK_MAIN();
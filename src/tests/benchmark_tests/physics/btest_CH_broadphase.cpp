@@ -0,0 +1,147 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for the broadphase algorithms of the Chrono collision system.
+// A cluster of small spheres is dropped on a terrain made of large tiles. The
+// ratio between the tile size and the sphere diameter is varied and the grid
+// and BVH broadphase methods are compared (see the CD_Broad counter).
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+#ifdef CHRONO_IRRLICHT
+    #include "chrono_irrlicht/ChVisualSystemIrrlicht.h"
+#endif
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// =============================================================================
+
+template <int RATIO, ChBroadphase::Method METHOD>
+class BroadphaseTest : public utils::ChBenchmarkTest {
+  public:
+    BroadphaseTest();
+    ~BroadphaseTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+
+    void SimulateVis();
+
+  private:
+    ChSystemNSC* m_system;
+    double m_step;
+};
+
+template <int RATIO, ChBroadphase::Method METHOD>
+BroadphaseTest<RATIO, METHOD>::BroadphaseTest() : m_system(new ChSystemNSC()), m_step(1e-3) {
+    m_system->SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(m_system->GetCollisionSystem());
+    collsys->SetBroadphaseMethod(METHOD);
+    collsys->SetEnvelope(0.005);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    // Terrain tiles (4x4), with size RATIO times the sphere diameter
+    double radius = 0.05;
+    double tile_size = RATIO * 2 * radius;
+    for (int ix = 0; ix < 4; ix++) {
+        for (int iz = 0; iz < 4; iz++) {
+            auto tile = chrono_types::make_shared<ChBodyEasyBox>(tile_size, 1.0, tile_size, 1000, true, true, mat);
+            tile->SetPos(ChVector<>((ix - 1.5) * tile_size, -0.5, (iz - 1.5) * tile_size));
+            tile->SetBodyFixed(true);
+            m_system->Add(tile);
+        }
+    }
+
+    // Cluster of 20x20x5 spheres above the center of the terrain
+    double spacing = 2.4 * radius;
+    for (int ix = 0; ix < 20; ix++) {
+        for (int iz = 0; iz < 20; iz++) {
+            for (int iy = 0; iy < 5; iy++) {
+                auto sphere = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, true, true, mat);
+                sphere->SetPos(ChVector<>((ix - 9.5) * spacing, radius + iy * spacing, (iz - 9.5) * spacing));
+                m_system->Add(sphere);
+            }
+        }
+    }
+}
+
+template <int RATIO, ChBroadphase::Method METHOD>
+void BroadphaseTest<RATIO, METHOD>::SimulateVis() {
+#ifdef CHRONO_IRRLICHT
+    // Create the Irrlicht visualization system
+    auto vis = chrono_types::make_shared<irrlicht::ChVisualSystemIrrlicht>();
+    vis->AttachSystem(m_system);
+    vis->SetWindowSize(800, 600);
+    vis->SetWindowTitle("Broadphase test");
+    vis->Initialize();
+    vis->AddLogo();
+    vis->AddSkyBox();
+    vis->AddTypicalLights();
+    vis->AddCamera(ChVector<>(0, 2, -3), ChVector<>(0, 0, 0));
+
+    while (vis->Run()) {
+        vis->BeginScene();
+        vis->Render();
+        ExecuteStep();
+        vis->EndScene();
+    }
+#endif
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 100  // number of steps for hot start
+#define NUM_SIM_STEPS 200   // number of simulation steps for each benchmark
+
+#define BM_BROADPHASE(TEST_NAME, RATIO, METHOD)                                                 \
+    using TEST_NAME = utils::ChBenchmarkFixture<BroadphaseTest<RATIO, METHOD>, NUM_SKIP_STEPS>; \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateLoop)(benchmark::State & st) {                        \
+        while (st.KeepRunning()) {                                                              \
+            m_test->Simulate(NUM_SIM_STEPS);                                                    \
+        }                                                                                       \
+        Report(st);                                                                             \
+    }                                                                                           \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateLoop)->Unit(benchmark::kMillisecond)->Repetitions(5);
+
+BM_BROADPHASE(Broadphase_ratio10_grid, 10, ChBroadphase::Method::GRID)
+BM_BROADPHASE(Broadphase_ratio10_bvh, 10, ChBroadphase::Method::BVH)
+BM_BROADPHASE(Broadphase_ratio100_grid, 100, ChBroadphase::Method::GRID)
+BM_BROADPHASE(Broadphase_ratio100_bvh, 100, ChBroadphase::Method::BVH)
+BM_BROADPHASE(Broadphase_ratio1000_grid, 1000, ChBroadphase::Method::GRID)
+BM_BROADPHASE(Broadphase_ratio1000_bvh, 1000, ChBroadphase::Method::BVH)
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+
+#ifdef CHRONO_IRRLICHT
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        BroadphaseTest<100, ChBroadphase::Method::BVH> test;
+        test.SimulateVis();
+        return 0;
+    }
+#endif
+
+    ::benchmark::RunSpecifiedBenchmarks();
+}
@@ -22,6 +22,8 @@
 #include "chrono/physics/ChSystemNSC.h"
 #include "chrono/physics/ChBodyEasy.h"
 #include "chrono/physics/ChLinkMotorRotationSpeed.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/solver/ChSolverPSSOR.h"
 
 #ifdef CHRONO_IRRLICHT
     #include "chrono_irrlicht/ChVisualSystemIrrlicht.h"
@@ -31,24 +33,59 @@ using namespace chrono;
 
 // =============================================================================
 
-template <int N>
+// Solver used in the mixer test: the system default, or PSOR/PSSOR with serial or parallel (graph-colored) sweeps.
+enum class MixerSolver { DEFAULT, PSOR, PSOR_COLORED, PSSOR, PSSOR_COLORED };
+
+template <int N, MixerSolver SOLVER = MixerSolver::DEFAULT>
 class MixerTestNSC : public utils::ChBenchmarkTest {
   public:
     MixerTestNSC();
     ~MixerTestNSC() { delete m_system; }
 
     ChSystem* GetSystem() override { return m_system; }
-    void ExecuteStep() override { m_system->DoStepDynamics(m_step); }
+    void ExecuteStep() override {
+        m_system->DoStepDynamics(m_step);
+        if (m_solver) {
+            m_num_iterations += m_solver->GetIterations();
+            m_num_steps++;
+        }
+    }
 
     void SimulateVis();
 
+    void ResetIterations() {
+        m_num_iterations = 0;
+        m_num_steps = 0;
+    }
+    double GetAverageIterations() const { return m_num_steps > 0 ? (double)m_num_iterations / m_num_steps : 0; }
+
   private:
     ChSystemNSC* m_system;
+    std::shared_ptr<ChIterativeSolverVI> m_solver;
     double m_step;
+    int m_num_iterations;
+    int m_num_steps;
 };
 
-template <int N>
-MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
+template <int N, MixerSolver SOLVER>
+MixerTestNSC<N, SOLVER>::MixerTestNSC()
+    : m_system(new ChSystemNSC()), m_step(0.02), m_num_iterations(0), m_num_steps(0) {
+    // The default test cases use the default solver settings of the system
+    if (SOLVER == MixerSolver::PSOR || SOLVER == MixerSolver::PSOR_COLORED) {
+        auto solver = chrono_types::make_shared<ChSolverPSOR>();
+        solver->EnableParallelSweep(SOLVER == MixerSolver::PSOR_COLORED);
+        m_solver = solver;
+    } else if (SOLVER == MixerSolver::PSSOR || SOLVER == MixerSolver::PSSOR_COLORED) {
+        auto solver = chrono_types::make_shared<ChSolverPSSOR>();
+        solver->EnableParallelSweep(SOLVER == MixerSolver::PSSOR_COLORED);
+        m_solver = solver;
+    }
+    if (m_solver) {
+        m_solver->SetMaxIterations(100);
+        m_solver->SetTolerance(1e-5);
+        m_system->SetSolver(m_solver);
+    }
+
     auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
 
     for (int bi = 0; bi < N; bi++) {
@@ -101,8 +138,8 @@ MixerTestNSC<N>::MixerTestNSC() : m_system(new ChSystemNSC()), m_step(0.02) {
     m_system->AddLink(motor);
 }
 
-template <int N>
-void MixerTestNSC<N>::SimulateVis() {
+template <int N, MixerSolver SOLVER>
+void MixerTestNSC<N, SOLVER>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     // Create the Irrlicht visualization system
     auto vis = chrono_types::make_shared<irrlicht::ChVisualSystemIrrlicht>();
@@ -132,6 +169,29 @@ void MixerTestNSC<N>::SimulateVis() {
 CH_BM_SIMULATION_LOOP(MixerNSC032, MixerTestNSC<32>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 CH_BM_SIMULATION_LOOP(MixerNSC064, MixerTestNSC<64>,  NUM_SKIP_STEPS, NUM_SIM_STEPS, 10);
 
+// Comparison of serial and parallel (graph-colored) PSOR and PSSOR sweeps.
+// Reports the average number of solver iterations per step in addition to the usual timers.
+#define BM_MIXER_SOLVER(TEST_NAME, N, SOLVER)                                                  \
+    using TEST_NAME = utils::ChBenchmarkFixture<MixerTestNSC<N, SOLVER>, NUM_SKIP_STEPS>; \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateLoop)(benchmark::State & st) {                   \
+        m_test->ResetIterations();                                                         \
+        while (st.KeepRunning()) {                                                         \
+            m_test->Simulate(NUM_SIM_STEPS);                                               \
+        }                                                                                  \
+        Report(st);                                                                        \
+        st.counters["Solver_Iterations"] = m_test->GetAverageIterations();                 \
+    }                                                                                      \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateLoop)->Unit(benchmark::kMillisecond)->Repetitions(10);
+
+BM_MIXER_SOLVER(MixerNSC128_PSOR_serial, 128, MixerSolver::PSOR)
+BM_MIXER_SOLVER(MixerNSC128_PSOR_colored, 128, MixerSolver::PSOR_COLORED)
+BM_MIXER_SOLVER(MixerNSC256_PSOR_serial, 256, MixerSolver::PSOR)
+BM_MIXER_SOLVER(MixerNSC256_PSOR_colored, 256, MixerSolver::PSOR_COLORED)
+BM_MIXER_SOLVER(MixerNSC128_PSSOR_serial, 128, MixerSolver::PSSOR)
+BM_MIXER_SOLVER(MixerNSC128_PSSOR_colored, 128, MixerSolver::PSSOR_COLORED)
+BM_MIXER_SOLVER(MixerNSC256_PSSOR_serial, 256, MixerSolver::PSSOR)
+BM_MIXER_SOLVER(MixerNSC256_PSSOR_colored, 256, MixerSolver::PSSOR_COLORED)
+
 // =============================================================================
 
 int main(int argc, char* argv[]) {
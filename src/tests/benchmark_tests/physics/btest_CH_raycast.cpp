@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for ray casts in the Chrono collision system.
+// A field of spheres and boxes is probed with a grid of vertical rays (as done,
+// for example, for the nodes of an SCM terrain grid). Individual ray casts are
+// compared with batched ray casts (packet traversal), for both the grid and the
+// BVH broadphase. The throughput is reported in rays/s (items_per_second).
+//
+// =============================================================================
+
+#include <vector>
+
+#include "benchmark/benchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// =============================================================================
+
+class RaycastTest {
+  public:
+    RaycastTest(ChBroadphase::Method method, int num_threads);
+
+    ChCollisionSystem* GetCollisionSystem() const { return m_system.GetCollisionSystem().get(); }
+
+    std::vector<ChVector<>> m_from;
+    std::vector<ChVector<>> m_to;
+
+  private:
+    ChSystemNSC m_system;
+};
+
+RaycastTest::RaycastTest(ChBroadphase::Method method, int num_threads) {
+    m_system.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    m_system.SetNumThreads(1, num_threads, 1);
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(m_system.GetCollisionSystem());
+    collsys->SetBroadphaseMethod(method);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(40, 1, 40, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    m_system.AddBody(ground);
+
+    // Field of 40x40 spheres and boxes
+    for (int i = 0; i < 40; i++) {
+        for (int j = 0; j < 40; j++) {
+            std::shared_ptr<ChBody> body;
+            if ((i + j) % 2 == 0)
+                body = chrono_types::make_shared<ChBodyEasySphere>(0.3, 1000, false, true, mat);
+            else
+                body = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.6, 0.4, 1000, false, true, mat);
+            body->SetPos(ChVector<>((i - 19.5) * 0.9, 0.3, (j - 19.5) * 0.9));
+            m_system.AddBody(body);
+        }
+    }
+
+    m_system.ComputeCollisions();
+
+    // Grid of 256x256 vertical rays over the field
+    for (int i = 0; i < 256; i++) {
+        for (int j = 0; j < 256; j++) {
+            ChVector<> loc(-18 + i * 36.0 / 256, 0, -18 + j * 36.0 / 256);
+            m_from.push_back(loc + ChVector<>(0, 2, 0));
+            m_to.push_back(loc - ChVector<>(0, 2, 0));
+        }
+    }
+}
+
+// =============================================================================
+
+static void Raycast_scalar(benchmark::State& st, ChBroadphase::Method method) {
+    RaycastTest test(method, 1);
+    ChCollisionSystem::ChRayhitResult result;
+    for (auto _ : st) {
+        for (size_t i = 0; i < test.m_from.size(); i++)
+            test.GetCollisionSystem()->RayHit(test.m_from[i], test.m_to[i], result);
+    }
+    st.SetItemsProcessed(st.iterations() * test.m_from.size());
+}
+
+static void Raycast_batch(benchmark::State& st, ChBroadphase::Method method) {
+    RaycastTest test(method, (int)st.range(0));
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    for (auto _ : st) {
+        test.GetCollisionSystem()->RayHitBatch(test.m_from, test.m_to, results);
+    }
+    st.SetItemsProcessed(st.iterations() * test.m_from.size());
+}
+
+BENCHMARK_CAPTURE(Raycast_scalar, grid, ChBroadphase::Method::GRID)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Raycast_scalar, bvh, ChBroadphase::Method::BVH)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Raycast_batch, grid, ChBroadphase::Method::GRID)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(Raycast_batch, bvh, ChBroadphase::Method::BVH)
+    ->Arg(1)
+    ->Arg(2)
+    ->Arg(4)
+    ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,170 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for warm starting of NSC contacts using persistent contact
+// reactions in the Chrono collision system.
+// Stacks of boxes resting on a pallet are simulated with a warm-started PSOR
+// solver; the average number of solver iterations per step to reach the
+// specified tolerance is reported with and without contact persistence.
+//
+// =============================================================================
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/solver/ChSolverPSOR.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+#ifdef CHRONO_IRRLICHT
+    #include "chrono_irrlicht/ChVisualSystemIrrlicht.h"
+#endif
+
+using namespace chrono;
+
+// =============================================================================
+
+template <int N, bool PERSISTENCE>
+class StackTestNSC : public utils::ChBenchmarkTest {
+  public:
+    StackTestNSC();
+    ~StackTestNSC() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override {
+        m_system->DoStepDynamics(m_step);
+        m_num_iterations += m_solver->GetIterations();
+        m_num_steps++;
+    }
+
+    void SimulateVis();
+
+    void ResetIterations() {
+        m_num_iterations = 0;
+        m_num_steps = 0;
+    }
+    double GetAverageIterations() const { return m_num_steps > 0 ? (double)m_num_iterations / m_num_steps : 0; }
+
+  private:
+    ChSystemNSC* m_system;
+    std::shared_ptr<ChSolverPSOR> m_solver;
+    double m_step;
+    int m_num_iterations;
+    int m_num_steps;
+};
+
+template <int N, bool PERSISTENCE>
+StackTestNSC<N, PERSISTENCE>::StackTestNSC()
+    : m_system(new ChSystemNSC()), m_step(0.01), m_num_iterations(0), m_num_steps(0) {
+    m_system->SetCollisionSystemType(collision::ChCollisionSystemType::CHRONO);
+    auto collsys = std::static_pointer_cast<collision::ChCollisionSystemChrono>(m_system->GetCollisionSystem());
+    collsys->SetBroadphaseGridResolution(ChVector<int>(N, 4, N));
+    collsys->SetEnvelope(0.01);
+    collsys->EnableContactPersistence(PERSISTENCE);
+
+    m_solver = chrono_types::make_shared<ChSolverPSOR>();
+    m_solver->SetMaxIterations(500);
+    m_solver->SetTolerance(1e-4);
+    m_solver->EnableWarmStart(true);
+    m_system->SetSolver(m_solver);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.6f);
+
+    // Pallet
+    double size = 1.0;
+    double pallet_width = N * 1.5 * size;
+    auto pallet = chrono_types::make_shared<ChBodyEasyBox>(pallet_width, 0.2, pallet_width, 1000, true, true, mat);
+    pallet->SetPos(ChVector<>(0, -0.1, 0));
+    pallet->SetBodyFixed(true);
+    m_system->Add(pallet);
+
+    // N x N stacks of boxes, 5 boxes high
+    int num_layers = 5;
+    for (int ix = 0; ix < N; ix++) {
+        for (int iz = 0; iz < N; iz++) {
+            double x = (ix - 0.5 * (N - 1)) * 1.5 * size;
+            double z = (iz - 0.5 * (N - 1)) * 1.5 * size;
+            for (int iy = 0; iy < num_layers; iy++) {
+                auto box = chrono_types::make_shared<ChBodyEasyBox>(size, size, size, 500, true, true, mat);
+                box->SetPos(ChVector<>(x, (iy + 0.5) * size, z));
+                m_system->Add(box);
+            }
+        }
+    }
+}
+
+template <int N, bool PERSISTENCE>
+void StackTestNSC<N, PERSISTENCE>::SimulateVis() {
+#ifdef CHRONO_IRRLICHT
+    // Create the Irrlicht visualization system
+    auto vis = chrono_types::make_shared<irrlicht::ChVisualSystemIrrlicht>();
+    vis->AttachSystem(m_system);
+    vis->SetWindowSize(800, 600);
+    vis->SetWindowTitle("Box stacks");
+    vis->Initialize();
+    vis->AddLogo();
+    vis->AddSkyBox();
+    vis->AddTypicalLights();
+    vis->AddCamera(ChVector<>(0, 2.0 * N, -3.0 * N), ChVector<>(0, 0, 0));
+
+    while (vis->Run()) {
+        vis->BeginScene();
+        vis->Render();
+        ExecuteStep();
+        vis->EndScene();
+    }
+#endif
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 200  // number of steps for hot start
+#define NUM_SIM_STEPS 500   // number of simulation steps for each benchmark
+
+// Comparison of warm starting with and without persistent contact reactions.
+// Reports the average number of PSOR iterations per step in addition to the usual timers.
+#define BM_STACK_PSOR(TEST_NAME, N, PERSISTENCE)                                                  \
+    using TEST_NAME = utils::ChBenchmarkFixture<StackTestNSC<N, PERSISTENCE>, NUM_SKIP_STEPS>; \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateLoop)(benchmark::State & st) {                        \
+        m_test->ResetIterations();                                                              \
+        while (st.KeepRunning()) {                                                              \
+            m_test->Simulate(NUM_SIM_STEPS);                                                    \
+        }                                                                                       \
+        Report(st);                                                                             \
+        st.counters["PSOR_Iterations"] = m_test->GetAverageIterations();                        \
+    }                                                                                           \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateLoop)->Unit(benchmark::kMillisecond)->Repetitions(5);
+
+BM_STACK_PSOR(StackNSC04_nopersist, 4, false)
+BM_STACK_PSOR(StackNSC04_persist, 4, true)
+BM_STACK_PSOR(StackNSC08_nopersist, 8, false)
+BM_STACK_PSOR(StackNSC08_persist, 8, true)
+
+// =============================================================================
+
+int main(int argc, char* argv[]) {
+    ::benchmark::Initialize(&argc, argv);
+
+#ifdef CHRONO_IRRLICHT
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        StackTestNSC<4, true> test;
+        test.SimulateVis();
+        return 0;
+    }
+#endif
+
+    ::benchmark::RunSpecifiedBenchmarks();
+}
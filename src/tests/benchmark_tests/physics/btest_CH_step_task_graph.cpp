@@ -0,0 +1,150 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Benchmark test for the task graph execution of the integration step.
+// Spheres fall on a plate next to a set of soft cantilever bars, meshed with
+// corotational hexahedral elements. The step is executed with the serial
+// pipeline or with the collision detection overlapped with the update of the
+// FEA meshes (which, for an NSC system, happens at every step with contacts).
+// In addition to the usual timers, the time of the concurrent stages is
+// reported (the overlap requires more than one thread).
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/ChConfig.h"
+#include "chrono/utils/ChBenchmark.h"
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/fea/ChElementHexaCorot_8.h"
+#include "chrono/fea/ChMesh.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+// =============================================================================
+
+template <int N, bool GRAPH>
+class StepGraphTest : public utils::ChBenchmarkTest {
+  public:
+    StepGraphTest();
+    ~StepGraphTest() { delete m_system; }
+
+    ChSystem* GetSystem() override { return m_system; }
+    void ExecuteStep() override {
+        m_system->DoStepDynamics(m_step);
+        m_time_collision += m_system->GetStepTaskGraph().GetTaskTime("collision");
+        m_time_mesh_update += m_system->GetStepTaskGraph().GetTaskTime("mesh_update");
+    }
+
+    void ResetStageTimes() {
+        m_time_collision = 0;
+        m_time_mesh_update = 0;
+    }
+    double GetTimeCollision() const { return m_time_collision; }
+    double GetTimeMeshUpdate() const { return m_time_mesh_update; }
+
+  private:
+    ChSystemNSC* m_system;
+    double m_step;
+    double m_time_collision;
+    double m_time_mesh_update;
+};
+
+template <int N, bool GRAPH>
+StepGraphTest<N, GRAPH>::StepGraphTest()
+    : m_system(new ChSystemNSC()), m_step(1e-3), m_time_collision(0), m_time_mesh_update(0) {
+    m_system->SetNumThreads(4);
+    m_system->SetUseStepTaskGraph(GRAPH);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    // Plate and N x N x 4 spheres
+    double radius = 0.1;
+    auto plate = chrono_types::make_shared<ChBodyEasyBox>(3 * N * radius, 0.1, 3 * N * radius, 1000, false, true, mat);
+    plate->SetPos(ChVector<>(0, -0.05, 0));
+    plate->SetBodyFixed(true);
+    m_system->Add(plate);
+
+    for (int ix = 0; ix < N; ix++) {
+        for (int iz = 0; iz < N; iz++) {
+            for (int iy = 0; iy < 4; iy++) {
+                auto ball = chrono_types::make_shared<ChBodyEasySphere>(radius, 1000, false, true, mat);
+                ball->SetPos(ChVector<>((ix - 0.5 * N) * 2.5 * radius, (2 * iy + 1) * 1.1 * radius,
+                                        (iz - 0.5 * N) * 2.5 * radius));
+                m_system->Add(ball);
+            }
+        }
+    }
+
+    // N soft cantilever bars of hexahedral elements (corotational, with nontrivial updates)
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    auto material = chrono_types::make_shared<ChContinuumElastic>();
+    material->Set_E(1e5);
+    material->Set_v(0.3);
+    material->Set_RayleighDampingK(0.01);
+
+    int num_elements = 2 * N;
+    double h = 0.05;
+    for (int ib = 0; ib < N; ib++) {
+        double x0 = 2 * N * radius;
+        double z0 = (ib - 0.5 * N) * 2.5 * radius;
+        std::vector<std::shared_ptr<ChNodeFEAxyz>> nodes;
+        for (int i = 0; i <= num_elements; i++) {
+            for (int k = 0; k < 4; k++) {
+                double y = 0.5 + (k == 1 || k == 2) * h;
+                double z = z0 + (k == 2 || k == 3) * h;
+                auto node = chrono_types::make_shared<ChNodeFEAxyz>(ChVector<>(x0 + i * h, y, z));
+                node->SetFixed(i == 0);
+                mesh->AddNode(node);
+                nodes.push_back(node);
+            }
+        }
+        for (int i = 0; i < num_elements; i++) {
+            auto element = chrono_types::make_shared<ChElementHexaCorot_8>();
+            element->SetNodes(nodes[4 * i], nodes[4 * i + 1], nodes[4 * i + 2], nodes[4 * i + 3], nodes[4 * i + 4],
+                              nodes[4 * i + 5], nodes[4 * i + 6], nodes[4 * i + 7]);
+            element->SetMaterial(material);
+            mesh->AddElement(element);
+        }
+    }
+    m_system->Add(mesh);
+}
+
+// =============================================================================
+
+#define NUM_SKIP_STEPS 100  // number of steps for hot start
+#define NUM_SIM_STEPS 200   // number of simulation steps for each benchmark
+
+// Comparison of the serial pipeline and the task graph.
+// Reports the time of the collision detection and mesh update stages in addition to the usual timers.
+#define BM_STEP_GRAPH(TEST_NAME, N, GRAPH)                                                    \
+    using TEST_NAME = utils::ChBenchmarkFixture<StepGraphTest<N, GRAPH>, NUM_SKIP_STEPS>; \
+    BENCHMARK_DEFINE_F(TEST_NAME, SimulateLoop)(benchmark::State & st) {                  \
+        while (st.KeepRunning()) {                                                        \
+            m_test->ResetStageTimes();                                                    \
+            m_test->Simulate(NUM_SIM_STEPS);                                              \
+        }                                                                                 \
+        Report(st);                                                                       \
+        st.counters["Stage_collision"] = m_test->GetTimeCollision() * 1e3;                \
+        st.counters["Stage_mesh_update"] = m_test->GetTimeMeshUpdate() * 1e3;             \
+    }                                                                                     \
+    BENCHMARK_REGISTER_F(TEST_NAME, SimulateLoop)->Unit(benchmark::kMillisecond)->Repetitions(5);
+
+BM_STEP_GRAPH(StepSerial_10, 10, false)
+BM_STEP_GRAPH(StepGraph_10, 10, true)
+BM_STEP_GRAPH(StepSerial_20, 20, false)
+BM_STEP_GRAPH(StepGraph_20, 20, true)
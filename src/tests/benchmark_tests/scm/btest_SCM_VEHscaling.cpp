@@ -70,6 +70,9 @@ int nthreads = 4;
 // Moving patches under each wheel
 bool wheel_patches = false;
 
+// SCM contact detection by rasterization of collision shapes (false: ray casting)
+bool rasterization = false;
+
 // Better conserve mass by displacing soil to the sides of a rut
 const bool bulldozing = false;
 
@@ -100,6 +103,7 @@ int main(int argc, char* argv[]) {
     end_time = cli.GetAsType<double>("end_time");
     nthreads = cli.GetAsType<int>("nthreads");
     wheel_patches = cli.GetAsType<bool>("wheel_patches");
+    rasterization = cli.GetAsType<bool>("raster");
 
     chrono_collsys = cli.GetAsType<bool>("csys");
 #ifndef CHRONO_COLLISION
@@ -117,6 +121,7 @@ int main(int argc, char* argv[]) {
 
     std::cout << "Collision system: " << (chrono_collsys ? "Chrono" : "Bullet") << std::endl;
     std::cout << "Num SCM threads: " << nthreads << std::endl;
+    std::cout << "SCM contact detection: " << (rasterization ? "Rasterization" : "Ray casting") << std::endl;
 
     // ------------------------
     // Create the Chrono system
@@ -217,6 +222,9 @@ int main(int argc, char* argv[]) {
         terrain.AddMovingPatch(hmmwv.GetChassisBody(), ChVector<>(0, 0, 0), ChVector<>(5, 3, 1));
     }
 
+    terrain.SetContactDetectionType(rasterization ? SCMTerrain::ContactDetectionType::RASTERIZATION
+                                                  : SCMTerrain::ContactDetectionType::RAY_CASTING);
+
     terrain.SetPlotType(vehicle::SCMTerrain::PLOT_SINKAGE, 0, 0.1);
 
     terrain.Initialize(terrainLength, terrainWidth, delta);
@@ -270,7 +278,7 @@ int main(int argc, char* argv[]) {
                 double rtf = timer() / end_time;
                 int nsteps = (int)(end_time / step_size);
 
-                std::string fname = "stats_" + std::to_string(nthreads) + ".out";
+                std::string fname = (rasterization ? "stats_raster_" : "stats_") + std::to_string(nthreads) + ".out";
                 std::ofstream ofile(fname.c_str(), std::ios_base::app);
                 ofile << raytest / nsteps << " " << raycast / nsteps << " " << rtf << endl;
                 ofile.close();
@@ -348,6 +356,8 @@ void AddCommandLineOptions(ChCLI& cli) {
     cli.AddOption<bool>("Test", "c,csys", "Use Chrono multicore collision (false: Bullet)",
                         std ::to_string(chrono_collsys));
     cli.AddOption<bool>("Test", "w,wheel_patches", "Use patches under each wheel", std::to_string(wheel_patches));
+    cli.AddOption<bool>("Test", "r,raster", "Use SCM contact detection by rasterization (false: ray casting)",
+                        std::to_string(rasterization));
     cli.AddOption<bool>("Test", "v,vis", "Enable run-time visualization", std::to_string(visualize));
 }
 
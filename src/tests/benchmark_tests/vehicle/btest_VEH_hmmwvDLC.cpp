@@ -13,6 +13,9 @@
 // =============================================================================
 //
 // Benchmark test for HMMWV double lane change.
+// Handling tires are also tested with the 4-point and envelope tire-terrain
+// collision methods, which sample the terrain at multiple points through
+// batched terrain queries.
 //
 // =============================================================================
 
@@ -35,7 +38,9 @@ using namespace chrono::vehicle::hmmwv;
 
 // =============================================================================
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
+template <typename EnumClass,
+          EnumClass TIRE_MODEL,
+          ChTire::CollisionType COLLISION = ChTire::CollisionType::SINGLE_POINT>
 class HmmwvDlcTest : public utils::ChBenchmarkTest {
   public:
     HmmwvDlcTest();
@@ -58,8 +63,8 @@ class HmmwvDlcTest : public utils::ChBenchmarkTest {
     double m_step_tire;
 };
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
-HmmwvDlcTest<EnumClass, TIRE_MODEL>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_tire(1e-3) {
+template <typename EnumClass, EnumClass TIRE_MODEL, ChTire::CollisionType COLLISION>
+HmmwvDlcTest<EnumClass, TIRE_MODEL, COLLISION>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_tire(1e-3) {
     EngineModelType engine_model = EngineModelType::SHAFTS;
     TransmissionModelType transmission_model = TransmissionModelType::SHAFTS;
     DrivelineTypeWV drive_type = DrivelineTypeWV::AWD;
@@ -73,6 +78,7 @@ HmmwvDlcTest<EnumClass, TIRE_MODEL>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_t
     m_hmmwv->SetTransmissionType(transmission_model);
     m_hmmwv->SetDriveType(drive_type);
     m_hmmwv->SetTireType(TIRE_MODEL);
+    m_hmmwv->SetTireCollisionType(COLLISION);
     m_hmmwv->SetTireStepSize(m_step_tire);
     m_hmmwv->SetAerodynamicDrag(0.5, 5.0, 1.2);
     m_hmmwv->Initialize();
@@ -103,15 +109,15 @@ HmmwvDlcTest<EnumClass, TIRE_MODEL>::HmmwvDlcTest() : m_step_veh(2e-3), m_step_t
     m_driver->Initialize();
 }
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
-HmmwvDlcTest<EnumClass, TIRE_MODEL>::~HmmwvDlcTest() {
+template <typename EnumClass, EnumClass TIRE_MODEL, ChTire::CollisionType COLLISION>
+HmmwvDlcTest<EnumClass, TIRE_MODEL, COLLISION>::~HmmwvDlcTest() {
     delete m_hmmwv;
     delete m_terrain;
     delete m_driver;
 }
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
-void HmmwvDlcTest<EnumClass, TIRE_MODEL>::ExecuteStep() {
+template <typename EnumClass, EnumClass TIRE_MODEL, ChTire::CollisionType COLLISION>
+void HmmwvDlcTest<EnumClass, TIRE_MODEL, COLLISION>::ExecuteStep() {
     double time = m_hmmwv->GetSystem()->GetChTime();
 
     // Driver inputs
@@ -128,8 +134,8 @@ void HmmwvDlcTest<EnumClass, TIRE_MODEL>::ExecuteStep() {
     m_hmmwv->Advance(m_step_veh);
 }
 
-template <typename EnumClass, EnumClass TIRE_MODEL>
-void HmmwvDlcTest<EnumClass, TIRE_MODEL>::SimulateVis() {
+template <typename EnumClass, EnumClass TIRE_MODEL, ChTire::CollisionType COLLISION>
+void HmmwvDlcTest<EnumClass, TIRE_MODEL, COLLISION>::SimulateVis() {
 #ifdef CHRONO_IRRLICHT
     auto vis = chrono_types::make_shared<ChWheeledVehicleVisualSystemIrrlicht>();
     vis->AttachVehicle(&m_hmmwv->GetVehicle());
@@ -175,11 +181,15 @@ typedef HmmwvDlcTest<TireModelType, TireModelType::TMEASY> tmeasy_test_type;
 typedef HmmwvDlcTest<TireModelType, TireModelType::FIALA> fiala_test_type;
 typedef HmmwvDlcTest<TireModelType, TireModelType::RIGID> rigid_test_type;
 typedef HmmwvDlcTest<TireModelType, TireModelType::RIGID_MESH> rigidmesh_test_type;
+typedef HmmwvDlcTest<TireModelType, TireModelType::TMEASY, ChTire::CollisionType::FOUR_POINTS> tmeasy4pt_test_type;
+typedef HmmwvDlcTest<TireModelType, TireModelType::TMEASY, ChTire::CollisionType::ENVELOPE> tmeasyenv_test_type;
 
 CH_BM_SIMULATION_ONCE(HmmwvDLC_TMEASY, tmeasy_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_ONCE(HmmwvDLC_FIALA, fiala_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_ONCE(HmmwvDLC_RIGID, rigid_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 CH_BM_SIMULATION_ONCE(HmmwvDLC_RIGIDMESH, rigidmesh_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_ONCE(HmmwvDLC_TMEASY_4PT, tmeasy4pt_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
+CH_BM_SIMULATION_ONCE(HmmwvDLC_TMEASY_ENVELOPE, tmeasyenv_test_type, NUM_SKIP_STEPS, NUM_SIM_STEPS, REPEATS);
 
 // =============================================================================
 
@@ -0,0 +1,106 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the BVH broadphase of the Chrono collision system.
+// A lattice of static spheres resting on a large ground box is crossed by a few
+// moving spheres. The number of contacts and the results of ray casts at each
+// step must be the same with the grid and the BVH broadphase.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+static const int num_moving = 3;
+
+static void CreateScene(ChSystemNSC& sys, ChBroadphase::Method method, std::vector<std::shared_ptr<ChBody>>& moving) {
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetBroadphaseGridResolution(ChVector<int>(10, 2, 10));
+    collsys->SetEnvelope(0.05);
+    collsys->SetBroadphaseMethod(method);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(200, 1, 200, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    // Static spheres on a staggered lattice: AABBs of diagonal neighbors overlap, but spheres are separated
+    double d = 0.9;
+    for (int i = -5; i <= 5; i++) {
+        for (int j = -5; j <= 5; j++) {
+            if ((i + j) % 2 != 0)
+                continue;
+            auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+            sphere->SetPos(ChVector<>(i * d, 0.5, j * d));
+            sys.AddBody(sphere);
+        }
+    }
+
+    // Moving spheres
+    for (int k = 0; k < num_moving; k++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+        sphere->SetPos(ChVector<>(-6, 1.4, (k - 1) * 2 * d));
+        sys.AddBody(sphere);
+        moving.push_back(sphere);
+    }
+}
+
+TEST(ChCollisionSystemChrono, bvh) {
+    ChSystemNSC sys_grid;
+    ChSystemNSC sys_bvh;
+    std::vector<std::shared_ptr<ChBody>> moving_grid;
+    std::vector<std::shared_ptr<ChBody>> moving_bvh;
+    CreateScene(sys_grid, ChBroadphase::Method::GRID, moving_grid);
+    CreateScene(sys_bvh, ChBroadphase::Method::BVH, moving_bvh);
+
+    int max_contacts = 0;
+    for (int step = 0; step < 400; step++) {
+        // Move the spheres across the lattice
+        double x = -6 + 0.05 * step;
+        for (int k = 0; k < num_moving; k++) {
+            ChVector<> pos(x, 1.4, (k - 1) * 2 * 0.9 + 0.1 * std::sin(0.1 * step));
+            moving_grid[k]->SetPos(pos);
+            moving_bvh[k]->SetPos(pos);
+        }
+
+        sys_grid.ComputeCollisions();
+        sys_bvh.ComputeCollisions();
+
+        ASSERT_EQ(sys_grid.GetNcontacts(), sys_bvh.GetNcontacts()) << "step " << step;
+        max_contacts = std::max(max_contacts, sys_grid.GetNcontacts());
+
+        // Cast a vertical ray through the first moving sphere
+        ChCollisionSystem::ChRayhitResult res_grid;
+        ChCollisionSystem::ChRayhitResult res_bvh;
+        ChVector<> from(x, 10, -2 * 0.9);
+        ChVector<> to(x, -10, -2 * 0.9);
+        sys_grid.GetCollisionSystem()->RayHit(from, to, res_grid);
+        sys_bvh.GetCollisionSystem()->RayHit(from, to, res_bvh);
+        ASSERT_EQ(res_grid.hit, res_bvh.hit) << "step " << step;
+        if (res_grid.hit) {
+            ASSERT_NEAR(res_grid.abs_hitPoint.y(), res_bvh.abs_hitPoint.y(), 1e-10) << "step " << step;
+        }
+    }
+
+    ASSERT_GT(max_contacts, 0);
+}
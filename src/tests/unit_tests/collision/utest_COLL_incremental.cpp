@@ -0,0 +1,95 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the incremental mode of the Chrono collision system.
+// A lattice of static spheres resting on the ground (with overlapping AABBs but
+// no contacts between neighbors) is crossed by a few moving spheres. The number
+// of contacts at each step must be the same with and without incremental
+// collision detection.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+static const int num_moving = 3;
+
+static void CreateScene(ChSystemNSC& sys, bool incremental, std::vector<std::shared_ptr<ChBody>>& moving) {
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetBroadphaseGridResolution(ChVector<int>(10, 2, 10));
+    collsys->SetEnvelope(0.05);
+    collsys->EnableIncrementalCollision(incremental);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    // Static spheres on a staggered lattice: AABBs of diagonal neighbors overlap, but spheres are separated
+    double d = 0.9;
+    for (int i = -5; i <= 5; i++) {
+        for (int j = -5; j <= 5; j++) {
+            if ((i + j) % 2 != 0)
+                continue;
+            auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+            sphere->SetPos(ChVector<>(i * d, 0.5, j * d));
+            sys.AddBody(sphere);
+        }
+    }
+
+    // Moving spheres
+    for (int k = 0; k < num_moving; k++) {
+        auto sphere = chrono_types::make_shared<ChBodyEasySphere>(0.5, 1000, false, true, mat);
+        sphere->SetPos(ChVector<>(-6, 1.4, (k - 1) * 2 * d));
+        sys.AddBody(sphere);
+        moving.push_back(sphere);
+    }
+}
+
+TEST(ChCollisionSystemChrono, incremental) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_inc;
+    std::vector<std::shared_ptr<ChBody>> moving_ref;
+    std::vector<std::shared_ptr<ChBody>> moving_inc;
+    CreateScene(sys_ref, false, moving_ref);
+    CreateScene(sys_inc, true, moving_inc);
+
+    int max_contacts = 0;
+    for (int step = 0; step < 400; step++) {
+        // Move the spheres across the lattice and eventually outside the initial broadphase grid
+        double x = -6 + 0.05 * step;
+        for (int k = 0; k < num_moving; k++) {
+            ChVector<> pos(x, 1.4, (k - 1) * 2 * 0.9 + 0.1 * std::sin(0.1 * step));
+            moving_ref[k]->SetPos(pos);
+            moving_inc[k]->SetPos(pos);
+        }
+
+        sys_ref.ComputeCollisions();
+        sys_inc.ComputeCollisions();
+
+        ASSERT_EQ(sys_ref.GetNcontacts(), sys_inc.GetNcontacts()) << "step " << step;
+        max_contacts = std::max(max_contacts, sys_ref.GetNcontacts());
+    }
+
+    ASSERT_GT(max_contacts, 0);
+}
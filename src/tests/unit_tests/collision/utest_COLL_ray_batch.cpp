@@ -0,0 +1,131 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for batched ray casts in the Chrono collision system.
+// A field of spheres, boxes, and cylinders on a ground box is probed with a
+// grid of vertical rays and with a fan of slanted rays. The results of the
+// batched ray casts must match those of individual ray casts, with both the
+// grid and the BVH broadphase.
+//
+// =============================================================================
+
+#include <cmath>
+#include <vector>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/collision/ChCollisionSystemChrono.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+static void CreateScene(ChSystemNSC& sys, ChBroadphase::Method method) {
+    sys.SetCollisionSystemType(ChCollisionSystemType::CHRONO);
+    sys.SetNumThreads(1, 2, 1);
+    auto collsys = std::static_pointer_cast<ChCollisionSystemChrono>(sys.GetCollisionSystem());
+    collsys->SetBroadphaseGridResolution(ChVector<int>(8, 2, 8));
+    collsys->SetBroadphaseMethod(method);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(20, 1, 20, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = -4; i <= 4; i++) {
+        for (int j = -4; j <= 4; j++) {
+            std::shared_ptr<ChBody> body;
+            switch ((i + j + 8) % 3) {
+                case 0:
+                    body = chrono_types::make_shared<ChBodyEasySphere>(0.4, 1000, false, true, mat);
+                    break;
+                case 1:
+                    body = chrono_types::make_shared<ChBodyEasyBox>(0.6, 0.8, 0.5, 1000, false, true, mat);
+                    break;
+                case 2:
+                    body = chrono_types::make_shared<ChBodyEasyCylinder>(0.3, 0.9, 1000, false, true, mat);
+                    break;
+            }
+            body->SetPos(ChVector<>(i * 1.1, 0.5 + 0.05 * j, j * 1.1));
+            body->SetRot(Q_from_AngY(0.2 * (i - j)));
+            sys.AddBody(body);
+        }
+    }
+
+    sys.ComputeCollisions();
+}
+
+static void CreateRays(std::vector<ChVector<>>& from, std::vector<ChVector<>>& to) {
+    // Grid of vertical rays
+    for (int i = 0; i < 60; i++) {
+        for (int j = 0; j < 60; j++) {
+            double x = -6 + 0.2 * i;
+            double z = -6 + 0.2 * j + 0.01 * i;
+            from.push_back(ChVector<>(x, 3, z));
+            to.push_back(ChVector<>(x, -3, z));
+        }
+    }
+
+    // Fan of slanted rays from a common origin, some missing all shapes
+    for (int k = 0; k < 500; k++) {
+        double theta = CH_C_2PI * k / 500;
+        double phi = 0.05 + 0.6 * (k % 7) / 7.0;
+        ChVector<> dir(std::cos(theta) * std::cos(phi), -std::sin(phi), std::sin(theta) * std::cos(phi));
+        from.push_back(ChVector<>(0.3, 2, -0.2));
+        to.push_back(ChVector<>(0.3, 2, -0.2) + 12.0 * dir);
+    }
+}
+
+class RayBatch : public ::testing::TestWithParam<ChBroadphase::Method> {};
+
+TEST_P(RayBatch, compare) {
+    ChSystemNSC sys;
+    CreateScene(sys, GetParam());
+
+    std::vector<ChVector<>> from;
+    std::vector<ChVector<>> to;
+    CreateRays(from, to);
+
+    std::vector<ChCollisionSystem::ChRayhitResult> results;
+    int num_hits = sys.GetCollisionSystem()->RayHitBatch(from, to, results);
+    ASSERT_EQ(results.size(), from.size());
+
+    int num_hits_ref = 0;
+    int num_misses = 0;
+    for (size_t i = 0; i < from.size(); i++) {
+        ChCollisionSystem::ChRayhitResult ref;
+        sys.GetCollisionSystem()->RayHit(from[i], to[i], ref);
+        ASSERT_EQ(ref.hit, results[i].hit) << "ray " << i;
+        if (!ref.hit) {
+            num_misses++;
+            continue;
+        }
+        num_hits_ref++;
+        ASSERT_EQ(ref.hitModel, results[i].hitModel) << "ray " << i;
+        ASSERT_NEAR((ref.abs_hitPoint - results[i].abs_hitPoint).Length(), 0, 1e-12) << "ray " << i;
+        ASSERT_NEAR((ref.abs_hitNormal - results[i].abs_hitNormal).Length(), 0, 1e-12) << "ray " << i;
+        ASSERT_NEAR(ref.dist_factor, results[i].dist_factor, 1e-12) << "ray " << i;
+    }
+
+    ASSERT_EQ(num_hits, num_hits_ref);
+    ASSERT_GT(num_hits, 0);
+    ASSERT_GT(num_misses, 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChCollisionSystemChrono,
+                         RayBatch,
+                         ::testing::Values(ChBroadphase::Method::GRID, ChBroadphase::Method::BVH));
@@ -0,0 +1,128 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the placement of the sub-domain boundaries in dynamic load
+// balancing (ChDomainDistributed::BalanceBoundaries). Does not require MPI.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <vector>
+
+#include "chrono_distributed/physics/ChDomainDistributed.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const double ghost_layer = 0.5;
+
+// Uniform split of [0, length] in the given number of sub-domains
+static std::vector<double> UniformBoundaries(int num_ranks, double length) {
+    std::vector<double> boundaries(num_ranks + 1);
+    for (int r = 0; r <= num_ranks; r++)
+        boundaries[r] = length * r / num_ranks;
+    return boundaries;
+}
+
+// Loads of all sub-domains for a given cumulative load distribution along the split axis
+static std::vector<double> ComputeLoads(const std::vector<double>& boundaries,
+                                        const std::function<double(double)>& cumul_load) {
+    std::vector<double> loads(boundaries.size() - 1);
+    for (size_t r = 0; r < loads.size(); r++)
+        loads[r] = cumul_load(boundaries[r + 1]) - cumul_load(boundaries[r]);
+    return loads;
+}
+
+static double Imbalance(const std::vector<double>& loads) {
+    double total = 0;
+    for (auto load : loads)
+        total += load;
+    return *std::max_element(loads.begin(), loads.end()) * loads.size() / total;
+}
+
+static void CheckConstraints(const std::vector<double>& old_boundaries, const std::vector<double>& boundaries) {
+    ASSERT_EQ(boundaries.size(), old_boundaries.size());
+    ASSERT_EQ(boundaries.front(), old_boundaries.front());
+    ASSERT_EQ(boundaries.back(), old_boundaries.back());
+    for (size_t k = 0; k < boundaries.size(); k++)
+        ASSERT_LE(std::abs(boundaries[k] - old_boundaries[k]), 0.5 * ghost_layer + 1e-12) << "boundary " << k;
+    for (size_t k = 0; k + 1 < boundaries.size(); k++)
+        ASSERT_GE(boundaries[k + 1] - boundaries[k], 2 * ghost_layer - 1e-12) << "sub-domain " << k;
+}
+
+TEST(BalanceBoundaries, balanced) {
+    // Equal loads: the boundaries must not move
+    auto boundaries = UniformBoundaries(4, 20);
+    auto old_boundaries = boundaries;
+    ASSERT_TRUE(ChDomainDistributed::BalanceBoundaries({1, 1, 1, 1}, ghost_layer, boundaries));
+    for (size_t k = 0; k < boundaries.size(); k++)
+        ASSERT_NEAR(boundaries[k], old_boundaries[k], 1e-12);
+}
+
+TEST(BalanceBoundaries, clamped_shift) {
+    // All the load in the first sub-domain: all interior boundaries move down by half a ghost layer
+    auto boundaries = UniformBoundaries(4, 20);
+    auto old_boundaries = boundaries;
+    ASSERT_TRUE(ChDomainDistributed::BalanceBoundaries({100, 0, 0, 0}, ghost_layer, boundaries));
+    CheckConstraints(old_boundaries, boundaries);
+    for (size_t k = 1; k + 1 < boundaries.size(); k++)
+        ASSERT_NEAR(boundaries[k], old_boundaries[k] - 0.5 * ghost_layer, 1e-12);
+}
+
+TEST(BalanceBoundaries, minimum_length) {
+    // All the load in the first sub-domain, which is close to the minimum length: the boundaries must not get closer
+    // than two ghost layers
+    std::vector<double> boundaries = {0, 1.2, 2.4, 10};
+    for (int iter = 0; iter < 20; iter++) {
+        auto old_boundaries = boundaries;
+        ChDomainDistributed::BalanceBoundaries({100, 0, 0}, ghost_layer, boundaries);
+        CheckConstraints(old_boundaries, boundaries);
+    }
+    // The first two sub-domains must have shrunk as much as possible
+    ASSERT_NEAR(boundaries[1], 1.0, 1e-12);
+    ASSERT_NEAR(boundaries[2], 2.0, 1e-12);
+}
+
+TEST(BalanceBoundaries, skewed_load) {
+    // Load density growing quadratically along the split axis (cumulative load ~ x^3). Recompute the loads after each
+    // rebalancing, as done in a simulation: the imbalance must decrease to (nearly) 1.
+    auto cumul_load = [](double x) { return x * x * x; };
+    auto boundaries = UniformBoundaries(5, 40);
+    double first_imbalance = Imbalance(ComputeLoads(boundaries, cumul_load));
+    for (int iter = 0; iter < 500; iter++) {
+        auto old_boundaries = boundaries;
+        ChDomainDistributed::BalanceBoundaries(ComputeLoads(boundaries, cumul_load), ghost_layer, boundaries);
+        CheckConstraints(old_boundaries, boundaries);
+    }
+    double last_imbalance = Imbalance(ComputeLoads(boundaries, cumul_load));
+    ASSERT_GT(first_imbalance, 2);
+    ASSERT_LT(last_imbalance, 1.01);
+}
+
+TEST(BalanceBoundaries, infeasible) {
+    // Domain too short for the minimum sub-domain length
+    auto boundaries = UniformBoundaries(4, 3);
+    auto old_boundaries = boundaries;
+    ASSERT_FALSE(ChDomainDistributed::BalanceBoundaries({10, 0, 0, 0}, ghost_layer, boundaries));
+    ASSERT_EQ(boundaries, old_boundaries);
+
+    // Current sub-domains already shorter than the minimum length (empty range of admissible boundary positions)
+    boundaries = {0, 0.5, 1.0, 10};
+    old_boundaries = boundaries;
+    ASSERT_FALSE(ChDomainDistributed::BalanceBoundaries({0, 0, 10}, ghost_layer, boundaries));
+    ASSERT_EQ(boundaries, old_boundaries);
+}
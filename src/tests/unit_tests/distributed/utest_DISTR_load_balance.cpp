@@ -0,0 +1,102 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for dynamic load balancing of the distributed sub-domains.
+// All bodies are initially located in the first sub-domain. With load balancing
+// enabled, the sub-domain boundaries must move so as to reduce the load
+// imbalance, while no body is lost in the exchange between ranks.
+//
+// =============================================================================
+
+#include "chrono_distributed/physics/ChSystemDistributed.h"
+#include "chrono_distributed/physics/ChDomainDistributed.h"
+#include "chrono_distributed/collision/ChCollisionModelDistributed.h"
+#include "chrono/physics/ChBody.h"
+
+#include <mpi.h>
+#include <iostream>
+#include <memory>
+
+using namespace chrono;
+using namespace chrono::collision;
+
+double dt = 0.001;
+
+// Number of bodies owned by this rank
+int CountOwned(ChSystemDistributed& sys) {
+    int num_owned = 0;
+    for (auto status : sys.ddm->comm_status) {
+        if (status == distributed::OWNED || status == distributed::SHARED_UP || status == distributed::SHARED_DOWN)
+            num_owned++;
+    }
+    return num_owned;
+}
+
+// To be run on 2 or more MPI ranks
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int my_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &my_rank);
+    ChSystemDistributed sys(MPI_COMM_WORLD, 0.5, 10000);
+    sys.GetDomain()->SetSplitAxis(0);
+    sys.GetDomain()->SetSimDomain(ChVector<>(0, 0, 0), ChVector<>(20, 4, 4));
+    sys.GetDomain()->SetLoadBalancing(10);
+
+    sys.Set_G_acc(ChVector<double>(0, 0, 0));
+
+    auto material = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+
+    // Grid of separated, motionless balls, all in the lower part of the domain
+    int num_bodies = 0;
+    for (int i = 0; i < 16; i++) {
+        for (int j = 0; j < 4; j++) {
+            auto ball = chrono_types::make_shared<ChBody>(chrono_types::make_shared<ChCollisionModelDistributed>());
+            ChVector<double> pos(0.5 + 0.25 * i, 0.5 + j, 2);
+            ball->SetPos(pos);
+            ball->GetCollisionModel()->ClearModel();
+            ball->GetCollisionModel()->AddSphere(material, 0.1, pos);
+            ball->GetCollisionModel()->BuildModel();
+            ball->SetCollide(true);
+            sys.AddBody(ball);
+            num_bodies++;
+        }
+    }
+
+    double first_imbalance = 0;
+    for (int i = 0; i < 400; i++) {
+        sys.DoStepDynamics(dt);
+        if (i == 9)
+            first_imbalance = sys.GetDomain()->GetLoadImbalance();
+    }
+    double last_imbalance = sys.GetDomain()->GetLoadImbalance();
+
+    int num_owned = CountOwned(sys);
+    int num_owned_global = 0;
+    MPI_Allreduce(&num_owned, &num_owned_global, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+
+    int ret = 0;
+    if (num_owned_global != num_bodies) {
+        if (my_rank == 0)
+            std::cout << "Bodies lost: " << num_owned_global << " of " << num_bodies << std::endl;
+        ret = 1;
+    }
+    if (sys.GetCommSize() > 1 && last_imbalance >= first_imbalance) {
+        if (my_rank == 0)
+            std::cout << "Imbalance not reduced: " << first_imbalance << " -> " << last_imbalance << std::endl;
+        ret = 1;
+    }
+
+    MPI_Finalize();
+    return ret;
+}
@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the batched evaluation of internal forces of ANCF 3833 shells.
+// A cantilever strip of identical shell elements deflects under gravity. The
+// results obtained with batched internal forces must match those obtained with
+// the per-element calculation, with and without damping.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/fea/ChElementShellANCF_3833.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static const int num_elements = 10;
+
+static std::shared_ptr<ChNodeFEAxyzDD> CreateModel(ChSystemSMC& sys,
+                                                   std::shared_ptr<ChMesh>& mesh,
+                                                   double alpha,
+                                                   bool batch) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseLU>();
+    sys.SetSolver(solver);
+
+    sys.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(50);
+    integrator->SetAbsTolerances(1e-8);
+    integrator->SetMode(ChTimestepperHHT::POSITION);
+    integrator->SetModifiedNewton(false);
+
+    double length = 0.5;
+    double width = 0.05;
+    double thickness = 0.005;
+    double dx = length / num_elements;
+    auto material = chrono_types::make_shared<ChMaterialShellANCF>(1000, 1e7, 0.3);
+
+    mesh = chrono_types::make_shared<ChMesh>();
+    mesh->SetBatchedInternalForces(batch, 4);
+    sys.Add(mesh);
+
+    ChVector<> dir1(0, 0, 1);
+    ChVector<> curv1(0, 0, 0);
+
+    auto nodeA = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(0, -0.5 * width, 0), dir1, curv1);
+    auto nodeD = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(0, 0.5 * width, 0), dir1, curv1);
+    auto nodeH = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(0, 0, 0), dir1, curv1);
+    nodeA->SetFixed(true);
+    nodeD->SetFixed(true);
+    nodeH->SetFixed(true);
+    mesh->AddNode(nodeA);
+    mesh->AddNode(nodeD);
+    mesh->AddNode(nodeH);
+
+    for (int i = 1; i <= num_elements; i++) {
+        auto nodeB = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(i * dx, -0.5 * width, 0), dir1, curv1);
+        auto nodeC = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(i * dx, 0.5 * width, 0), dir1, curv1);
+        auto nodeE =
+            chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(i * dx - 0.5 * dx, -0.5 * width, 0), dir1, curv1);
+        auto nodeF = chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(i * dx, 0, 0), dir1, curv1);
+        auto nodeG =
+            chrono_types::make_shared<ChNodeFEAxyzDD>(ChVector<>(i * dx - 0.5 * dx, 0.5 * width, 0), dir1, curv1);
+        mesh->AddNode(nodeB);
+        mesh->AddNode(nodeC);
+        mesh->AddNode(nodeE);
+        mesh->AddNode(nodeF);
+        mesh->AddNode(nodeG);
+
+        auto element = chrono_types::make_shared<ChElementShellANCF_3833>();
+        element->SetNodes(nodeA, nodeB, nodeC, nodeD, nodeE, nodeF, nodeG, nodeH);
+        element->SetDimensions(dx, width);
+        element->AddLayer(thickness, 0, material);
+        element->SetAlphaDamp(alpha);
+        mesh->AddElement(element);
+
+        nodeA = nodeB;
+        nodeD = nodeC;
+        nodeH = nodeF;
+    }
+
+    return nodeH;
+}
+
+class ANCFShell3833Batch : public ::testing::TestWithParam<double> {};
+
+TEST_P(ANCFShell3833Batch, internal_forces) {
+    double alpha = GetParam();
+
+    ChSystemSMC sys_ref;
+    ChSystemSMC sys_batch;
+    std::shared_ptr<ChMesh> mesh_ref;
+    std::shared_ptr<ChMesh> mesh_batch;
+    auto tip_ref = CreateModel(sys_ref, mesh_ref, alpha, false);
+    auto tip_batch = CreateModel(sys_batch, mesh_batch, alpha, true);
+
+    for (int step = 0; step < 100; step++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_batch.DoStepDynamics(1e-3);
+    }
+
+    // Elements sharing nodes have different colors, so the strip uses 2 colors with batches of up to 4 elements
+    ASSERT_EQ(mesh_ref->GetNumElementBatches(), 0);
+    ASSERT_EQ(mesh_batch->GetNumElementBatches(), 4);
+    ASSERT_LT(tip_ref->GetPos().z(), -1e-3);
+    ASSERT_NEAR((tip_ref->GetPos() - tip_batch->GetPos()).Length(), 0, 1e-10);
+    ASSERT_NEAR((tip_ref->GetPos_dt() - tip_batch->GetPos_dt()).Length(), 0, 1e-8);
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoFEA, ANCFShell3833Batch, ::testing::Values(0.0, 0.01));
@@ -0,0 +1,103 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for lazy updates of the FEA element Jacobians.
+// An ANCF cable pendulum is simulated with the HHT integrator, with and without
+// lazy Jacobian updates. Skipping the Jacobians of elements whose nodal states
+// did not change must not affect the results beyond the integrator tolerance.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/fea/ChElementCableANCF.h"
+#include "chrono/fea/ChLinkPointFrame.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static const int num_elements = 8;
+
+static std::shared_ptr<ChNodeFEAxyzD> CreateModel(ChSystemSMC& sys, std::shared_ptr<ChMesh>& mesh) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    sys.SetSolver(solver);
+
+    sys.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(50);
+    integrator->SetAbsTolerances(1e-6);
+    integrator->SetMode(ChTimestepperHHT::POSITION);
+    integrator->SetModifiedNewton(false);
+
+    auto section = chrono_types::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+    section->SetBeamRaleyghDamping(0.01);
+
+    mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    double length = 1.0;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = chrono_types::make_shared<ChNodeFEAxyzD>(ChVector<>(i * length / num_elements, 0, 0),
+                                                             ChVector<>(1, 0, 0));
+        mesh->AddNode(node);
+        nodes.push_back(node);
+    }
+    for (int i = 0; i < num_elements; i++) {
+        auto element = chrono_types::make_shared<ChElementCableANCF>();
+        element->SetNodes(nodes[i], nodes[i + 1]);
+        element->SetSection(section);
+        mesh->AddElement(element);
+    }
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    auto hinge = chrono_types::make_shared<ChLinkPointFrame>();
+    hinge->Initialize(nodes[0], ground);
+    sys.Add(hinge);
+
+    return nodes.back();
+}
+
+TEST(ChMesh, lazy_jacobian) {
+    ChSystemSMC sys_ref;
+    ChSystemSMC sys_lazy;
+    std::shared_ptr<ChMesh> mesh_ref;
+    std::shared_ptr<ChMesh> mesh_lazy;
+    auto tip_ref = CreateModel(sys_ref, mesh_ref);
+    auto tip_lazy = CreateModel(sys_lazy, mesh_lazy);
+
+    mesh_lazy->SetJacobianUpdateTolerance(1e-4);
+
+    for (int step = 0; step < 200; step++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_lazy.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_EQ(mesh_ref->GetNumSkippedElementJacobians(), 0);
+    ASSERT_GT(mesh_lazy->GetNumSkippedElementJacobians(), 0);
+    ASSERT_NEAR((tip_ref->GetPos() - tip_lazy->GetPos()).Length(), 0, 1e-4);
+}
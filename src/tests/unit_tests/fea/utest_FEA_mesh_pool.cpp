@@ -0,0 +1,142 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for pooled storage of FEA nodes and elements.
+// An ANCF cable pendulum with a chain of springs attached at its tip is created
+// with individually allocated nodes and elements, and with nodes and elements
+// created in the mesh pools. The results of the two models must be identical.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/fea/ChElementCableANCF.h"
+#include "chrono/fea/ChElementSpring.h"
+#include "chrono/fea/ChLinkPointFrame.h"
+#include "chrono/fea/ChMesh.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::fea;
+
+static const int num_elements = 8;
+static const int num_springs = 4;
+
+template <class T, typename... Args>
+static std::shared_ptr<T> CreateNode(std::shared_ptr<ChMesh> mesh, bool pooled, Args&&... args) {
+    if (pooled)
+        return mesh->CreateNode<T>(std::forward<Args>(args)...);
+    auto node = chrono_types::make_shared<T>(std::forward<Args>(args)...);
+    mesh->AddNode(node);
+    return node;
+}
+
+template <class T>
+static std::shared_ptr<T> CreateElement(std::shared_ptr<ChMesh> mesh, bool pooled) {
+    if (pooled)
+        return mesh->CreateElement<T>();
+    auto elem = chrono_types::make_shared<T>();
+    mesh->AddElement(elem);
+    return elem;
+}
+
+static std::shared_ptr<ChNodeFEAxyz> CreateModel(ChSystemSMC& sys,
+                                                 std::vector<std::shared_ptr<ChNodeFEAxyzD>>& cable_nodes,
+                                                 bool pooled) {
+    sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    sys.SetSolver(solver);
+
+    sys.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(50);
+    integrator->SetAbsTolerances(1e-8);
+    integrator->SetMode(ChTimestepperHHT::POSITION);
+
+    auto section = chrono_types::make_shared<ChBeamSectionCable>();
+    section->SetDiameter(0.02);
+    section->SetYoungModulus(1e7);
+    section->SetDensity(1000);
+
+    auto mesh = chrono_types::make_shared<ChMesh>();
+    sys.Add(mesh);
+
+    double length = 1.0;
+    for (int i = 0; i <= num_elements; i++) {
+        auto node = CreateNode<ChNodeFEAxyzD>(mesh, pooled, ChVector<>(i * length / num_elements, 0, 0),
+                                              ChVector<>(1, 0, 0));
+        cable_nodes.push_back(node);
+    }
+    for (int i = 0; i < num_elements; i++) {
+        auto element = CreateElement<ChElementCableANCF>(mesh, pooled);
+        element->SetNodes(cable_nodes[i], cable_nodes[i + 1]);
+        element->SetSection(section);
+    }
+
+    std::shared_ptr<ChNodeFEAxyz> prev = cable_nodes.back();
+    for (int i = 1; i <= num_springs; i++) {
+        auto node = CreateNode<ChNodeFEAxyz>(mesh, pooled, ChVector<>(length, 0, -0.1 * i));
+        node->SetMass(0.01);
+        auto spring = CreateElement<ChElementSpring>(mesh, pooled);
+        spring->SetNodes(prev, node);
+        spring->SetSpringK(1e3);
+        spring->SetDamperR(1);
+        prev = node;
+    }
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    auto hinge = chrono_types::make_shared<ChLinkPointFrame>();
+    hinge->Initialize(cable_nodes[0], ground);
+    sys.Add(hinge);
+
+    return prev;
+}
+
+TEST(ChMesh, pooled_storage) {
+    ChSystemSMC sys_ref;
+    ChSystemSMC sys_pool;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes_ref;
+    std::vector<std::shared_ptr<ChNodeFEAxyzD>> nodes_pool;
+    auto tip_ref = CreateModel(sys_ref, nodes_ref, false);
+    auto tip_pool = CreateModel(sys_pool, nodes_pool, true);
+
+    // Pooled nodes of the same type are stored contiguously
+    for (int i = 1; i <= num_elements; i++) {
+        auto delta = (char*)nodes_pool[i].get() - (char*)nodes_pool[i - 1].get();
+        ASSERT_EQ((size_t)delta, sizeof(ChNodeFEAxyzD));
+    }
+
+    for (int step = 0; step < 200; step++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_pool.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_LT(tip_ref->GetPos().z(), -0.41);
+    ASSERT_NEAR((tip_ref->GetPos() - tip_pool->GetPos()).Length(), 0, 1e-12);
+    ASSERT_NEAR((tip_ref->GetPos_dt() - tip_pool->GetPos_dt()).Length(), 0, 1e-10);
+    for (int i = 0; i <= num_elements; i++) {
+        ASSERT_NEAR((nodes_ref[i]->GetD() - nodes_pool[i]->GetD()).Length(), 0, 1e-12);
+    }
+
+    // Pooled nodes outlive the mesh and the system, as long as they are referenced
+    sys_pool.Clear();
+    ASSERT_NEAR((tip_ref->GetPos() - tip_pool->GetPos()).Length(), 0, 1e-12);
+}
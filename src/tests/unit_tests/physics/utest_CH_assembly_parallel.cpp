@@ -0,0 +1,86 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the parallel processing of the assembly state functions.
+// A chain of spinning bodies connected by springs swings under gravity. The
+// results obtained with parallel state gather/scatter/increment, residual
+// loading, and update must be identical to those obtained serially.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_bodies = 40;
+
+static void CreateModel(ChSystemNSC& sys, std::vector<std::shared_ptr<ChBody>>& bodies) {
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+    sys.SetTimestepperType(ChTimestepper::Type::EULER_IMPLICIT_LINEARIZED);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 1; i <= num_bodies; i++) {
+        auto body = chrono_types::make_shared<ChBody>();
+        body->SetMass(1);
+        body->SetInertiaXX(ChVector<>(0.1, 0.2, 0.3));
+        body->SetPos(ChVector<>(0.1 * i, 0, 0));
+        body->SetWvel_loc(ChVector<>(1, 2, 3));
+        sys.AddBody(body);
+        bodies.push_back(body);
+
+        auto spring = chrono_types::make_shared<ChLinkTSDA>();
+        spring->Initialize(prev, body, false, prev->GetPos(), body->GetPos());
+        spring->SetSpringCoefficient(1e3);
+        spring->SetDampingCoefficient(1);
+        sys.AddLink(spring);
+
+        prev = body;
+    }
+}
+
+TEST(ChAssembly, parallel) {
+    ChSystemNSC sys_serial;
+    ChSystemNSC sys_parallel;
+    std::vector<std::shared_ptr<ChBody>> bodies_serial;
+    std::vector<std::shared_ptr<ChBody>> bodies_parallel;
+    CreateModel(sys_serial, bodies_serial);
+    CreateModel(sys_parallel, bodies_parallel);
+
+    ASSERT_GT(sys_serial.GetAssembly().GetParallelThreshold(), num_bodies);
+    sys_parallel.SetParallelThreshold(1);
+    sys_parallel.SetNumThreads(4);
+
+    for (int step = 0; step < 200; step++) {
+        sys_serial.DoStepDynamics(1e-3);
+        sys_parallel.DoStepDynamics(1e-3);
+    }
+
+    // Each item is processed by a single thread, so the results are identical
+    ASSERT_LT(bodies_serial.back()->GetPos().y(), -0.01);
+    for (int i = 0; i < num_bodies; i++) {
+        ASSERT_EQ((bodies_serial[i]->GetPos() - bodies_parallel[i]->GetPos()).Length(), 0.0);
+        ASSERT_EQ((bodies_serial[i]->GetRot() - bodies_parallel[i]->GetRot()).Length(), 0.0);
+        ASSERT_EQ((bodies_serial[i]->GetPos_dt() - bodies_parallel[i]->GetPos_dt()).Length(), 0.0);
+        ASSERT_EQ((bodies_serial[i]->GetWvel_loc() - bodies_parallel[i]->GetWvel_loc()).Length(), 0.0);
+    }
+}
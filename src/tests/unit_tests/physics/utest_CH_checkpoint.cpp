@@ -0,0 +1,238 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for binary checkpointing of a Chrono system.
+// A chain of pendulums, with the first one driven by a torque motor (with a
+// setpoint function), is simulated with the HHT integrator. A checkpoint is
+// saved during the simulation and restored into a new copy of the model. The
+// simulation continued from the checkpoint must reproduce the original one
+// exactly. Restoring into a different model must fail.
+// The same is checked for a sled resting on an incline with SMC contact (the
+// contact history must be restored for static friction to hold the sled), and
+// corrupted array sizes in a checkpoint file must be detected.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "chrono/physics/ChContactContainerSMC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMotorRotationTorque.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const std::string filename = "utest_CH_checkpoint.dat";
+static const double step_size = 1e-3;
+
+class PendulumChain {
+  public:
+    PendulumChain(int num_links);
+
+    void Advance(int num_steps);
+
+    ChSystemNSC sys;
+    std::vector<std::shared_ptr<ChBody>> links;
+    std::shared_ptr<ChFunction_Setpoint> torque;
+};
+
+PendulumChain::PendulumChain(int num_links) {
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto solver = chrono_types::make_shared<ChSolverSparseQR>();
+    sys.SetSolver(solver);
+
+    sys.SetTimestepperType(ChTimestepper::Type::HHT);
+    auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper());
+    integrator->SetAlpha(-0.2);
+    integrator->SetMaxiters(20);
+    integrator->SetAbsTolerances(1e-8);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    std::shared_ptr<ChBody> prev = ground;
+    for (int i = 0; i < num_links; i++) {
+        auto link = chrono_types::make_shared<ChBody>();
+        link->SetMass(1.0 + 0.1 * i);
+        link->SetInertiaXX(ChVector<>(0.01, 0.01, 0.02));
+        link->SetPos(ChVector<>(0.5 + i, 0, 0));
+        sys.AddBody(link);
+        links.push_back(link);
+
+        ChVector<> loc(i, 0, 0);
+        if (i == 0) {
+            torque = chrono_types::make_shared<ChFunction_Setpoint>();
+            auto motor = chrono_types::make_shared<ChLinkMotorRotationTorque>();
+            motor->Initialize(link, prev, ChFrame<>(loc));
+            motor->SetTorqueFunction(torque);
+            sys.AddLink(motor);
+        } else {
+            auto joint = chrono_types::make_shared<ChLinkLockRevolute>();
+            joint->Initialize(link, prev, ChCoordsys<>(loc));
+            sys.AddLink(joint);
+        }
+        prev = link;
+    }
+}
+
+void PendulumChain::Advance(int num_steps) {
+    for (int i = 0; i < num_steps; i++) {
+        double time = sys.GetChTime();
+        torque->SetSetpoint(20 * std::sin(10 * time), time);
+        sys.DoStepDynamics(step_size);
+    }
+}
+
+TEST(ChSystem, checkpoint) {
+    const int num_links = 4;
+
+    // Run the original simulation, saving a checkpoint halfway
+    PendulumChain model1(num_links);
+    model1.Advance(200);
+    ASSERT_TRUE(model1.sys.SaveCheckpoint(filename));
+    double save_time = model1.sys.GetChTime();
+    model1.Advance(200);
+
+    // Restore the checkpoint in a new copy of the model and continue the simulation
+    PendulumChain model2(num_links);
+    ASSERT_TRUE(model2.sys.RestoreCheckpoint(filename));
+    ASSERT_EQ(model2.sys.GetChTime(), save_time);
+    model2.Advance(200);
+
+    ASSERT_EQ(model1.sys.GetChTime(), model2.sys.GetChTime());
+    ASSERT_EQ(model1.sys.GetStepcount(), model2.sys.GetStepcount());
+    for (int i = 0; i < num_links; i++) {
+        ASSERT_EQ(model1.links[i]->GetPos(), model2.links[i]->GetPos());
+        ASSERT_EQ(model1.links[i]->GetRot(), model2.links[i]->GetRot());
+        ASSERT_EQ(model1.links[i]->GetPos_dt(), model2.links[i]->GetPos_dt());
+        ASSERT_EQ(model1.links[i]->GetWvel_loc(), model2.links[i]->GetWvel_loc());
+    }
+
+    // Restoring in a different model must fail
+    PendulumChain model3(num_links + 1);
+    model3.Advance(1);
+    ASSERT_FALSE(model3.sys.RestoreCheckpoint(filename));
+
+    std::remove(filename.c_str());
+}
+
+// -----------------------------------------------------------------------------
+
+class SledOnIncline {
+  public:
+    SledOnIncline();
+
+    void Advance(int num_steps);
+
+    ChSystemSMC sys;
+    std::shared_ptr<ChBody> sled;
+};
+
+SledOnIncline::SledOnIncline() {
+    double angle = 15 * CH_C_DEG_TO_RAD;
+    sys.Set_G_acc(ChVector<>(9.81 * std::sin(angle), -9.81 * std::cos(angle), 0));
+    sys.UseMaterialProperties(false);
+    sys.SetContactForceModel(ChSystemSMC::Hooke);
+    sys.SetTangentialDisplacementModel(ChSystemSMC::MultiStep);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetFriction(0.5f);
+    mat->SetKn(2e5);
+    mat->SetGn(1e2);
+    mat->SetKt(2e5);
+    mat->SetGt(5e1);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(mat, 1, 0.1, 1, ChVector<>(0, -0.1, 0));
+    ground->GetCollisionModel()->BuildModel();
+    sys.AddBody(ground);
+
+    double radius = 0.02;
+    sled = chrono_types::make_shared<ChBody>();
+    sled->SetMass(1);
+    sled->SetInertiaXX(ChVector<>(0.01, 0.01, 0.01));
+    sled->SetPos(ChVector<>(0, radius - 1e-4, 0));
+    sled->SetCollide(true);
+    sled->GetCollisionModel()->ClearModel();
+    sled->GetCollisionModel()->AddSphere(mat, radius, ChVector<>(+0.1, 0, +0.1));
+    sled->GetCollisionModel()->AddSphere(mat, radius, ChVector<>(+0.1, 0, -0.1));
+    sled->GetCollisionModel()->AddSphere(mat, radius, ChVector<>(-0.1, 0, +0.1));
+    sled->GetCollisionModel()->AddSphere(mat, radius, ChVector<>(-0.1, 0, -0.1));
+    sled->GetCollisionModel()->BuildModel();
+    sys.AddBody(sled);
+}
+
+void SledOnIncline::Advance(int num_steps) {
+    for (int i = 0; i < num_steps; i++)
+        sys.DoStepDynamics(step_size);
+}
+
+TEST(ChSystem, checkpoint_smc) {
+    // Run the original simulation, saving a checkpoint after the sled landed
+    SledOnIncline model1;
+    model1.Advance(300);
+    auto container1 = std::static_pointer_cast<ChContactContainerSMC>(model1.sys.GetContactContainer());
+    ASSERT_EQ(container1->GetNumContactHistories(), 4);
+    ASSERT_TRUE(model1.sys.SaveCheckpoint(filename));
+    model1.Advance(300);
+
+    // Restore the checkpoint in a new copy of the model and continue the simulation
+    SledOnIncline model2;
+    ASSERT_TRUE(model2.sys.RestoreCheckpoint(filename));
+    auto container2 = std::static_pointer_cast<ChContactContainerSMC>(model2.sys.GetContactContainer());
+    ASSERT_EQ(container2->GetNumContactHistories(), 4);
+    model2.Advance(300);
+
+    ASSERT_EQ(model1.sys.GetChTime(), model2.sys.GetChTime());
+    ASSERT_EQ(model1.sled->GetPos(), model2.sled->GetPos());
+    ASSERT_EQ(model1.sled->GetRot(), model2.sled->GetRot());
+    ASSERT_EQ(model1.sled->GetPos_dt(), model2.sled->GetPos_dt());
+    ASSERT_EQ(model1.sled->GetWvel_loc(), model2.sled->GetWvel_loc());
+
+    std::remove(filename.c_str());
+}
+
+TEST(ChCheckpoint, array_size) {
+    // Array sizes larger than the rest of the file must be rejected before allocating the array
+    {
+        ChCheckpointOut cp(filename);
+        cp.Write((uint64_t)1 << 60);
+        cp.Write(1.0);
+        ASSERT_TRUE(cp.Close());
+    }
+    {
+        ChCheckpointIn cp(filename);
+        std::vector<double> vec;
+        ASSERT_THROW(cp.ReadArray(vec), ChException);
+    }
+    {
+        ChCheckpointIn cp(filename);
+        ChVectorDynamic<> vec;
+        ASSERT_THROW(cp.Read(vec), ChException);
+    }
+
+    std::remove(filename.c_str());
+}
@@ -0,0 +1,108 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the SMC contact history (MultiStep tangential displacement).
+// A sled resting on four spherical feet is placed on a horizontal plate, with
+// gravity inclined at an angle smaller than the friction angle. With the
+// MultiStep model, static friction holds the sled in place; with the OneStep
+// model (no contact history), the sled creeps.
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/physics/ChContactContainerPooledSMC.h"
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static std::shared_ptr<ChBody> CreateModel(ChSystemSMC& sys, ChSystemSMC::TangentialDisplacementModel model) {
+    double angle = 15 * CH_C_DEG_TO_RAD;
+    sys.Set_G_acc(ChVector<>(9.81 * std::sin(angle), -9.81 * std::cos(angle), 0));
+    sys.UseMaterialProperties(false);
+    sys.SetContactForceModel(ChSystemSMC::Hooke);
+    sys.SetTangentialDisplacementModel(model);
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetFriction(0.5f);
+    mat->SetKn(2e5);
+    mat->SetGn(1e2);
+    mat->SetKt(2e5);
+    mat->SetGt(5e1);
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->SetCollide(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(mat, 1, 0.1, 1, ChVector<>(0, -0.1, 0));
+    ground->GetCollisionModel()->BuildModel();
+    sys.AddBody(ground);
+
+    double radius = 0.02;
+    auto sled = chrono_types::make_shared<ChBody>();
+    sled->SetMass(1);
+    sled->SetInertiaXX(ChVector<>(0.01, 0.01, 0.01));
+    sled->SetPos(ChVector<>(0, radius - 1e-4, 0));
+    sled->SetCollide(true);
+    sled->GetCollisionModel()->ClearModel();
+    sled->GetCollisionModel()->AddSphere(mat, radius, ChVector<>(+0.1, 0, +0.1));
+    sled->GetCollisionModel()->AddSphere(mat, radius, ChVector<>(+0.1, 0, -0.1));
+    sled->GetCollisionModel()->AddSphere(mat, radius, ChVector<>(-0.1, 0, +0.1));
+    sled->GetCollisionModel()->AddSphere(mat, radius, ChVector<>(-0.1, 0, -0.1));
+    sled->GetCollisionModel()->BuildModel();
+    sys.AddBody(sled);
+
+    return sled;
+}
+
+TEST(ChContactContainerSMC, contact_history) {
+    ChSystemSMC sys_one;
+    ChSystemSMC sys_multi;
+    ChSystemSMC sys_pool;
+    auto sled_one = CreateModel(sys_one, ChSystemSMC::OneStep);
+    auto sled_multi = CreateModel(sys_multi, ChSystemSMC::MultiStep);
+    auto sled_pool = CreateModel(sys_pool, ChSystemSMC::MultiStep);
+    sys_pool.SetContactContainer(chrono_types::make_shared<ChContactContainerPooledSMC>());
+
+    // Positions after the sleds landed (they bounce off the initial interpenetration)
+    double x_one = 0;
+    double x_multi = 0;
+    for (int step = 0; step < 1000; step++) {
+        sys_one.DoStepDynamics(1e-3);
+        sys_multi.DoStepDynamics(1e-3);
+        sys_pool.DoStepDynamics(1e-3);
+        if (step == 199) {
+            x_one = sled_one->GetPos().x();
+            x_multi = sled_multi->GetPos().x();
+        }
+    }
+
+    auto container_one = std::static_pointer_cast<ChContactContainerSMC>(sys_one.GetContactContainer());
+    auto container_multi = std::static_pointer_cast<ChContactContainerSMC>(sys_multi.GetContactContainer());
+    auto container_pool = std::static_pointer_cast<ChContactContainerSMC>(sys_pool.GetContactContainer());
+    ASSERT_EQ(sys_multi.GetNcontacts(), 4);
+    ASSERT_EQ(container_one->GetNumContactHistories(), 0);
+    ASSERT_EQ(container_multi->GetNumContactHistories(), 4);
+    ASSERT_EQ(container_pool->GetNumContactHistories(), 4);
+
+    // Without contact history the sled creeps, with contact history it sticks
+    ASSERT_GT(sled_one->GetPos().x() - x_one, 1e-3);
+    ASSERT_LT(std::abs(sled_multi->GetPos().x() - x_multi), 1e-6);
+    ASSERT_LT(sled_multi->GetPos_dt().Length(), 1e-4);
+
+    // The pooled container uses the same contact history
+    ASSERT_NEAR((sled_multi->GetPos() - sled_pool->GetPos()).Length(), 0, 1e-10);
+}
@@ -0,0 +1,141 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the reuse of the symbolic factorization in ChDirectSolverLS.
+// The symbolic analysis must be skipped only if the sparsity pattern is exactly
+// the same as at the previous factorization, and must be redone if the pattern
+// changes, even if the number of nonzeros does not.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChVariablesGeneric.h"
+#include "chrono/solver/ChConstraintTwoGeneric.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class ChDirectSolverTest : public ::testing::Test {
+  protected:
+    ChDirectSolverTest() {
+        const int nvars = 4;
+        const int ndof = 6;
+
+        for (int i = 0; i < nvars; i++) {
+            auto var = new ChVariablesGeneric(ndof);
+            ChMatrixDynamic<> A = ChMatrixDynamic<>::Random(ndof, ndof);
+            var->GetMass() = A * A.transpose() + ndof * ChMatrixDynamic<>::Identity(ndof, ndof);
+            var->GetInvMass() = var->GetMass().inverse();
+            var->Get_fb() = ChVectorDynamic<>::Random(ndof);
+            variables.push_back(var);
+        }
+
+        // Constraints 0-1 and 1-2, or 0-1 and 2-3: same number of nonzeros, different sparsity pattern
+        constr_01 = CreateConstraint(0, 1);
+        constr_12 = CreateConstraint(1, 2);
+        constr_23 = CreateConstraint(2, 3);
+    }
+
+    ~ChDirectSolverTest() {
+        delete constr_01;
+        delete constr_12;
+        delete constr_23;
+        for (auto var : variables)
+            delete var;
+    }
+
+    ChConstraintTwoGeneric* CreateConstraint(int i, int j) {
+        auto constr = new ChConstraintTwoGeneric(variables[i], variables[j]);
+        constr->Get_Cq_a() = ChRowVectorDynamic<>::Random(variables[i]->Get_ndof());
+        constr->Get_Cq_b() = ChRowVectorDynamic<>::Random(variables[j]->Get_ndof());
+        constr->Set_b_i(0.1 * (i + j));
+        constr->Set_cfm_i(0.01);
+        constr->Update_auxiliary();
+        return constr;
+    }
+
+    void LoadDescriptor(ChConstraintTwoGeneric* constr) {
+        descriptor.BeginInsertion();
+        for (auto var : variables)
+            descriptor.InsertVariables(var);
+        descriptor.InsertConstraint(constr_01);
+        descriptor.InsertConstraint(constr);
+        descriptor.EndInsertion();
+        descriptor.UpdateCountsAndOffsets();
+    }
+
+    // Solve the current problem and return the residual of the linear system
+    double SolveAndCheck(ChDirectSolverLS& solver) {
+        EXPECT_TRUE(solver.Setup(descriptor));
+        solver.Solve(descriptor);
+
+        ChSparseMatrix Z;
+        ChVectorDynamic<> rhs;
+        descriptor.ConvertToMatrixForm(&Z, &rhs);
+        ChVectorDynamic<> x;
+        descriptor.FromUnknownsToVector(x);
+        return (Z * x - rhs).norm() / rhs.norm();
+    }
+
+    ChSystemDescriptor descriptor;
+    std::vector<ChVariablesGeneric*> variables;
+    ChConstraintTwoGeneric* constr_01;
+    ChConstraintTwoGeneric* constr_12;
+    ChConstraintTwoGeneric* constr_23;
+};
+
+TEST_F(ChDirectSolverTest, SymbolicReuse) {
+    ChSolverSparseLU solver;
+    solver.ReuseSymbolicFactorization(true);
+
+    // First factorization: symbolic analysis performed
+    LoadDescriptor(constr_12);
+    ASSERT_LT(SolveAndCheck(solver), 1e-10);
+    ASSERT_EQ(solver.GetNumAnalyzeCalls(), 1);
+
+    // Same sparsity pattern: symbolic analysis reused
+    variables[0]->Get_fb() *= 2;
+    ASSERT_LT(SolveAndCheck(solver), 1e-10);
+    ASSERT_EQ(solver.GetNumAnalyzeCalls(), 1);
+    ASSERT_EQ(solver.GetNumFactorizeCalls(), 2);
+}
+
+TEST_F(ChDirectSolverTest, PatternChangeSameNonzeros) {
+    ChSolverSparseLU solver;
+    solver.ReuseSymbolicFactorization(true);
+
+    LoadDescriptor(constr_12);
+    ChSparseMatrix Z1;
+    descriptor.ConvertToMatrixForm(&Z1, nullptr);
+    ASSERT_LT(SolveAndCheck(solver), 1e-10);
+    ASSERT_EQ(solver.GetNumAnalyzeCalls(), 1);
+
+    // Different sparsity pattern with the same dimension and number of nonzeros
+    LoadDescriptor(constr_23);
+    ChSparseMatrix Z2;
+    descriptor.ConvertToMatrixForm(&Z2, nullptr);
+    Z1.makeCompressed();
+    Z2.makeCompressed();
+    ASSERT_EQ(Z1.rows(), Z2.rows());
+    ASSERT_EQ(Z1.nonZeros(), Z2.nonZeros());
+    ASSERT_FALSE(std::equal(Z1.innerIndexPtr(), Z1.innerIndexPtr() + Z1.nonZeros(), Z2.innerIndexPtr()));
+
+    // The symbolic analysis must be redone and the solution must be correct
+    ASSERT_LT(SolveAndCheck(solver), 1e-10);
+    ASSERT_EQ(solver.GetNumAnalyzeCalls(), 2);
+}
@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for solving independent islands separately.
+// The model consists of several disconnected double pendulums. The results
+// obtained by solving each pendulum with its own solver must match those
+// obtained by solving the entire problem at once.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/solver/ChDirectSolverLS.h"
+#include "chrono/solver/ChSolverPSOR.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_pendulums = 4;
+
+static void CreateModel(ChSystemNSC& sys, std::vector<std::shared_ptr<ChBody>>& bodies) {
+    sys.Set_G_acc(ChVector<>(0, -10, 0));
+
+    auto ground = chrono_types::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    sys.AddBody(ground);
+
+    for (int i = 0; i < num_pendulums; i++) {
+        double z = 2.0 * i;
+
+        auto pend1 = chrono_types::make_shared<ChBody>();
+        pend1->SetPos(ChVector<>(1, 0, z));
+        sys.AddBody(pend1);
+
+        auto pend2 = chrono_types::make_shared<ChBody>();
+        pend2->SetPos(ChVector<>(2, 0.5 * i, z));
+        sys.AddBody(pend2);
+
+        auto rev1 = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev1->Initialize(ground, pend1, ChCoordsys<>(ChVector<>(0, 0, z)));
+        sys.AddLink(rev1);
+
+        auto rev2 = chrono_types::make_shared<ChLinkLockRevolute>();
+        rev2->Initialize(pend1, pend2, ChCoordsys<>(ChVector<>(1.5, 0, z)));
+        sys.AddLink(rev2);
+
+        bodies.push_back(pend2);
+    }
+}
+
+static void Compare(std::shared_ptr<ChSolver> solver_ref, std::shared_ptr<ChSolver> solver_isl, double tol) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_isl;
+    std::vector<std::shared_ptr<ChBody>> bodies_ref;
+    std::vector<std::shared_ptr<ChBody>> bodies_isl;
+    CreateModel(sys_ref, bodies_ref);
+    CreateModel(sys_isl, bodies_isl);
+
+    sys_ref.SetSolver(solver_ref);
+    sys_isl.SetSolver(solver_isl);
+    sys_isl.EnableIslandSolve(true);
+    sys_isl.SetNumThreads(2);
+
+    for (int step = 0; step < 200; step++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_isl.DoStepDynamics(1e-3);
+    }
+
+    ASSERT_EQ(sys_ref.GetNumSolverIslands(), 1);
+    ASSERT_EQ(sys_isl.GetNumSolverIslands(), num_pendulums);
+    for (int i = 0; i < num_pendulums; i++) {
+        ASSERT_NEAR((bodies_ref[i]->GetPos() - bodies_isl[i]->GetPos()).Length(), 0, tol);
+        ASSERT_NEAR((bodies_ref[i]->GetPos_dt() - bodies_isl[i]->GetPos_dt()).Length(), 0, tol);
+    }
+}
+
+TEST(ChSystem, island_solve_direct) {
+    Compare(chrono_types::make_shared<ChSolverSparseQR>(), chrono_types::make_shared<ChSolverSparseQR>(), 1e-8);
+}
+
+TEST(ChSystem, island_solve_iterative) {
+    auto solver_ref = chrono_types::make_shared<ChSolverPSOR>();
+    solver_ref->SetMaxIterations(200);
+    solver_ref->SetTolerance(1e-12);
+    auto solver_isl = chrono_types::make_shared<ChSolverPSOR>();
+    solver_isl->SetMaxIterations(200);
+    solver_isl->SetTolerance(1e-12);
+    Compare(solver_ref, solver_isl, 1e-4);
+}
@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the pooled NSC contact container.
+// A pile of balls settles in a box. The number of contacts, the contact
+// reactions, and the body trajectories obtained with the pooled container must
+// match those obtained with the default NSC contact container.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChContactContainerPooledNSC.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_balls = 27;
+
+static void CreateModel(ChSystemNSC& sys, std::vector<std::shared_ptr<ChBody>>& balls) {
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    mat->SetFriction(0.4f);
+
+    double radius = 0.05;
+    double mass = 5;
+    for (int i = 0; i < num_balls; i++) {
+        auto ball = chrono_types::make_shared<ChBody>();
+        ball->SetMass(mass);
+        ball->SetInertiaXX(0.4 * mass * radius * radius * ChVector<>(1, 1, 1));
+        ball->SetPos(ChVector<>(2.01 * radius * (i % 3 - 1) + 0.01 * (i / 9), 0.05 + 2.01 * radius * (i / 9),
+                                2.01 * radius * ((i / 3) % 3 - 1)));
+        ball->SetCollide(true);
+        ball->GetCollisionModel()->ClearModel();
+        ball->GetCollisionModel()->AddSphere(mat, radius);
+        ball->GetCollisionModel()->BuildModel();
+        sys.AddBody(ball);
+        balls.push_back(ball);
+    }
+
+    utils::CreateBoxContainer(&sys, 0, mat, ChVector<>(0.4, 0.4, 0.4), 0.1, ChVector<>(0, 0, 0),
+                              ChQuaternion<>(1, 0, 0, 0), true, true, false, false);
+}
+
+TEST(ChContactContainerPooledNSC, compare) {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_pool;
+    std::vector<std::shared_ptr<ChBody>> balls_ref;
+    std::vector<std::shared_ptr<ChBody>> balls_pool;
+    CreateModel(sys_ref, balls_ref);
+    CreateModel(sys_pool, balls_pool);
+
+    sys_pool.SetContactContainer(chrono_types::make_shared<ChContactContainerPooledNSC>());
+    ASSERT_TRUE(std::dynamic_pointer_cast<ChContactContainerPooledNSC>(sys_pool.GetContactContainer()) != nullptr);
+
+    int max_contacts = 0;
+    for (int step = 0; step < 200; step++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_pool.DoStepDynamics(1e-3);
+        ASSERT_EQ(sys_ref.GetNcontacts(), sys_pool.GetNcontacts());
+        max_contacts = std::max(max_contacts, sys_pool.GetNcontacts());
+
+        // Contact reactions (in the same order in both containers)
+        ChVectorDynamic<> L_ref(sys_ref.GetNconstr());
+        ChVectorDynamic<> L_pool(sys_pool.GetNconstr());
+        ASSERT_EQ(L_ref.size(), L_pool.size());
+        sys_ref.StateGatherReactions(L_ref);
+        sys_pool.StateGatherReactions(L_pool);
+        ASSERT_NEAR((L_ref - L_pool).lpNorm<Eigen::Infinity>(), 0, 1e-10) << "step " << step;
+    }
+    ASSERT_GT(max_contacts, num_balls);
+
+    for (int i = 0; i < num_balls; i++) {
+        ASSERT_NEAR((balls_ref[i]->GetPos() - balls_pool[i]->GetPos()).Length(), 0, 1e-10);
+        ASSERT_NEAR((balls_ref[i]->GetPos_dt() - balls_pool[i]->GetPos_dt()).Length(), 0, 1e-8);
+    }
+
+    // The cached contact forces must also match
+    sys_ref.GetContactContainer()->ComputeContactForces();
+    sys_pool.GetContactContainer()->ComputeContactForces();
+    for (int i = 0; i < num_balls; i++) {
+        ASSERT_NEAR((balls_ref[i]->GetContactForce() - balls_pool[i]->GetContactForce()).Length(), 0, 1e-6);
+    }
+}
@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the pooled SMC contact container.
+// A pile of balls settles in a box. The results obtained with the pooled
+// container (with parallel force evaluation and loading) must match those
+// obtained with the default SMC contact container, with and without stiff
+// contact.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <vector>
+
+#include "chrono/physics/ChContactContainerPooledSMC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/timestepper/ChTimestepperHHT.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_balls = 27;
+
+static void CreateModel(ChSystemSMC& sys, std::vector<std::shared_ptr<ChBody>>& balls, bool stiff_contact) {
+    sys.Set_G_acc(ChVector<>(0, -9.81, 0));
+    sys.UseMaterialProperties(false);
+    sys.SetContactForceModel(ChSystemSMC::Hooke);
+    sys.SetStiffContact(stiff_contact);
+
+    if (stiff_contact) {
+        sys.SetTimestepperType(ChTimestepper::Type::HHT);
+        auto integrator = std::static_pointer_cast<ChTimestepperHHT>(sys.GetTimestepper());
+        integrator->SetAlpha(0.0);
+        integrator->SetMaxiters(100);
+        integrator->SetAbsTolerances(1e-08);
+    }
+
+    auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    mat->SetFriction(0.4f);
+    mat->SetKn(2e4);
+    mat->SetGn(5e2);
+    mat->SetKt(2e4);
+    mat->SetGt(5e2);
+
+    double radius = 0.05;
+    double mass = 5;
+    for (int i = 0; i < num_balls; i++) {
+        auto ball = chrono_types::make_shared<ChBody>();
+        ball->SetMass(mass);
+        ball->SetInertiaXX(0.4 * mass * radius * radius * ChVector<>(1, 1, 1));
+        // Balls initially in contact with their neighbors and with the bottom of the box
+        ball->SetPos(ChVector<>(1.98 * radius * (i % 3 - 1) + 0.01 * (i / 9), 0.049 + 1.98 * radius * (i / 9),
+                                1.98 * radius * ((i / 3) % 3 - 1)));
+        ball->SetCollide(true);
+        ball->GetCollisionModel()->ClearModel();
+        ball->GetCollisionModel()->AddSphere(mat, radius);
+        ball->GetCollisionModel()->BuildModel();
+        sys.AddBody(ball);
+        balls.push_back(ball);
+    }
+
+    utils::CreateBoxContainer(&sys, 0, mat, ChVector<>(0.4, 0.4, 0.4), 0.1, ChVector<>(0, 0, 0),
+                              ChQuaternion<>(1, 0, 0, 0), true, true, false, false);
+}
+
+class PooledSMC : public ::testing::TestWithParam<bool> {};
+
+TEST_P(PooledSMC, compare) {
+    bool stiff_contact = GetParam();
+
+    ChSystemSMC sys_ref;
+    ChSystemSMC sys_pool;
+    std::vector<std::shared_ptr<ChBody>> balls_ref;
+    std::vector<std::shared_ptr<ChBody>> balls_pool;
+    CreateModel(sys_ref, balls_ref, stiff_contact);
+    CreateModel(sys_pool, balls_pool, stiff_contact);
+
+    sys_pool.SetContactContainer(chrono_types::make_shared<ChContactContainerPooledSMC>());
+    sys_pool.SetNumThreads(2);
+    ASSERT_TRUE(std::dynamic_pointer_cast<ChContactContainerPooledSMC>(sys_pool.GetContactContainer()) != nullptr);
+
+    int max_contacts = 0;
+    double max_force = 0;
+    for (int step = 0; step < 200; step++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_pool.DoStepDynamics(1e-3);
+        ASSERT_EQ(sys_ref.GetNcontacts(), sys_pool.GetNcontacts());
+        max_contacts = std::max(max_contacts, sys_pool.GetNcontacts());
+
+        // The contact forces must match at every step (the pile may bounce, so the final state alone may not have any
+        // contacts to compare)
+        sys_ref.GetContactContainer()->ComputeContactForces();
+        sys_pool.GetContactContainer()->ComputeContactForces();
+        for (int i = 0; i < num_balls; i++) {
+            ChVector<> force_ref = balls_ref[i]->GetContactForce();
+            ChVector<> force_pool = balls_pool[i]->GetContactForce();
+            ASSERT_NEAR((force_ref - force_pool).Length(), 0, 1e-6 * std::max(1.0, force_ref.Length()))
+                << "step " << step << " ball " << i;
+            max_force = std::max(max_force, force_ref.Length());
+        }
+    }
+
+    ASSERT_GT(max_contacts, num_balls);
+    ASSERT_GT(max_force, 0);
+    for (int i = 0; i < num_balls; i++) {
+        ASSERT_NEAR((balls_ref[i]->GetPos() - balls_pool[i]->GetPos()).Length(), 0, 1e-10);
+        ASSERT_NEAR((balls_ref[i]->GetPos_dt() - balls_pool[i]->GetPos_dt()).Length(), 0, 1e-8);
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChSystem, PooledSMC, ::testing::Values(false, true));
@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for body islands and sleeping.
+// Two separate stacks of boxes come to rest on the ground and fall asleep as two
+// islands. Waking up one box must wake up its entire stack, while the other
+// stack keeps sleeping.
+//
+// =============================================================================
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/physics/ChBodyEasy.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class SleepingTest : public ::testing::TestWithParam<ChContactMethod> {
+  protected:
+    SleepingTest();
+    ~SleepingTest() { delete sys; }
+
+    ChSystem* sys;
+    std::vector<std::shared_ptr<ChBody>> stack1;
+    std::vector<std::shared_ptr<ChBody>> stack2;
+};
+
+SleepingTest::SleepingTest() {
+    std::shared_ptr<ChMaterialSurface> mat;
+    if (GetParam() == ChContactMethod::NSC) {
+        sys = new ChSystemNSC;
+        mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    } else {
+        sys = new ChSystemSMC;
+        auto matSMC = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+        matSMC->SetYoungModulus(1e7f);
+        matSMC->SetRestitution(0);
+        mat = matSMC;
+    }
+    sys->Set_G_acc(ChVector<>(0, -9.81, 0));
+    sys->SetUseSleeping(true);
+
+    auto ground = chrono_types::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, false, true, mat);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    sys->AddBody(ground);
+
+    for (int i = 0; i < 3; i++) {
+        auto box1 = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, true, mat);
+        box1->SetPos(ChVector<>(-2, 0.25 + 0.5 * i, 0));
+        box1->SetSleepTime(0.2f);
+        sys->AddBody(box1);
+        stack1.push_back(box1);
+
+        auto box2 = chrono_types::make_shared<ChBodyEasyBox>(0.5, 0.5, 0.5, 1000, false, true, mat);
+        box2->SetPos(ChVector<>(+2, 0.25 + 0.5 * i, 0));
+        box2->SetSleepTime(0.2f);
+        sys->AddBody(box2);
+        stack2.push_back(box2);
+    }
+}
+
+TEST_P(SleepingTest, islands) {
+    // Let the stacks come to rest and fall asleep
+    double step = GetParam() == ChContactMethod::NSC ? 1e-2 : 1e-4;
+    while (sys->GetChTime() < 1.5) {
+        sys->DoStepDynamics(step);
+    }
+
+    ASSERT_EQ(sys->GetNumIslands(), 2);
+    ASSERT_EQ(sys->GetNumSleepingIslands(), 2);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_TRUE(stack1[i]->GetSleeping());
+        ASSERT_TRUE(stack2[i]->GetSleeping());
+    }
+
+    // Wake up and push the top box of the first stack; the entire first stack must wake up
+    stack1[2]->SetSleeping(false);
+    stack1[2]->SetPos_dt(ChVector<>(1, 0, 0));
+    sys->DoStepDynamics(step);
+
+    ASSERT_EQ(sys->GetNumSleepingIslands(), 1);
+    for (int i = 0; i < 3; i++) {
+        ASSERT_FALSE(stack1[i]->GetSleeping());
+        ASSERT_TRUE(stack2[i]->GetSleeping());
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(ChronoSleeping, SleepingTest, ::testing::Values(ChContactMethod::NSC, ChContactMethod::SMC));
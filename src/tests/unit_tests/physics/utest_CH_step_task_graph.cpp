@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the task graph execution of the integration step.
+// A pile of balls, connected to the ground by springs, settles in a box, next to
+// a hanging chain of FEA spring elements. The results obtained with concurrent
+// execution of the step stages must be identical to those obtained with the
+// serial pipeline, for both NSC and SMC.
+//
+// =============================================================================
+
+#include <vector>
+
+#include "chrono/fea/ChElementSpring.h"
+#include "chrono/fea/ChMesh.h"
+#include "chrono/physics/ChLinkTSDA.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono/utils/ChUtilsCreators.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+static const int num_balls = 18;
+
+static ChSystem* CreateModel(ChContactMethod method,
+                             std::vector<std::shared_ptr<ChBody>>& balls,
+                             std::vector<std::shared_ptr<fea::ChNodeFEAxyz>>& nodes) {
+    ChSystem* sys = nullptr;
+    std::shared_ptr<ChMaterialSurface> mat;
+    if (method == ChContactMethod::NSC) {
+        sys = new ChSystemNSC();
+        mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+    } else {
+        sys = new ChSystemSMC();
+        mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+    }
+    sys->Set_G_acc(ChVector<>(0, -9.81, 0));
+    sys->SetNumThreads(2);
+    mat->SetFriction(0.4f);
+
+    auto ground = utils::CreateBoxContainer(sys, 0, mat, ChVector<>(0.4, 0.4, 0.4), 0.1, ChVector<>(0, 0, 0),
+                                            ChQuaternion<>(1, 0, 0, 0), true, true, false, false);
+
+    double radius = 0.05;
+    double mass = 5;
+    for (int i = 0; i < num_balls; i++) {
+        auto ball = chrono_types::make_shared<ChBody>();
+        ball->SetMass(mass);
+        ball->SetInertiaXX(0.4 * mass * radius * radius * ChVector<>(1, 1, 1));
+        ball->SetPos(ChVector<>(2.1 * radius * (i % 3 - 1) + 0.01 * (i / 9), 0.06 + 2.1 * radius * (i / 9),
+                                2.1 * radius * ((i / 3) % 3 - 1)));
+        ball->SetCollide(true);
+        ball->GetCollisionModel()->ClearModel();
+        ball->GetCollisionModel()->AddSphere(mat, radius);
+        ball->GetCollisionModel()->BuildModel();
+        sys->AddBody(ball);
+        balls.push_back(ball);
+
+        auto spring = chrono_types::make_shared<ChLinkTSDA>();
+        spring->Initialize(ground, ball, false, ball->GetPos() + ChVector<>(0, 0.5, 0), ball->GetPos());
+        spring->SetSpringCoefficient(10);
+        sys->AddLink(spring);
+    }
+
+    // Chain of FEA springs, hanging from a fixed node
+    auto mesh = chrono_types::make_shared<fea::ChMesh>();
+    for (int i = 0; i < 5; i++) {
+        auto node = chrono_types::make_shared<fea::ChNodeFEAxyz>(ChVector<>(0.6 + 0.1 * i, 0.5, 0));
+        node->SetMass(0.1);
+        mesh->AddNode(node);
+        if (i == 0) {
+            node->SetFixed(true);
+        } else {
+            auto element = chrono_types::make_shared<fea::ChElementSpring>();
+            element->SetNodes(nodes.back(), node);
+            element->SetSpringK(100);
+            element->SetDamperR(0.1);
+            mesh->AddElement(element);
+        }
+        nodes.push_back(node);
+    }
+    sys->Add(mesh);
+
+    return sys;
+}
+
+class StepTaskGraph : public ::testing::TestWithParam<ChContactMethod> {};
+
+TEST_P(StepTaskGraph, compare) {
+    std::vector<std::shared_ptr<ChBody>> balls_serial;
+    std::vector<std::shared_ptr<ChBody>> balls_graph;
+    std::vector<std::shared_ptr<fea::ChNodeFEAxyz>> nodes_serial;
+    std::vector<std::shared_ptr<fea::ChNodeFEAxyz>> nodes_graph;
+    ChSystem* sys_serial = CreateModel(GetParam(), balls_serial, nodes_serial);
+    ChSystem* sys_graph = CreateModel(GetParam(), balls_graph, nodes_graph);
+    sys_graph->SetUseStepTaskGraph(true);
+
+    for (int step = 0; step < 200; step++) {
+        sys_serial->DoStepDynamics(1e-3);
+        sys_graph->DoStepDynamics(1e-3);
+        ASSERT_EQ(sys_serial->GetNcontacts(), sys_graph->GetNcontacts());
+    }
+
+    ASSERT_GT(sys_graph->GetNcontacts(), 0);
+    for (int i = 0; i < num_balls; i++) {
+        ASSERT_EQ((balls_serial[i]->GetPos() - balls_graph[i]->GetPos()).Length(), 0.0);
+        ASSERT_EQ((balls_serial[i]->GetPos_dt() - balls_graph[i]->GetPos_dt()).Length(), 0.0);
+    }
+    ASSERT_GT((nodes_graph.back()->GetX0() - nodes_graph.back()->GetPos()).Length(), 0.01);
+    for (size_t i = 0; i < nodes_serial.size(); i++) {
+        ASSERT_EQ((nodes_serial[i]->GetPos() - nodes_graph[i]->GetPos()).Length(), 0.0);
+        ASSERT_EQ((nodes_serial[i]->GetPos_dt() - nodes_graph[i]->GetPos_dt()).Length(), 0.0);
+    }
+
+    // Stages of the step
+    const auto& graph_serial = sys_serial->GetStepTaskGraph();
+    const auto& graph = sys_graph->GetStepTaskGraph();
+    ASSERT_EQ(graph_serial.GetNumTasks(), graph_serial.GetNumWaves());
+    ASSERT_EQ(graph.GetNumTasks(), graph.GetNumWaves() + 1);
+    ASSERT_EQ(graph.GetTaskName(1), "collision");
+    ASSERT_EQ(graph.GetTaskName(2), "mesh_update");
+    ASSERT_EQ(graph.GetTaskWave(1), graph.GetTaskWave(2));
+    ASSERT_GT(graph.GetTaskTime("advance"), 0);
+    ASSERT_LE(graph.GetTaskTime("advance"), sys_graph->GetTimerStep());
+
+    delete sys_serial;
+    delete sys_graph;
+}
+
+INSTANTIATE_TEST_SUITE_P(ChSystem, StepTaskGraph, ::testing::Values(ChContactMethod::NSC, ChContactMethod::SMC));
@@ -0,0 +1,164 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Tests for the compiled representation of ChSystemDescriptor: the Schur
+// complement and system products must match the default implementations.
+// Also tests the parallel assembly of the system matrix.
+//
+// =============================================================================
+
+#include "chrono/solver/ChSystemDescriptor.h"
+#include "chrono/solver/ChVariablesGeneric.h"
+#include "chrono/solver/ChConstraintTwoGeneric.h"
+#include "chrono/solver/ChKblockGeneric.h"
+#include "chrono/core/ChSparsityPatternLearner.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+
+class ChSystemDescriptorTest : public ::testing::Test {
+  protected:
+    ChSystemDescriptorTest() {
+        const int nvars = 4;
+        const int ndof = 6;
+        const int nconstr = 7;
+
+        for (int i = 0; i < nvars; i++) {
+            auto var = new ChVariablesGeneric(ndof);
+            ChMatrixDynamic<> A = ChMatrixDynamic<>::Random(ndof, ndof);
+            var->GetMass() = A * A.transpose() + ndof * ChMatrixDynamic<>::Identity(ndof, ndof);
+            var->GetInvMass() = var->GetMass().inverse();
+            variables.push_back(var);
+        }
+
+        // Make one of the variables inactive (e.g., a fixed body)
+        variables[nvars - 1]->SetDisabled(true);
+
+        for (int i = 0; i < nconstr; i++) {
+            auto constr = new ChConstraintTwoGeneric(variables[i % nvars], variables[(i + 1) % nvars]);
+            constr->Get_Cq_a() = ChRowVectorDynamic<>::Random(ndof);
+            constr->Get_Cq_b() = ChRowVectorDynamic<>::Random(ndof);
+            constr->Set_cfm_i(0.01 * i);
+            constr->Update_auxiliary();
+            constraints.push_back(constr);
+        }
+
+        descriptor.BeginInsertion();
+        for (auto var : variables)
+            descriptor.InsertVariables(var);
+        for (auto constr : constraints)
+            descriptor.InsertConstraint(constr);
+        descriptor.EndInsertion();
+        descriptor.SetMassFactor(0.5);
+        descriptor.SetNumThreads(2);
+    }
+
+    ~ChSystemDescriptorTest() {
+        for (auto constr : constraints)
+            delete constr;
+        for (auto var : variables)
+            delete var;
+    }
+
+    ChSystemDescriptor descriptor;
+    std::vector<ChVariablesGeneric*> variables;
+    std::vector<ChConstraintTwoGeneric*> constraints;
+};
+
+TEST_F(ChSystemDescriptorTest, ShurComplementProduct) {
+    int nc = descriptor.CountActiveConstraints();
+    ChVectorDynamic<> l = ChVectorDynamic<>::Random(nc);
+
+    ChVectorDynamic<> result_default(nc);
+    descriptor.ShurComplementProduct(result_default, l);
+
+    descriptor.EnableCompiledProducts(true);
+    descriptor.Compile();
+    ChVectorDynamic<> result_compiled(nc);
+    descriptor.ShurComplementProduct(result_compiled, l);
+
+    ASSERT_TRUE(result_default.isApprox(result_compiled, 1e-12));
+}
+
+TEST_F(ChSystemDescriptorTest, SystemProduct) {
+    int n = descriptor.CountActiveVariables() + descriptor.CountActiveConstraints();
+    ChVectorDynamic<> x = ChVectorDynamic<>::Random(n);
+
+    ChVectorDynamic<> result_default(n);
+    descriptor.SystemProduct(result_default, x);
+
+    descriptor.EnableCompiledProducts(true);
+    descriptor.Compile();
+    ChVectorDynamic<> result_compiled(n);
+    descriptor.SystemProduct(result_compiled, x);
+
+    ASSERT_TRUE(result_default.isApprox(result_compiled, 1e-12));
+}
+
+TEST_F(ChSystemDescriptorTest, MassFactorChange) {
+    int n = descriptor.CountActiveVariables() + descriptor.CountActiveConstraints();
+    ChVectorDynamic<> x = ChVectorDynamic<>::Random(n);
+
+    descriptor.SetMassFactor(2.0);
+    ChVectorDynamic<> result_default(n);
+    descriptor.SystemProduct(result_default, x);
+
+    // Assemble the compiled system matrix with a different mass factor
+    descriptor.SetMassFactor(0.5);
+    descriptor.EnableCompiledProducts(true);
+    descriptor.Compile();
+    ChVectorDynamic<> result_compiled(n);
+    descriptor.SystemProduct(result_compiled, x);
+
+    // Changing the mass factor must not reuse the stale compiled matrix
+    descriptor.SetMassFactor(2.0);
+    descriptor.SystemProduct(result_compiled, x);
+
+    ASSERT_TRUE(result_default.isApprox(result_compiled, 1e-12));
+}
+
+TEST_F(ChSystemDescriptorTest, ParallelAssembly) {
+    // Add stiffness blocks, with shared variables
+    std::vector<ChKblockGeneric> kblocks;
+    kblocks.reserve(variables.size());
+    for (size_t i = 0; i < variables.size(); i++) {
+        kblocks.emplace_back(variables[i], variables[(i + 1) % variables.size()]);
+        kblocks.back().Get_K() = ChMatrixDynamic<>::Random(12, 12);
+    }
+
+    descriptor.BeginInsertion();
+    for (auto var : variables)
+        descriptor.InsertVariables(var);
+    for (auto constr : constraints)
+        descriptor.InsertConstraint(constr);
+    for (auto& kblock : kblocks)
+        descriptor.InsertKblock(&kblock);
+    descriptor.EndInsertion();
+    descriptor.UpdateCountsAndOffsets();
+
+    int n = descriptor.CountActiveVariables() + descriptor.CountActiveConstraints();
+
+    ChSparseMatrix Z_serial;
+    descriptor.ConvertToMatrixForm(&Z_serial, nullptr);
+
+    ChSparsityPatternLearner sparsity_pattern(n, n);
+    descriptor.ConvertToMatrixForm(&sparsity_pattern, nullptr);
+    ChSparseMatrix Z_parallel;
+    sparsity_pattern.Apply(Z_parallel);
+    descriptor.ConvertToMatrixFormParallel(Z_parallel);
+
+    ASSERT_EQ(Z_serial.nonZeros(), Z_parallel.nonZeros());
+    ASSERT_TRUE(ChMatrixDynamic<>(Z_serial).isApprox(ChMatrixDynamic<>(Z_parallel), 1e-12));
+}
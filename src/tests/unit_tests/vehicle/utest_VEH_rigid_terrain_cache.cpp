@@ -0,0 +1,124 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the cached height fields of RigidTerrain mesh patches.
+// Terrain heights and normals obtained with a cached height field must match
+// those obtained by ray casting into the patch collision model, for query points
+// above and below the terrain surface. The cache must also give the same
+// results when loaded back from a cache file.
+//
+// =============================================================================
+
+#include <cmath>
+#include <memory>
+
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "chrono_thirdparty/filesystem/path.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+static const std::string mesh_file = "terrain/meshes/test_terrain_irregular.obj";
+
+class RigidTerrainCacheTest : public ::testing::Test {
+  protected:
+    RigidTerrainCacheTest() {
+        ref_terrain = CreateTerrain(ref_sys, RigidTerrain::HeightFieldType::NONE, "");
+
+        // Query points on a horizontal grid covering the mesh (and beyond)
+        auto trimesh = geometry::ChTriangleMeshConnected::CreateFromWavefrontFile(vehicle::GetDataFile(mesh_file));
+        ChVector<> vmin(+1e10);
+        ChVector<> vmax(-1e10);
+        for (const auto& v : trimesh->getCoordsVertices()) {
+            vmin = Vmin(vmin, v);
+            vmax = Vmax(vmax, v);
+        }
+        int n = 40;
+        for (int i = 0; i <= n; i++) {
+            for (int j = 0; j <= n; j++) {
+                double x = vmin.x() - 0.1 + (vmax.x() - vmin.x() + 0.2) * i / n;
+                double y = vmin.y() - 0.1 + (vmax.y() - vmin.y() + 0.2) * j / n;
+                points.push_back(ChVector<>(x, y, vmax.z() + 1));
+            }
+        }
+    }
+
+    std::shared_ptr<RigidTerrain> CreateTerrain(ChSystem& sys,
+                                                RigidTerrain::HeightFieldType type,
+                                                const std::string& cache_dir) {
+        auto terrain = chrono_types::make_shared<RigidTerrain>(&sys);
+        terrain->EnableHeightFieldCache(type, 0.02, cache_dir);
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceNSC>();
+        terrain->AddPatch(mat, ChCoordsys<>(ChVector<>(0.1, -0.2, 0.3), Q_from_AngZ(0.3)),
+                          vehicle::GetDataFile(mesh_file), true, 0, false);
+        terrain->Initialize();
+        return terrain;
+    }
+
+    // Compare terrain queries at all query points, with the given tolerances on height and normal
+    void Compare(RigidTerrain& terrain, double height_tol, double normal_tol) {
+        int num_hits = 0;
+        for (const auto& p : points) {
+            double h_ref = ref_terrain->GetHeight(p);
+            ChVector<> n_ref = ref_terrain->GetNormal(p);
+            double h = terrain.GetHeight(p);
+            ChVector<> n = terrain.GetNormal(p);
+            ASSERT_NEAR(h, h_ref, height_tol) << "at " << p;
+            ASSERT_NEAR((n - n_ref).Length(), 0, normal_tol) << "at " << p;
+
+            // Query points below the terrain surface
+            if (h_ref == 0)
+                continue;
+            num_hits++;
+            ChVector<> q(p.x(), p.y(), h_ref - 0.05);
+            ASSERT_NEAR(terrain.GetHeight(q), ref_terrain->GetHeight(q), height_tol) << "at " << q;
+        }
+        ASSERT_GT(num_hits, (int)points.size() / 2);
+    }
+
+    ChSystemNSC ref_sys;
+    std::shared_ptr<RigidTerrain> ref_terrain;
+    std::vector<ChVector<>> points;
+};
+
+TEST_F(RigidTerrainCacheTest, triangles) {
+    ChSystemNSC sys;
+    auto terrain = CreateTerrain(sys, RigidTerrain::HeightFieldType::TRIANGLES, "");
+    Compare(*terrain, 1e-6, 1e-6);
+}
+
+TEST_F(RigidTerrainCacheTest, grid) {
+    ChSystemNSC sys;
+    auto terrain = CreateTerrain(sys, RigidTerrain::HeightFieldType::GRID, "");
+    // Bilinear interpolation of heights and normals: only approximate at the grid resolution
+    Compare(*terrain, 2e-2, 0.5);
+}
+
+TEST_F(RigidTerrainCacheTest, cache_file) {
+    std::string cache_dir = "rigid_terrain_cache";
+    filesystem::create_directory(filesystem::path(cache_dir));
+
+    // The first terrain builds and saves the height field, the second one loads it
+    ChSystemNSC sys1;
+    auto terrain1 = CreateTerrain(sys1, RigidTerrain::HeightFieldType::TRIANGLES, cache_dir);
+    ChSystemNSC sys2;
+    auto terrain2 = CreateTerrain(sys2, RigidTerrain::HeightFieldType::TRIANGLES, cache_dir);
+    Compare(*terrain2, 1e-6, 1e-6);
+}
@@ -0,0 +1,119 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2026 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors: agent
+// =============================================================================
+//
+// Unit test for the SCM contact detection by rasterization of collision shapes.
+// A sphere and a box are pressed into the SCM terrain. Rasterization must find
+// the same grid nodes in contact, and produce the same sinkage, as ray casting
+// (with and without a moving patch).
+//
+// =============================================================================
+
+#include <map>
+#include <memory>
+
+#include "chrono/physics/ChSystemSMC.h"
+
+#include "chrono_vehicle/terrain/SCMTerrain.h"
+
+#include "gtest/gtest.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+class SCMModel {
+  public:
+    SCMModel(SCMTerrain::ContactDetectionType type, bool moving_patch) : terrain(&sys, false) {
+        sys.Set_G_acc(ChVector<>(0, 0, -9.81));
+        auto mat = chrono_types::make_shared<ChMaterialSurfaceSMC>();
+
+        // Sphere and box, with all box edges halfway between grid nodes
+        sphere = chrono_types::make_shared<ChBody>();
+        sphere->SetPos(ChVector<>(0.3, 0, 0.24));
+        sphere->SetBodyFixed(true);
+        sphere->SetCollide(true);
+        sphere->GetCollisionModel()->ClearModel();
+        sphere->GetCollisionModel()->AddSphere(mat, 0.25);
+        sphere->GetCollisionModel()->BuildModel();
+        sys.AddBody(sphere);
+
+        box = chrono_types::make_shared<ChBody>();
+        box->SetPos(ChVector<>(-0.475, 0.025, 0.09));
+        box->SetBodyFixed(true);
+        box->SetCollide(true);
+        box->GetCollisionModel()->ClearModel();
+        box->GetCollisionModel()->AddBox(mat, 0.2, 0.15, 0.1);
+        box->GetCollisionModel()->BuildModel();
+        sys.AddBody(box);
+
+        terrain.SetSoilParameters(2e6, 0, 1.1, 0, 30, 0.01, 4e7, 3e4);
+        terrain.SetContactDetectionType(type);
+        if (moving_patch)
+            terrain.AddMovingPatch(sphere, VNULL, ChVector<>(0.6, 0.6, 0.6));
+        terrain.Initialize(2.0, 2.0, 0.05);
+    }
+
+    void Advance(double step) {
+        // Press the bodies further into the soil
+        sphere->SetPos(sphere->GetPos() - ChVector<>(0, 0, 0.002));
+        box->SetPos(box->GetPos() - ChVector<>(0, 0, 0.002));
+        sys.DoStepDynamics(step);
+    }
+
+    std::map<std::pair<int, int>, double> GetNodes() const {
+        std::map<std::pair<int, int>, double> nodes;
+        for (const auto& n : terrain.GetModifiedNodes(true))
+            nodes[{n.first.x(), n.first.y()}] = n.second;
+        return nodes;
+    }
+
+    ChSystemSMC sys;
+    SCMTerrain terrain;
+    std::shared_ptr<ChBody> sphere;
+    std::shared_ptr<ChBody> box;
+};
+
+class SCMRaster : public ::testing::TestWithParam<bool> {};
+
+TEST_P(SCMRaster, compare) {
+    bool moving_patch = GetParam();
+    SCMModel ray(SCMTerrain::ContactDetectionType::RAY_CASTING, moving_patch);
+    SCMModel raster(SCMTerrain::ContactDetectionType::RASTERIZATION, moving_patch);
+
+    for (int step = 0; step < 10; step++) {
+        ray.Advance(1e-3);
+        raster.Advance(1e-3);
+
+        // Same nodes in contact
+        ASSERT_GT(ray.terrain.GetNumRayHits(), 0);
+        ASSERT_EQ(ray.terrain.GetNumRayHits(), raster.terrain.GetNumRayHits()) << "step " << step;
+        ASSERT_EQ(raster.terrain.GetNumRayCasts(), 0);
+
+        // Same sinkage at all modified nodes
+        auto ray_nodes = ray.GetNodes();
+        auto raster_nodes = raster.GetNodes();
+        ASSERT_EQ(ray_nodes.size(), raster_nodes.size()) << "step " << step;
+        for (const auto& n : ray_nodes) {
+            auto it = raster_nodes.find(n.first);
+            ASSERT_TRUE(it != raster_nodes.end()) << "node " << n.first.first << " " << n.first.second;
+            ASSERT_NEAR(n.second, it->second, 1e-6) << "node " << n.first.first << " " << n.first.second;
+        }
+    }
+
+    // Same terrain forces on the bodies
+    auto f_ray = ray.terrain.GetContactForce(ray.sphere);
+    auto f_raster = raster.terrain.GetContactForce(raster.sphere);
+    ASSERT_NEAR((f_ray.force - f_raster.force).Length(), 0, 1e-6 * f_ray.force.Length());
+}
+
+INSTANTIATE_TEST_SUITE_P(SCMTerrain, SCMRaster, ::testing::Values(false, true));